@@ -0,0 +1,48 @@
+'''
+    Measures the throughput of Buffer.clear() in GB/s.
+
+    usage: python buffer_clear.py [size_in_mb]
+'''
+
+import sys
+import time
+
+import moderngl
+
+REPEAT = 10
+
+
+def measure(ctx, buf, **kwargs):
+    buf.clear(**kwargs)
+    ctx.finish()
+    start = time.perf_counter()
+    for _ in range(REPEAT):
+        buf.clear(**kwargs)
+    ctx.finish()
+    elapsed = time.perf_counter() - start
+    size = kwargs.get('size', buf.size - kwargs.get('offset', 0))
+    return size * REPEAT / elapsed / 1e9
+
+
+def main():
+    size = int(sys.argv[1]) if len(sys.argv) > 1 else 512
+    ctx = moderngl.create_standalone_context()
+    buf = ctx.buffer(reserve=size * 1024 * 1024)
+
+    print('%s / %s' % (ctx.info['GL_RENDERER'], ctx.info['GL_VERSION']))
+    print('buffer size: %d MB' % size)
+
+    cases = [
+        ('zero', {}),
+        ('chunk 4 bytes', {'chunk': b'\x01\x02\x03\x04'}),
+        ('chunk 16 bytes', {'chunk': bytes(range(16))}),
+        ('chunk 3 bytes (mapped)', {'chunk': b'\x01\x02\x03', 'size': buf.size // 3 * 3}),
+        ('chunk 4 bytes, unaligned offset (mapped)', {'chunk': b'\x01\x02\x03\x04', 'offset': 1, 'size': buf.size - 4}),
+    ]
+
+    for name, kwargs in cases:
+        print('%-42s %8.2f GB/s' % (name, measure(ctx, buf, **kwargs)))
+
+
+if __name__ == '__main__':
+    main()
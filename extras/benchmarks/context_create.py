@@ -0,0 +1,48 @@
+'''
+    Measures the time it takes to create and release a standalone context.
+
+    The OpenGL functions are resolved by calling the GetProcAddress function of the
+    window system directly or by calling load(name) on the backend for every function.
+    The benchmark fails when the backend has no native loader.
+
+    usage: python context_create.py [backend]
+'''
+
+import sys
+import time
+
+import moderngl
+
+REPEAT = 50
+
+
+def measure(**settings):
+    moderngl.create_standalone_context(**settings).release()
+    start = time.perf_counter()
+    for _ in range(REPEAT):
+        moderngl.create_standalone_context(**settings).release()
+    elapsed = time.perf_counter() - start
+    return elapsed / REPEAT * 1e3
+
+
+def main():
+    settings = {'backend': sys.argv[1]} if len(sys.argv) > 1 else {}
+    ctx = moderngl.create_standalone_context(**settings)
+    print('%s / %s' % (ctx.info['GL_RENDERER'], ctx.info['GL_VERSION']))
+    native_loader = ctx.native_loader
+    ctx.release()
+
+    if not native_loader:
+        sys.exit('the backend has no native loader, both cases would measure load(name)')
+
+    cases = [
+        ('native loader', {'native_loader': True}),
+        ('load(name) per function', {'native_loader': False}),
+    ]
+
+    for name, kwargs in cases:
+        print('%-24s %8.3f ms' % (name, measure(**settings, **kwargs)))
+
+
+if __name__ == '__main__':
+    main()
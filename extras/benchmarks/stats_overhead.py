@@ -0,0 +1,77 @@
+'''
+    Measures the cost of the calls that update Context.stats.
+
+    The counters are always on, the per call cost of small draws and writes
+    includes the increments. Reading and resetting the counters is measured too.
+
+    usage: python stats_overhead.py [calls]
+'''
+
+import sys
+import time
+
+import moderngl
+
+REPEAT = 5
+
+
+def measure(ctx, func, calls):
+    func()
+    ctx.finish()
+    best = None
+    for _ in range(REPEAT):
+        start = time.perf_counter()
+        for _ in range(calls):
+            func()
+        ctx.finish()
+        elapsed = time.perf_counter() - start
+        best = elapsed if best is None else min(best, elapsed)
+    return best / calls * 1e6
+
+
+def main():
+    calls = int(sys.argv[1]) if len(sys.argv) > 1 else 100000
+    ctx = moderngl.create_standalone_context()
+    print('%s / %s' % (ctx.info['GL_RENDERER'], ctx.info['GL_VERSION']))
+    print('calls: %d' % calls)
+
+    prog = ctx.program(
+        vertex_shader='''
+            #version 330
+            in vec2 in_vert;
+            void main() {
+                gl_Position = vec4(in_vert, 0.0, 1.0);
+            }
+        ''',
+        fragment_shader='''
+            #version 330
+            out vec4 color;
+            void main() {
+                color = vec4(1.0);
+            }
+        ''',
+    )
+
+    vbo = ctx.buffer(reserve=24)
+    vao = ctx.simple_vertex_array(prog, vbo, 'in_vert')
+    fbo = ctx.simple_framebuffer((4, 4))
+    fbo.use()
+
+    cases = [
+        ('render 3 vertices', lambda: vao.render(vertices=3)),
+        ('buffer write 4 bytes', lambda: vbo.write(b'\x00' * 4)),
+        ('read stats', lambda: ctx.stats),
+        ('reset stats', ctx.reset_stats),
+    ]
+
+    for name, func in cases:
+        print('%-24s %8.3f us' % (name, measure(ctx, func, calls)))
+
+    ctx.reset_stats()
+    vao.render(vertices=3)
+    stats = ctx.stats
+    print('draw_calls: %d, vertices: %d' % (stats['draw_calls'], stats['vertices']))
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,406 @@
+#pragma once
+
+#include <map>
+#include <tuple>
+
+#include "recorder.hpp"
+
+// A call is redundant when it sets a piece of GL state to the value it already holds.
+// Calls not listed below are never redundant, the state set before the recording is unknown.
+
+enum TraceCallClass {
+    TRACE_UNTRACKED,
+    TRACE_EFFECTIVE,
+    TRACE_REDUNDANT,
+};
+
+// The state the key of a call depends on besides its own arguments.
+
+enum TraceScope {
+    TRACE_SCOPE_NONE,
+    TRACE_SCOPE_UNIT,
+    TRACE_SCOPE_TEXTURE,
+    TRACE_SCOPE_PROGRAM,
+    TRACE_SCOPE_ELEMENT_BUFFER,
+    TRACE_SCOPE_DRAW_FRAMEBUFFER,
+    TRACE_SCOPE_READ_FRAMEBUFFER,
+    TRACE_SCOPE_USE_PROGRAM,
+};
+
+enum TraceEffect {
+    TRACE_EFFECT_NONE,
+    TRACE_EFFECT_ACTIVE_TEXTURE,
+    TRACE_EFFECT_BIND_TEXTURE,
+    TRACE_EFFECT_BIND_BUFFER_INDEXED,
+    TRACE_EFFECT_BIND_FRAMEBUFFER,
+    TRACE_EFFECT_BIND_VERTEX_ARRAY,
+    TRACE_EFFECT_USE_PROGRAM,
+    TRACE_EFFECT_RESET,
+};
+
+// The first keys arguments select the piece of state, the next values arguments and the payload are its value.
+// Calls sharing a slot set the same state, the value of a slot is only equal when it was set by the same call.
+// The related slot holds the indexed or non-indexed variant of the same state, its entries sharing
+// the first prefix keys are forgotten when the call changes the state.
+// Without the payload the value of a call taking a pointer is unknown.
+
+struct TraceStateCall {
+    const char * name;
+    const char * slot;
+    int keys;
+    int values;
+    int scope;
+    int effect;
+    const char * related;
+    int prefix;
+    int payload;
+};
+
+static const TraceStateCall trace_state_calls[] = {
+    {"glActiveTexture", "glActiveTexture", 0, 1, TRACE_SCOPE_NONE, TRACE_EFFECT_ACTIVE_TEXTURE, 0, 0, 0},
+    {"glBindTexture", "glBindTexture", 1, 1, TRACE_SCOPE_UNIT, TRACE_EFFECT_BIND_TEXTURE, 0, 0, 0},
+    {"glBindSampler", "glBindSampler", 1, 1, TRACE_SCOPE_NONE, TRACE_EFFECT_NONE, 0, 0, 0},
+    {"glBindImageTexture", "glBindImageTexture", 1, 6, TRACE_SCOPE_NONE, TRACE_EFFECT_NONE, 0, 0, 0},
+    {"glBindBuffer", "glBindBuffer", 1, 1, TRACE_SCOPE_ELEMENT_BUFFER, TRACE_EFFECT_NONE, 0, 0, 0},
+    {"glBindBufferBase", "glBindBufferBase", 2, 1, TRACE_SCOPE_NONE, TRACE_EFFECT_BIND_BUFFER_INDEXED, 0, 0, 0},
+    {"glBindBufferRange", "glBindBufferBase", 2, 3, TRACE_SCOPE_NONE, TRACE_EFFECT_BIND_BUFFER_INDEXED, 0, 0, 0},
+    {"glBindFramebuffer", "glBindFramebuffer", 1, 1, TRACE_SCOPE_NONE, TRACE_EFFECT_BIND_FRAMEBUFFER, 0, 0, 0},
+    {"glBindRenderbuffer", "glBindRenderbuffer", 1, 1, TRACE_SCOPE_NONE, TRACE_EFFECT_NONE, 0, 0, 0},
+    {"glBindVertexArray", "glBindVertexArray", 0, 1, TRACE_SCOPE_NONE, TRACE_EFFECT_BIND_VERTEX_ARRAY, 0, 0, 0},
+    {"glBindTransformFeedback", "glBindTransformFeedback", 1, 1, TRACE_SCOPE_NONE, TRACE_EFFECT_NONE, 0, 0, 0},
+    {"glBindProgramPipeline", "glBindProgramPipeline", 0, 1, TRACE_SCOPE_NONE, TRACE_EFFECT_NONE, 0, 0, 0},
+    {"glUseProgram", "glUseProgram", 0, 1, TRACE_SCOPE_NONE, TRACE_EFFECT_USE_PROGRAM, 0, 0, 0},
+
+    {"glEnable", "glEnable", 1, 0, TRACE_SCOPE_NONE, TRACE_EFFECT_NONE, "glEnablei", 1, 0},
+    {"glDisable", "glEnable", 1, 0, TRACE_SCOPE_NONE, TRACE_EFFECT_NONE, "glEnablei", 1, 0},
+    {"glEnablei", "glEnablei", 2, 0, TRACE_SCOPE_NONE, TRACE_EFFECT_NONE, "glEnable", 1, 0},
+    {"glDisablei", "glEnablei", 2, 0, TRACE_SCOPE_NONE, TRACE_EFFECT_NONE, "glEnable", 1, 0},
+    {"glBlendFunc", "glBlendFunc", 0, 2, TRACE_SCOPE_NONE, TRACE_EFFECT_NONE, "glBlendFunci", 0, 0},
+    {"glBlendFuncSeparate", "glBlendFunc", 0, 4, TRACE_SCOPE_NONE, TRACE_EFFECT_NONE, "glBlendFunci", 0, 0},
+    {"glBlendFunci", "glBlendFunci", 1, 2, TRACE_SCOPE_NONE, TRACE_EFFECT_NONE, "glBlendFunc", 0, 0},
+    {"glBlendFuncSeparatei", "glBlendFunci", 1, 4, TRACE_SCOPE_NONE, TRACE_EFFECT_NONE, "glBlendFunc", 0, 0},
+    {"glBlendEquation", "glBlendEquation", 0, 1, TRACE_SCOPE_NONE, TRACE_EFFECT_NONE, "glBlendEquationi", 0, 0},
+    {"glBlendEquationSeparate", "glBlendEquation", 0, 2, TRACE_SCOPE_NONE, TRACE_EFFECT_NONE, "glBlendEquationi", 0, 0},
+    {"glBlendEquationi", "glBlendEquationi", 1, 1, TRACE_SCOPE_NONE, TRACE_EFFECT_NONE, "glBlendEquation", 0, 0},
+    {"glBlendEquationSeparatei", "glBlendEquationi", 1, 2, TRACE_SCOPE_NONE, TRACE_EFFECT_NONE, "glBlendEquation", 0, 0},
+    {"glColorMask", "glColorMask", 0, 4, TRACE_SCOPE_NONE, TRACE_EFFECT_NONE, "glColorMaski", 0, 0},
+    {"glColorMaski", "glColorMaski", 1, 4, TRACE_SCOPE_NONE, TRACE_EFFECT_NONE, "glColorMask", 0, 0},
+    {"glBlendColor", "glBlendColor", 0, 4, TRACE_SCOPE_NONE, TRACE_EFFECT_NONE, 0, 0, 0},
+    {"glDepthFunc", "glDepthFunc", 0, 1, TRACE_SCOPE_NONE, TRACE_EFFECT_NONE, 0, 0, 0},
+    {"glDepthMask", "glDepthMask", 0, 1, TRACE_SCOPE_NONE, TRACE_EFFECT_NONE, 0, 0, 0},
+    {"glDepthRange", "glDepthRange", 0, 2, TRACE_SCOPE_NONE, TRACE_EFFECT_NONE, 0, 0, 0},
+    {"glStencilMask", "glStencilMask", 0, 1, TRACE_SCOPE_NONE, TRACE_EFFECT_NONE, 0, 0, 0},
+    {"glStencilFunc", "glStencilFunc", 0, 3, TRACE_SCOPE_NONE, TRACE_EFFECT_NONE, 0, 0, 0},
+    {"glStencilOp", "glStencilOp", 0, 3, TRACE_SCOPE_NONE, TRACE_EFFECT_NONE, 0, 0, 0},
+    {"glCullFace", "glCullFace", 0, 1, TRACE_SCOPE_NONE, TRACE_EFFECT_NONE, 0, 0, 0},
+    {"glFrontFace", "glFrontFace", 0, 1, TRACE_SCOPE_NONE, TRACE_EFFECT_NONE, 0, 0, 0},
+    {"glPolygonMode", "glPolygonMode", 1, 1, TRACE_SCOPE_NONE, TRACE_EFFECT_NONE, 0, 0, 0},
+    {"glPolygonOffset", "glPolygonOffset", 0, 2, TRACE_SCOPE_NONE, TRACE_EFFECT_NONE, 0, 0, 0},
+    {"glViewport", "glViewport", 0, 4, TRACE_SCOPE_NONE, TRACE_EFFECT_NONE, 0, 0, 0},
+    {"glScissor", "glScissor", 0, 4, TRACE_SCOPE_NONE, TRACE_EFFECT_NONE, 0, 0, 0},
+    {"glLineWidth", "glLineWidth", 0, 1, TRACE_SCOPE_NONE, TRACE_EFFECT_NONE, 0, 0, 0},
+    {"glPointSize", "glPointSize", 0, 1, TRACE_SCOPE_NONE, TRACE_EFFECT_NONE, 0, 0, 0},
+    {"glProvokingVertex", "glProvokingVertex", 0, 1, TRACE_SCOPE_NONE, TRACE_EFFECT_NONE, 0, 0, 0},
+    {"glPrimitiveRestartIndex", "glPrimitiveRestartIndex", 0, 1, TRACE_SCOPE_NONE, TRACE_EFFECT_NONE, 0, 0, 0},
+    {"glPatchParameteri", "glPatchParameteri", 1, 1, TRACE_SCOPE_NONE, TRACE_EFFECT_NONE, 0, 0, 0},
+    {"glClampColor", "glClampColor", 1, 1, TRACE_SCOPE_NONE, TRACE_EFFECT_NONE, 0, 0, 0},
+    {"glClearColor", "glClearColor", 0, 4, TRACE_SCOPE_NONE, TRACE_EFFECT_NONE, 0, 0, 0},
+    {"glClearDepth", "glClearDepth", 0, 1, TRACE_SCOPE_NONE, TRACE_EFFECT_NONE, 0, 0, 0},
+    {"glClearStencil", "glClearStencil", 0, 1, TRACE_SCOPE_NONE, TRACE_EFFECT_NONE, 0, 0, 0},
+    {"glPixelStorei", "glPixelStorei", 1, 1, TRACE_SCOPE_NONE, TRACE_EFFECT_NONE, 0, 0, 0},
+    {"glPixelStoref", "glPixelStorei", 1, 1, TRACE_SCOPE_NONE, TRACE_EFFECT_NONE, 0, 0, 0},
+    {"glDrawBuffer", "glDrawBuffer", 0, 1, TRACE_SCOPE_DRAW_FRAMEBUFFER, TRACE_EFFECT_NONE, 0, 0, 0},
+    {"glDrawBuffers", "glDrawBuffer", 0, 1, TRACE_SCOPE_DRAW_FRAMEBUFFER, TRACE_EFFECT_NONE, 0, 0, 1},
+    {"glReadBuffer", "glReadBuffer", 0, 1, TRACE_SCOPE_READ_FRAMEBUFFER, TRACE_EFFECT_NONE, 0, 0, 0},
+
+    {"glTexParameteri", "glTexParameter", 2, 1, TRACE_SCOPE_TEXTURE, TRACE_EFFECT_NONE, 0, 0, 0},
+    {"glTexParameterf", "glTexParameter", 2, 1, TRACE_SCOPE_TEXTURE, TRACE_EFFECT_NONE, 0, 0, 0},
+    {"glTexParameteriv", "glTexParameter", 2, 0, TRACE_SCOPE_TEXTURE, TRACE_EFFECT_NONE, 0, 0, 1},
+    {"glTexParameterfv", "glTexParameter", 2, 0, TRACE_SCOPE_TEXTURE, TRACE_EFFECT_NONE, 0, 0, 1},
+    {"glTexParameterIiv", "glTexParameter", 2, 0, TRACE_SCOPE_TEXTURE, TRACE_EFFECT_NONE, 0, 0, 1},
+    {"glTexParameterIuiv", "glTexParameter", 2, 0, TRACE_SCOPE_TEXTURE, TRACE_EFFECT_NONE, 0, 0, 1},
+    {"glSamplerParameteri", "glSamplerParameter", 2, 1, TRACE_SCOPE_NONE, TRACE_EFFECT_NONE, 0, 0, 0},
+    {"glSamplerParameterf", "glSamplerParameter", 2, 1, TRACE_SCOPE_NONE, TRACE_EFFECT_NONE, 0, 0, 0},
+    {"glSamplerParameteriv", "glSamplerParameter", 2, 0, TRACE_SCOPE_NONE, TRACE_EFFECT_NONE, 0, 0, 1},
+    {"glSamplerParameterfv", "glSamplerParameter", 2, 0, TRACE_SCOPE_NONE, TRACE_EFFECT_NONE, 0, 0, 1},
+    {"glUniformBlockBinding", "glUniformBlockBinding", 2, 1, TRACE_SCOPE_NONE, TRACE_EFFECT_NONE, 0, 0, 0},
+    {"glUniformSubroutinesuiv", "glUniformSubroutinesuiv", 1, 1, TRACE_SCOPE_USE_PROGRAM, TRACE_EFFECT_NONE, 0, 0, 1},
+
+    {"glDeleteBuffers", 0, 0, 0, TRACE_SCOPE_NONE, TRACE_EFFECT_RESET, 0, 0, 0},
+    {"glDeleteTextures", 0, 0, 0, TRACE_SCOPE_NONE, TRACE_EFFECT_RESET, 0, 0, 0},
+    {"glDeleteFramebuffers", 0, 0, 0, TRACE_SCOPE_NONE, TRACE_EFFECT_RESET, 0, 0, 0},
+    {"glDeleteRenderbuffers", 0, 0, 0, TRACE_SCOPE_NONE, TRACE_EFFECT_RESET, 0, 0, 0},
+    {"glDeleteVertexArrays", 0, 0, 0, TRACE_SCOPE_NONE, TRACE_EFFECT_RESET, 0, 0, 0},
+    {"glDeleteSamplers", 0, 0, 0, TRACE_SCOPE_NONE, TRACE_EFFECT_RESET, 0, 0, 0},
+    {"glDeleteTransformFeedbacks", 0, 0, 0, TRACE_SCOPE_NONE, TRACE_EFFECT_RESET, 0, 0, 0},
+    {"glDeleteProgramPipelines", 0, 0, 0, TRACE_SCOPE_NONE, TRACE_EFFECT_RESET, 0, 0, 0},
+    {"glDeleteProgram", 0, 0, 0, TRACE_SCOPE_NONE, TRACE_EFFECT_RESET, 0, 0, 0},
+    {"glLinkProgram", 0, 0, 0, TRACE_SCOPE_NONE, TRACE_EFFECT_RESET, 0, 0, 0},
+    {"glProgramBinary", 0, 0, 0, TRACE_SCOPE_NONE, TRACE_EFFECT_RESET, 0, 0, 0},
+    {"glBindTextures", 0, 0, 0, TRACE_SCOPE_NONE, TRACE_EFFECT_RESET, 0, 0, 0},
+    {"glBindTextureUnit", 0, 0, 0, TRACE_SCOPE_NONE, TRACE_EFFECT_RESET, 0, 0, 0},
+    {"glBindSamplers", 0, 0, 0, TRACE_SCOPE_NONE, TRACE_EFFECT_RESET, 0, 0, 0},
+    {"glBindImageTextures", 0, 0, 0, TRACE_SCOPE_NONE, TRACE_EFFECT_RESET, 0, 0, 0},
+    {"glBindBuffersBase", 0, 0, 0, TRACE_SCOPE_NONE, TRACE_EFFECT_RESET, 0, 0, 0},
+    {"glBindBuffersRange", 0, 0, 0, TRACE_SCOPE_NONE, TRACE_EFFECT_RESET, 0, 0, 0},
+    {0},
+};
+
+#define TRACE_UNKNOWN 0xFFFFFFFFFFFFFFFFULL
+
+struct TraceStateKey {
+    int slot;
+    uint64_t words[3];
+
+    bool operator < (const TraceStateKey & other) const {
+        return std::tie(slot, words[0], words[1], words[2]) < std::tie(other.slot, other.words[0], other.words[1], other.words[2]);
+    }
+};
+
+// The shadow of the GL state of a single thread. The bindings the keys depend on are tracked separately.
+// A deleted object may have been bound, every binding but the active texture unit and the program becomes unknown.
+
+struct TraceShadow {
+    std::map<TraceStateKey, uint64_t> state;
+    std::map<std::pair<uint64_t, uint64_t>, uint64_t> textures;
+    uint64_t unit = TRACE_UNKNOWN;
+    uint64_t program = TRACE_UNKNOWN;
+    uint64_t vertex_array = TRACE_UNKNOWN;
+    uint64_t draw_framebuffer = TRACE_UNKNOWN;
+    uint64_t read_framebuffer = TRACE_UNKNOWN;
+    uint64_t uses = 0;
+
+    void reset() {
+        state.clear();
+        textures.clear();
+        vertex_array = TRACE_UNKNOWN;
+        draw_framebuffer = TRACE_UNKNOWN;
+        read_framebuffer = TRACE_UNKNOWN;
+    }
+};
+
+struct TraceAnalysis {
+    std::vector<TraceStateCall> calls;
+    std::vector<int> slots;
+    std::vector<int> related;
+    int bind_buffer;
+
+    // The uniform calls are described by their names. The glProgramUniform variants take the program
+    // as their first argument, the other variants are scoped by the program in use.
+
+    void init(const char ** names, int num_names) {
+        std::map<std::string, int> slot_ids;
+
+        auto slot_id = [&](const char * slot) {
+            if (!slot) {
+                return -1;
+            }
+            auto it = slot_ids.insert(std::make_pair(std::string(slot), (int)slot_ids.size()));
+            return it.first->second;
+        };
+
+        calls.assign(num_names, TraceStateCall());
+        slots.assign(num_names, -1);
+        related.assign(num_names, -1);
+        bind_buffer = -1;
+
+        for (int i = 0; i < num_names; ++i) {
+            const char * name = names[i];
+
+            for (const TraceStateCall * call = trace_state_calls; call->name; ++call) {
+                if (!strcmp(call->name, name)) {
+                    calls[i] = *call;
+                    slots[i] = slot_id(call->slot);
+                    related[i] = slot_id(call->related);
+                }
+            }
+
+            bool program = !strncmp(name, "glProgramUniform", 16);
+            const char * suffix = program ? name + 16 : !strncmp(name, "glUniform", 9) ? name + 9 : 0;
+
+            if (suffix && (!strncmp(suffix, "Matrix", 6) || (suffix[0] >= '1' && suffix[0] <= '4'))) {
+                bool matrix = !strncmp(suffix, "Matrix", 6);
+                bool vector = name[strlen(name) - 1] == 'v';
+                calls[i].name = name;
+                calls[i].keys = program ? 2 : 1;
+                calls[i].values = matrix ? 2 : vector ? 1 : suffix[0] - '0';
+                calls[i].scope = program ? TRACE_SCOPE_NONE : TRACE_SCOPE_PROGRAM;
+                calls[i].payload = matrix || vector;
+                slots[i] = slot_id("glUniform");
+            }
+
+            if (!strcmp(name, "glBindBuffer")) {
+                bind_buffer = i;
+            }
+        }
+    }
+
+    uint64_t value(int call, const uint64_t * args, int count, const TraceRecord & rec) {
+        uint64_t hash = trace_hash(&call, sizeof(call));
+        hash = trace_hash(args, count * sizeof(uint64_t), hash);
+        if (calls[call].payload) {
+            hash = trace_hash(&rec.payload_hash, sizeof(rec.payload_hash), hash);
+        }
+        return hash;
+    }
+
+    // The key of the state set by the call, false when the state it depends on is unknown.
+
+    bool key(TraceShadow & shadow, const TraceRecord & rec, TraceStateKey & key) {
+        const TraceStateCall & call = calls[rec.call];
+        const uint64_t * args = rec.args;
+        int keys = call.keys;
+        int words = 0;
+
+        key.slot = slots[rec.call];
+        key.words[0] = 0;
+        key.words[1] = 0;
+        key.words[2] = 0;
+
+        switch (call.scope) {
+            case TRACE_SCOPE_UNIT:
+                key.words[words++] = shadow.unit;
+                break;
+
+            case TRACE_SCOPE_TEXTURE: {
+                auto it = shadow.textures.find(std::make_pair(shadow.unit, args[0]));
+                key.words[words++] = it != shadow.textures.end() ? it->second : TRACE_UNKNOWN;
+                args += 1;
+                keys -= 1;
+                break;
+            }
+
+            case TRACE_SCOPE_PROGRAM:
+                key.words[words++] = shadow.program;
+                break;
+
+            case TRACE_SCOPE_ELEMENT_BUFFER:
+                key.words[words++] = args[0] == GL_ELEMENT_ARRAY_BUFFER ? shadow.vertex_array : 0;
+                break;
+
+            case TRACE_SCOPE_DRAW_FRAMEBUFFER:
+                key.words[words++] = shadow.draw_framebuffer;
+                break;
+
+            case TRACE_SCOPE_READ_FRAMEBUFFER:
+                key.words[words++] = shadow.read_framebuffer;
+                break;
+
+            case TRACE_SCOPE_USE_PROGRAM:
+                key.words[words++] = shadow.uses;
+                break;
+        }
+
+        if (words && key.words[0] == TRACE_UNKNOWN) {
+            return false;
+        }
+
+        for (int i = 0; i < keys; ++i) {
+            key.words[words++] = args[i];
+        }
+
+        return true;
+    }
+
+    // Stores the value and returns whether it was already set.
+
+    bool set(TraceShadow & shadow, const TraceStateKey & key, uint64_t value) {
+        auto it = shadow.state.insert(std::make_pair(key, value));
+        if (it.second || it.first->second != value) {
+            it.first->second = value;
+            return false;
+        }
+        return true;
+    }
+
+    void forget_related(TraceShadow & shadow, const TraceRecord & rec) {
+        const TraceStateCall & call = calls[rec.call];
+        TraceStateKey first = {related[rec.call], {0, 0, 0}};
+
+        auto it = shadow.state.lower_bound(first);
+        while (it != shadow.state.end() && it->first.slot == first.slot) {
+            if (call.prefix && it->first.words[0] != rec.args[0]) {
+                ++it;
+                continue;
+            }
+            it = shadow.state.erase(it);
+        }
+    }
+
+    int classify(TraceShadow & shadow, const TraceRecord & rec) {
+        const TraceStateCall & call = calls[rec.call];
+
+        if (!call.name) {
+            return TRACE_UNTRACKED;
+        }
+
+        if (call.effect == TRACE_EFFECT_RESET) {
+            shadow.reset();
+            return TRACE_UNTRACKED;
+        }
+
+        const uint64_t * args = rec.args;
+        uint64_t value = this->value(rec.call, args + call.keys, call.values, rec);
+        bool redundant = false;
+
+        if (call.effect == TRACE_EFFECT_BIND_FRAMEBUFFER && args[0] == GL_FRAMEBUFFER) {
+            TraceStateKey draw = {slots[rec.call], {GL_DRAW_FRAMEBUFFER, 0, 0}};
+            TraceStateKey read = {slots[rec.call], {GL_READ_FRAMEBUFFER, 0, 0}};
+            bool same_draw = set(shadow, draw, value);
+            bool same_read = set(shadow, read, value);
+            redundant = same_draw && same_read;
+        } else {
+            TraceStateKey key;
+            if (!this->key(shadow, rec, key)) {
+                redundant = false;
+            } else if (call.payload && !(rec.flags & TRACE_HAS_PAYLOAD)) {
+                shadow.state.erase(key);
+            } else {
+                redundant = set(shadow, key, value);
+            }
+        }
+
+        if (!redundant && related[rec.call] >= 0) {
+            forget_related(shadow, rec);
+        }
+
+        switch (call.effect) {
+            case TRACE_EFFECT_ACTIVE_TEXTURE:
+                shadow.unit = args[0];
+                break;
+
+            case TRACE_EFFECT_BIND_TEXTURE:
+                if (shadow.unit != TRACE_UNKNOWN) {
+                    shadow.textures[std::make_pair(shadow.unit, args[0])] = args[1];
+                }
+                break;
+
+            case TRACE_EFFECT_BIND_BUFFER_INDEXED:
+                if (bind_buffer >= 0) {
+                    TraceStateKey generic = {slots[bind_buffer], {0, args[0], 0}};
+                    shadow.state[generic] = this->value(bind_buffer, args + 2, 1, rec);
+                }
+                break;
+
+            case TRACE_EFFECT_BIND_FRAMEBUFFER:
+                if (args[0] != GL_READ_FRAMEBUFFER) {
+                    shadow.draw_framebuffer = args[1];
+                }
+                if (args[0] != GL_DRAW_FRAMEBUFFER) {
+                    shadow.read_framebuffer = args[1];
+                }
+                break;
+
+            case TRACE_EFFECT_BIND_VERTEX_ARRAY:
+                shadow.vertex_array = args[0];
+                break;
+
+            case TRACE_EFFECT_USE_PROGRAM:
+                shadow.program = args[0];
+                shadow.uses += 1;
+                break;
+        }
+
+        return redundant ? TRACE_REDUNDANT : TRACE_EFFECTIVE;
+    }
+};
@@ -0,0 +1,53 @@
+'''
+    Prints the redundant GL calls of a trace recorded with gltraces.start(path, sources=True).
+
+    A call is redundant when it sets a piece of GL state to the value it already holds.
+    The state set before the recording started is unknown, the first call setting it is effective.
+    Record with hash_payloads=True to compare the uniforms and the parameters passed by pointer.
+
+    usage: python analyze.py trace [--top 20]
+'''
+
+import argparse
+import collections
+
+import gltraces
+
+
+def report(title, rows, top):
+    rows = sorted(rows, key=lambda row: (-row[1][3], -row[1][1]))[:top]
+
+    print()
+    print('%-60s %8s %10s %10s %12s' % (title, 'calls', 'redundant', 'ms', 'redundant ms'))
+
+    for name, (count, redundant, time, redundant_time) in rows:
+        print('%-60s %8d %10d %10.3f %12.3f' % (name[-60:], count, redundant, time / 1e6, redundant_time / 1e6))
+
+
+def main():
+    parser = argparse.ArgumentParser()
+    parser.add_argument('trace')
+    parser.add_argument('--top', type=int, default=20)
+    args = parser.parse_args()
+
+    result = gltraces.analyze(args.trace)
+    calls = result['calls']
+
+    sources = collections.defaultdict(lambda: [0, 0, 0, 0])
+    for (source, name), stats in result['sites'].items():
+        totals = sources[source or '<unknown>']
+        for i in range(4):
+            totals[i] += stats[i]
+
+    count = sum(stats[0] for stats in calls.values())
+    redundant = sum(stats[1] for stats in calls.values())
+    print('%d calls, %d redundant (%.1f%%)' % (count, redundant, redundant * 100.0 / max(count, 1)))
+
+    report('entry point', calls.items(), args.top)
+    report('source', sources.items(), args.top)
+    report('source / entry point', [('%s %s' % (source or '<unknown>', name), stats)
+                                    for (source, name), stats in result['sites'].items()], args.top)
+
+
+if __name__ == '__main__':
+    main()
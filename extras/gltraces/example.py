@@ -1,15 +1,13 @@
-import moderngl.experimental as mgl
-import gltraces
+import moderngl
 
-ctx = mgl.create_context(standalone=True, debug=True)
+import gltraces
+import gltraces_backend
 
-mglprocs = mgl.glprocs(ctx)
-gltraces.glprocs[:] = mglprocs
-mglprocs[:] = gltraces.gltraces
+ctx = moderngl.create_standalone_context(backend=gltraces_backend.backend())
 
 prog = ctx.program(
     vertex_shader='''
-        #version 130
+        #version 330
 
         in vec2 in_vert;
         out vec2 v_vert;
@@ -22,7 +20,32 @@ prog = ctx.program(
     varyings=['v_vert'],
 )
 
+# Every call is printed as it is issued
 buf = ctx.buffer(reserve=16)
 buf.clear()
+
+# Every call is recorded to a binary trace and printed afterwards
+gltraces.start('example.gltrace', hash_payloads=True)
+gltraces.mark('write')
 buf.write(b'1234')
 print(buf.read())
+gltraces.stop()
+
+gltraces.decode('example.gltrace')
+
+# The captured payloads allow the trace to be replayed with replay.py
+gltraces.start('replay.gltrace', capture_payloads=True)
+for i in range(3):
+    buf.write(b'%4d' % i)
+    buf.read()
+    gltraces.mark('frame')
+gltraces.stop()
+
+# The source lines issuing redundant state changes are reported by analyze.py
+gltraces.start('analyze.gltrace', hash_payloads=True, sources=True)
+for i in range(3):
+    buf.write(b'%4d' % i)
+    buf.read()
+gltraces.stop()
+
+print(gltraces.analyze('analyze.gltrace')['calls'])
@@ -0,0 +1,38 @@
+'''
+    A glcontext backend routing the OpenGL functions of ModernGL through the gltraces wrappers.
+
+    usage:
+        ctx = moderngl.create_standalone_context(backend=gltraces_backend.backend())
+'''
+
+import glcontext
+
+import gltraces
+
+
+class TracedContext:
+    def __init__(self, ctx):
+        self.ctx = ctx
+
+    def load(self, name):
+        return gltraces.hook(name, self.ctx.load(name))
+
+    def __getattr__(self, name):
+        return getattr(self.ctx, name)
+
+
+def backend(name=None):
+    '''
+        Returns a backend factory for the ``backend`` setting of :py:func:`moderngl.create_context`.
+
+        Args:
+            name (str): The glcontext backend to wrap, the default backend is used when not set.
+    '''
+
+    inner = glcontext.get_backend_by_name(name) if name else glcontext.default_backend()
+
+    def create(*args, **kwargs):
+        kwargs.pop('backend', None)
+        return TracedContext(inner(*args, **kwargs))
+
+    return create
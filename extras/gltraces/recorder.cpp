@@ -0,0 +1,117 @@
+#include "recorder.hpp"
+
+TraceRecorder recorder;
+std::atomic<bool> recording(false);
+
+static void write_chunk(uint32_t kind, const void * prefix, uint64_t prefix_size, const void * data, uint64_t size) {
+    TraceChunk chunk = {kind, 0, prefix_size + size};
+    fwrite(&chunk, sizeof(chunk), 1, recorder.file);
+    if (prefix_size) {
+        fwrite(prefix, 1, prefix_size, recorder.file);
+    }
+    fwrite(data, 1, size, recorder.file);
+}
+
+// Drains the rings and the new strings until the recording stops and nothing is left.
+// Consecutive records of a ring are written as a single chunk.
+
+static void writer_main() {
+    std::vector<TraceRing *> rings;
+    std::vector<std::pair<uint64_t, std::string>> strings;
+    std::vector<std::pair<uint64_t, std::string>> payloads;
+
+    while (true) {
+        bool running = recorder.running.load();
+
+        {
+            std::lock_guard<std::mutex> lock(recorder.mutex);
+            rings = recorder.rings;
+            strings.swap(recorder.pending_strings);
+            payloads.swap(recorder.pending_payloads);
+        }
+
+        for (auto & it : strings) {
+            write_chunk(TRACE_CHUNK_STRING, &it.first, sizeof(it.first), it.second.data(), it.second.size());
+        }
+
+        for (auto & it : payloads) {
+            write_chunk(TRACE_CHUNK_PAYLOAD, &it.first, sizeof(it.first), it.second.data(), it.second.size());
+        }
+
+        uint64_t drained = strings.size() + payloads.size();
+        strings.clear();
+        payloads.clear();
+
+        for (TraceRing * ring : rings) {
+            uint64_t head = ring->head.load(std::memory_order_acquire);
+            uint64_t tail = ring->tail.load(std::memory_order_relaxed);
+
+            while (tail != head) {
+                uint64_t start = tail & ring->mask;
+                uint64_t count = head - tail < ring->mask + 1 - start ? head - tail : ring->mask + 1 - start;
+                write_chunk(TRACE_CHUNK_RECORDS, 0, 0, ring->records + start, count * sizeof(TraceRecord));
+                tail += count;
+                drained += count;
+                recorder.records += count;
+                ring->tail.store(tail, std::memory_order_release);
+            }
+        }
+
+        if (!drained) {
+            if (!running) {
+                break;
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    }
+}
+
+bool trace_start(const char * path, uint64_t ring_size, bool hash_payloads, bool capture_payloads, uint64_t (* source)(), uint32_t num_functions) {
+    recorder.file = fopen(path, "wb");
+    if (!recorder.file) {
+        return false;
+    }
+
+    uint32_t flags = capture_payloads ? TRACE_CAPTURED_PAYLOADS : 0;
+    TraceHeader header = {{'G', 'L', 'T', 'R', 'A', 'C', 'E', 0}, TRACE_VERSION, sizeof(TraceRecord), num_functions, flags};
+    fwrite(&header, sizeof(header), 1, recorder.file);
+
+    recorder.origin = std::chrono::steady_clock::now();
+    recorder.source = source;
+    recorder.session += 1;
+    recorder.ring_size = ring_size;
+    recorder.records = 0;
+    recorder.hash_payloads = hash_payloads || capture_payloads;
+    recorder.capture_payloads = capture_payloads;
+    recorder.unpack_alignment = 4;
+    recorder.unpack_buffer = 0;
+    recorder.strings.clear();
+    recorder.pending_strings.clear();
+    recorder.payloads.clear();
+    recorder.pending_payloads.clear();
+    recorder.mapped.clear();
+
+    recorder.running = true;
+    recorder.writer = std::thread(writer_main);
+    recording = true;
+    return true;
+}
+
+// Calls issued by other threads while stopping may be lost, stop the recording from the rendering thread.
+
+uint64_t trace_stop() {
+    recording = false;
+    recorder.running = false;
+    recorder.writer.join();
+
+    fclose(recorder.file);
+    recorder.file = 0;
+
+    for (TraceRing * ring : recorder.rings) {
+        delete[] ring->records;
+        delete ring;
+    }
+
+    recorder.rings.clear();
+    return recorder.records;
+}
@@ -0,0 +1,351 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "moderngl/src/OpenGL.hpp"
+
+// Binary trace file layout:
+//
+//   TraceHeader
+//   TraceChunk + payload
+//   TraceChunk + payload
+//   ...
+//
+// Record chunks hold an array of TraceRecords in the order they were issued by a single thread.
+// Chunks of different threads are interleaved, records carry the index of their thread.
+// String chunks hold a uint64_t id followed by the characters, a string may follow the records using it.
+// Payload chunks hold the payload hash followed by the bytes, they are only written when payloads are captured.
+
+#define TRACE_VERSION 2
+#define TRACE_MAX_ARGS 16
+
+enum TraceChunkKind {
+    TRACE_CHUNK_RECORDS = 1,
+    TRACE_CHUNK_STRING = 2,
+    TRACE_CHUNK_PAYLOAD = 3,
+};
+
+enum TraceHeaderFlags {
+    TRACE_CAPTURED_PAYLOADS = 1,
+};
+
+enum TraceRecordFlags {
+    TRACE_HAS_PAYLOAD = 1,
+};
+
+// The call of a record is an index into the names table or one of the following.
+
+enum TraceSpecialCall {
+    TRACE_MARK = 0xFFFF,
+};
+
+struct TraceHeader {
+    char magic[8];
+    uint32_t version;
+    uint32_t record_size;
+    uint32_t num_functions;
+    uint32_t flags;
+};
+
+struct TraceChunk {
+    uint32_t kind;
+    uint32_t reserved;
+    uint64_t size;
+};
+
+// The arguments and the result are stored as their raw bits.
+// The payload hash covers the memory behind the data pointer of uploads, the strings passed by pointer
+// and the object names passed in or returned by arrays.
+// The source is the string id of the "file:line" issuing the call, zero when sources are not recorded.
+
+struct TraceRecord {
+    uint16_t call;
+    uint16_t thread;
+    uint32_t flags;
+    uint64_t timestamp;
+    uint64_t duration;
+    uint64_t result;
+    uint64_t payload_hash;
+    uint64_t payload_size;
+    uint64_t source;
+    uint64_t args[TRACE_MAX_ARGS];
+};
+
+// Single producer, single consumer ring. Only the owner thread writes records,
+// only the writer thread moves the tail.
+
+struct TraceRing {
+    TraceRecord * records;
+    uint64_t mask;
+    uint16_t thread;
+    std::atomic<uint64_t> head;
+    std::atomic<uint64_t> tail;
+};
+
+struct TraceRecorder {
+    FILE * file;
+    std::thread writer;
+    std::atomic<bool> running;
+    std::mutex mutex;
+    std::vector<TraceRing *> rings;
+    std::vector<std::pair<uint64_t, std::string>> pending_strings;
+    std::unordered_map<std::string, uint64_t> strings;
+    std::vector<std::pair<uint64_t, std::string>> pending_payloads;
+    std::unordered_set<uint64_t> payloads;
+    std::chrono::steady_clock::time_point origin;
+    uint64_t (* source)();
+    uint64_t session;
+    uint64_t ring_size;
+    uint64_t records;
+    bool hash_payloads;
+    bool capture_payloads;
+    int unpack_alignment;
+    unsigned unpack_buffer;
+    std::unordered_map<GLenum, std::pair<void *, uint64_t>> mapped;
+};
+
+extern TraceRecorder recorder;
+extern std::atomic<bool> recording;
+
+bool trace_start(const char * path, uint64_t ring_size, bool hash_payloads, bool capture_payloads, uint64_t (* source)(), uint32_t num_functions);
+uint64_t trace_stop();
+
+template <typename T>
+inline uint64_t trace_pack(T value) {
+    static_assert(sizeof(T) <= sizeof(uint64_t), "argument too large");
+    uint64_t bits = 0;
+    memcpy(&bits, &value, sizeof(T));
+    return bits;
+}
+
+template <typename T>
+inline T trace_unpack(uint64_t bits) {
+    T value;
+    memcpy(&value, &bits, sizeof(T));
+    return value;
+}
+
+inline uint64_t trace_now() {
+    return (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now() - recorder.origin
+    ).count();
+}
+
+// The ring of the calling thread, a new one is registered on the first call of every session.
+
+inline TraceRing * trace_ring() {
+    thread_local TraceRing * ring = 0;
+    thread_local uint64_t session = 0;
+
+    if (session != recorder.session) {
+        std::lock_guard<std::mutex> lock(recorder.mutex);
+        ring = new TraceRing;
+        ring->records = new TraceRecord[recorder.ring_size];
+        ring->mask = recorder.ring_size - 1;
+        ring->thread = (uint16_t)recorder.rings.size();
+        ring->head = 0;
+        ring->tail = 0;
+        recorder.rings.push_back(ring);
+        session = recorder.session;
+    }
+
+    return ring;
+}
+
+// Returns the next free record of the calling thread. When the writer falls behind
+// the caller waits for it rather than dropping records. The source is looked up before the call is timed.
+
+inline TraceRecord * trace_begin(uint16_t call) {
+    TraceRing * ring = trace_ring();
+    uint64_t head = ring->head.load(std::memory_order_relaxed);
+
+    while (head - ring->tail.load(std::memory_order_acquire) > ring->mask) {
+        std::this_thread::yield();
+    }
+
+    TraceRecord * rec = &ring->records[head & ring->mask];
+    rec->call = call;
+    rec->thread = ring->thread;
+    rec->flags = 0;
+    rec->result = 0;
+    rec->payload_hash = 0;
+    rec->payload_size = 0;
+    rec->source = recorder.source ? recorder.source() : 0;
+    rec->timestamp = trace_now();
+    return rec;
+}
+
+inline void trace_end(TraceRecord * rec) {
+    rec->duration = trace_now() - rec->timestamp;
+}
+
+// Publishes the record to the writer, the payload is hashed between trace_end and trace_commit.
+
+inline void trace_commit() {
+    TraceRing * ring = trace_ring();
+    ring->head.store(ring->head.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+}
+
+// FNV-1a over 8 byte words, the tail is hashed byte by byte.
+
+inline uint64_t trace_hash(const void * data, uint64_t size, uint64_t hash = 0xcbf29ce484222325ULL) {
+    const unsigned char * ptr = (const unsigned char *)data;
+
+    for (; size >= 8; size -= 8, ptr += 8) {
+        uint64_t word;
+        memcpy(&word, ptr, 8);
+        hash = (hash ^ word) * 0x100000001b3ULL;
+    }
+
+    for (; size; --size, ++ptr) {
+        hash = (hash ^ *ptr) * 0x100000001b3ULL;
+    }
+
+    return hash;
+}
+
+inline void trace_payload(TraceRecord * rec, const void * data, uint64_t size) {
+    if (!recorder.hash_payloads || !data || !size) {
+        return;
+    }
+
+    rec->flags |= TRACE_HAS_PAYLOAD;
+    rec->payload_hash = trace_hash(data, size);
+    rec->payload_size = size;
+
+    // Payloads are written once per session, the copy is made before the caller can modify the memory.
+
+    if (recorder.capture_payloads) {
+        std::lock_guard<std::mutex> lock(recorder.mutex);
+        if (recorder.payloads.insert(rec->payload_hash).second) {
+            recorder.pending_payloads.push_back(std::make_pair(rec->payload_hash, std::string((const char *)data, size)));
+        }
+    }
+}
+
+inline void trace_string_payload(TraceRecord * rec, const GLchar * str) {
+    trace_payload(rec, str, str ? strlen(str) + 1 : 0);
+}
+
+// Arrays of strings are stored as consecutive null terminated strings.
+
+inline void trace_strings_payload(TraceRecord * rec, GLsizei count, const GLchar * const * strings) {
+    if (!recorder.hash_payloads) {
+        return;
+    }
+
+    std::string joined;
+    for (int i = 0; i < count; ++i) {
+        joined.append(strings[i], strlen(strings[i]) + 1);
+    }
+
+    trace_payload(rec, joined.data(), joined.size());
+}
+
+// The shader source is stored as the concatenation of its strings.
+
+inline void trace_source_payload(TraceRecord * rec, GLsizei count, const GLchar * const * string, const GLint * length) {
+    if (!recorder.hash_payloads) {
+        return;
+    }
+
+    std::string source;
+    for (int i = 0; i < count; ++i) {
+        source.append(string[i], length && length[i] >= 0 ? length[i] : strlen(string[i]));
+    }
+
+    trace_payload(rec, source.data(), source.size());
+}
+
+// Pixel uploads read from a bound pixel unpack buffer are offsets, not host memory.
+// Only the alignment of the unpack state is tracked, ModernGL does not set the other parameters.
+
+inline int trace_pixel_size(GLenum format, GLenum type) {
+    int components = 4;
+    switch (format) {
+        case GL_RED: case GL_GREEN: case GL_BLUE: case GL_ALPHA:
+        case GL_RED_INTEGER: case GL_GREEN_INTEGER: case GL_BLUE_INTEGER:
+        case GL_DEPTH_COMPONENT: case GL_STENCIL_INDEX: components = 1; break;
+        case GL_RG: case GL_RG_INTEGER: case GL_DEPTH_STENCIL: components = 2; break;
+        case GL_RGB: case GL_BGR: case GL_RGB_INTEGER: case GL_BGR_INTEGER: components = 3; break;
+    }
+
+    switch (type) {
+        case GL_UNSIGNED_BYTE: case GL_BYTE: return components;
+        case GL_UNSIGNED_SHORT: case GL_SHORT: case GL_HALF_FLOAT: return components * 2;
+        case GL_UNSIGNED_INT: case GL_INT: case GL_FLOAT: return components * 4;
+        case GL_UNSIGNED_BYTE_3_3_2: case GL_UNSIGNED_BYTE_2_3_3_REV: return 1;
+        case GL_FLOAT_32_UNSIGNED_INT_24_8_REV: return 8;
+        case GL_UNSIGNED_SHORT_5_6_5: case GL_UNSIGNED_SHORT_5_6_5_REV:
+        case GL_UNSIGNED_SHORT_4_4_4_4: case GL_UNSIGNED_SHORT_4_4_4_4_REV:
+        case GL_UNSIGNED_SHORT_5_5_5_1: case GL_UNSIGNED_SHORT_1_5_5_5_REV: return 2;
+        default: return 4;
+    }
+}
+
+inline uint64_t trace_image_size(int width, int height, int depth, GLenum format, GLenum type, int alignment) {
+    uint64_t stride = ((uint64_t)width * trace_pixel_size(format, type) + alignment - 1) / alignment * alignment;
+    return stride * height * depth;
+}
+
+inline void trace_image_payload(TraceRecord * rec, int width, int height, int depth, GLenum format, GLenum type, const void * pixels) {
+    if (recorder.unpack_buffer) {
+        return;
+    }
+
+    trace_payload(rec, pixels, trace_image_size(width, height, depth, format, type, recorder.unpack_alignment));
+}
+
+inline void trace_pixel_store(GLenum pname, GLint param) {
+    if (pname == GL_UNPACK_ALIGNMENT) {
+        recorder.unpack_alignment = param;
+    }
+}
+
+inline void trace_bind_buffer(GLenum target, GLuint buffer) {
+    if (target == GL_PIXEL_UNPACK_BUFFER) {
+        recorder.unpack_buffer = buffer;
+    }
+}
+
+// The memory written through a mapping is stored when the buffer is unmapped.
+
+inline void trace_map_buffer(GLenum target, void * ptr, GLsizeiptr length, GLbitfield access) {
+    if (ptr && (access & GL_MAP_WRITE_BIT)) {
+        recorder.mapped[target] = std::make_pair(ptr, (uint64_t)length);
+    }
+}
+
+inline void trace_unmap_payload(TraceRecord * rec, GLenum target) {
+    auto it = recorder.mapped.find(target);
+    if (it != recorder.mapped.end()) {
+        trace_payload(rec, it->second.first, it->second.second);
+        recorder.mapped.erase(it);
+    }
+}
+
+// Strings are written once per session and referenced by their id.
+
+inline uint64_t trace_string(const char * str) {
+    std::lock_guard<std::mutex> lock(recorder.mutex);
+
+    auto it = recorder.strings.find(str);
+    if (it != recorder.strings.end()) {
+        return it->second;
+    }
+
+    uint64_t id = recorder.strings.size() + 1;
+    recorder.strings[str] = id;
+    recorder.pending_strings.push_back(std::make_pair(id, std::string(str)));
+    return id;
+}
@@ -0,0 +1,246 @@
+#pragma once
+
+#include <map>
+
+#include "recorder.hpp"
+#include "moderngl/src/gl_methods.hpp"
+
+extern GLMethods gl;
+
+// A binary trace loaded into memory. The records are copied out one by one,
+// the chunks are not aligned in the file.
+
+struct TraceFile {
+    std::vector<char> data;
+    TraceHeader header;
+    std::unordered_map<uint64_t, std::string> strings;
+    std::unordered_map<uint64_t, std::pair<size_t, size_t>> payloads;
+    std::vector<std::pair<size_t, size_t>> chunks;
+
+    bool load(const char * path) {
+        FILE * file = fopen(path, "rb");
+        if (!file) {
+            return false;
+        }
+
+        char buffer[65536];
+        while (size_t size = fread(buffer, 1, sizeof(buffer), file)) {
+            data.insert(data.end(), buffer, buffer + size);
+        }
+
+        fclose(file);
+
+        memset(&header, 0, sizeof(header));
+        if (data.size() >= sizeof(header)) {
+            memcpy(&header, data.data(), sizeof(header));
+        }
+
+        size_t offset = sizeof(header);
+        while (offset + sizeof(TraceChunk) <= data.size()) {
+            TraceChunk chunk;
+            memcpy(&chunk, data.data() + offset, sizeof(chunk));
+            offset += sizeof(chunk);
+
+            if (chunk.size > data.size() - offset) {
+                break;
+            }
+
+            if (chunk.kind == TRACE_CHUNK_STRING && chunk.size >= sizeof(uint64_t)) {
+                uint64_t id;
+                memcpy(&id, data.data() + offset, sizeof(id));
+                strings[id] = std::string(data.data() + offset + sizeof(id), chunk.size - sizeof(id));
+            }
+
+            if (chunk.kind == TRACE_CHUNK_PAYLOAD && chunk.size >= sizeof(uint64_t)) {
+                uint64_t hash;
+                memcpy(&hash, data.data() + offset, sizeof(hash));
+                payloads[hash] = std::make_pair(offset + sizeof(hash), (size_t)chunk.size - sizeof(hash));
+            }
+
+            if (chunk.kind == TRACE_CHUNK_RECORDS) {
+                chunks.push_back(std::make_pair(offset, (size_t)chunk.size / sizeof(TraceRecord)));
+            }
+
+            offset += chunk.size;
+        }
+
+        return true;
+    }
+
+    bool compatible(int num_functions) {
+        bool valid = !memcmp(header.magic, "GLTRACE", 8) && header.version == TRACE_VERSION;
+        return valid && header.record_size == sizeof(TraceRecord) && (int)header.num_functions == num_functions;
+    }
+
+    template <typename F>
+    void each(F callback) {
+        for (auto & chunk : chunks) {
+            for (size_t i = 0; i < chunk.second; ++i) {
+                TraceRecord rec;
+                memcpy(&rec, data.data() + chunk.first + i * sizeof(TraceRecord), sizeof(rec));
+                callback(rec);
+            }
+        }
+    }
+};
+
+enum TraceObjectKind {
+    TRACE_BUFFER,
+    TRACE_TEXTURE,
+    TRACE_PROGRAM,
+    TRACE_FRAMEBUFFER,
+    TRACE_RENDERBUFFER,
+    TRACE_SAMPLER,
+    TRACE_VERTEX_ARRAY,
+    TRACE_QUERY,
+    TRACE_PIPELINE,
+    TRACE_TRANSFORM_FEEDBACK,
+    TRACE_NUM_KINDS,
+};
+
+// Maps the captured object names, uniform locations and attribute indices to the live ones.
+// Unknown names are passed as they were captured, the default framebuffer keeps its name.
+
+struct TraceReplay {
+    TraceFile * file;
+    std::unordered_map<GLuint, GLuint> names[TRACE_NUM_KINDS];
+    std::unordered_map<uint64_t, GLsync> syncs;
+    std::map<std::pair<GLuint, GLint>, GLint> locations;
+    std::map<std::pair<GLuint, GLuint>, GLuint> blocks;
+    std::unordered_map<GLuint, GLuint> attributes;
+    std::unordered_map<GLenum, void *> mapped;
+    std::vector<GLuint> live_names;
+    std::vector<const GLchar *> live_strings;
+    std::vector<char> scratch;
+    GLuint program;
+    GLuint pack_buffer;
+    int pack_alignment;
+
+    GLuint name(int kind, GLuint captured) {
+        auto it = names[kind].find(captured);
+        return it != names[kind].end() ? it->second : captured;
+    }
+
+    GLsync sync(GLsync captured) {
+        auto it = syncs.find(trace_pack(captured));
+        return it != syncs.end() ? it->second : 0;
+    }
+
+    GLint location(GLuint live_program, GLint captured) {
+        auto it = locations.find(std::make_pair(live_program, captured));
+        return it != locations.end() ? it->second : captured;
+    }
+
+    GLuint block(GLuint live_program, GLuint captured) {
+        auto it = blocks.find(std::make_pair(live_program, captured));
+        return it != blocks.end() ? it->second : captured;
+    }
+
+    GLuint attribute(GLuint captured) {
+        auto it = attributes.find(captured);
+        return it != attributes.end() ? it->second : captured;
+    }
+
+    // The captured bytes of the record or the raw pointer when nothing was captured.
+    // Without a payload the pointer is either null or an offset into a bound buffer.
+
+    template <typename T>
+    T input(const TraceRecord * rec, T raw) {
+        if (!(rec->flags & TRACE_HAS_PAYLOAD)) {
+            return raw;
+        }
+
+        auto it = file->payloads.find(rec->payload_hash);
+        if (it == file->payloads.end()) {
+            return raw;
+        }
+
+        return (T)(file->data.data() + it->second.first);
+    }
+
+    const GLuint * input_names(int kind, const TraceRecord * rec, GLsizei count) {
+        const GLuint * captured = input(rec, (const GLuint *)0);
+        live_names.resize(count > 0 ? count : 0);
+
+        for (int i = 0; i < count; ++i) {
+            live_names[i] = captured ? name(kind, captured[i]) : 0;
+        }
+
+        return live_names.data();
+    }
+
+    GLuint * output_names(GLsizei count) {
+        live_names.assign(count > 0 ? count : 0, 0);
+        return live_names.data();
+    }
+
+    void bind_names(int kind, const TraceRecord * rec, GLsizei count) {
+        const GLuint * captured = input(rec, (const GLuint *)0);
+
+        for (int i = 0; captured && i < count; ++i) {
+            names[kind][captured[i]] = live_names[i];
+        }
+    }
+
+    // The strings of a record are stored as consecutive null terminated strings.
+
+    const GLchar * const * input_strings(const TraceRecord * rec, GLsizei count) {
+        const GLchar * str = input(rec, (const GLchar *)0);
+        live_strings.resize(count > 0 ? count : 0);
+
+        for (int i = 0; i < count; ++i) {
+            live_strings[i] = str ? str : "";
+            str = str ? str + strlen(str) + 1 : 0;
+        }
+
+        return live_strings.data();
+    }
+
+    // The results read back by the replay are discarded.
+
+    void * output(uint64_t size) {
+        if (scratch.size() < size) {
+            scratch.resize(size);
+        }
+
+        return scratch.data();
+    }
+
+    void * output_image(int width, int height, int depth, GLenum format, GLenum type, void * raw) {
+        if (pack_buffer) {
+            return raw;
+        }
+
+        return output(trace_image_size(width, height, depth, format, type, pack_alignment));
+    }
+
+    void * output_texture(GLenum target, GLint level, GLenum format, GLenum type, void * raw) {
+        if (pack_buffer) {
+            return raw;
+        }
+
+        int width = 0;
+        int height = 0;
+        int depth = 0;
+
+        GLenum face = target == GL_TEXTURE_CUBE_MAP ? GL_TEXTURE_CUBE_MAP_POSITIVE_X : target;
+        gl.GetTexLevelParameteriv(face, level, GL_TEXTURE_WIDTH, &width);
+        gl.GetTexLevelParameteriv(face, level, GL_TEXTURE_HEIGHT, &height);
+        gl.GetTexLevelParameteriv(face, level, GL_TEXTURE_DEPTH, &depth);
+
+        return output(trace_image_size(width, height, depth * (target == GL_TEXTURE_CUBE_MAP ? 6 : 1), format, type, pack_alignment));
+    }
+
+    // The bytes written through a mapping are copied in before the buffer is unmapped.
+
+    void unmap(const TraceRecord * rec, GLenum target) {
+        auto it = mapped.find(target);
+        const char * data = input(rec, (const char *)0);
+
+        if (it != mapped.end() && it->second && data) {
+            memcpy(it->second, data, rec->payload_size);
+        }
+
+        mapped.erase(target);
+    }
+};
@@ -0,0 +1,65 @@
+'''
+    Replays a trace recorded with gltraces.start(path, capture_payloads=True) on a new
+    standalone context and prints the per-frame and per-call timings.
+
+    Frames are delimited by gltraces.mark('frame'). Start the recording right after the
+    context is created, objects created before the recording cannot be replayed.
+    Calls passing arrays of pointers, debug callbacks and multi-draws are skipped.
+
+    On Mesa llvmpipe: LIBGL_ALWAYS_SOFTWARE=1 python replay.py trace.gltrace --backend egl
+
+    usage: python replay.py trace [--backend name] [--marker frame] [--repeat 3] [--top 20]
+'''
+
+import argparse
+
+import moderngl
+
+import gltraces
+import gltraces_backend
+
+
+def replay(path, backend, marker):
+    ctx = moderngl.create_standalone_context(backend=gltraces_backend.backend(backend))
+    renderer = '%s / %s' % (ctx.info['GL_RENDERER'], ctx.info['GL_VERSION'])
+    result = gltraces.replay(path, frame_marker=marker)
+    ctx.release()
+    return renderer, result
+
+
+def main():
+    parser = argparse.ArgumentParser()
+    parser.add_argument('trace')
+    parser.add_argument('--backend', default=None)
+    parser.add_argument('--marker', default='frame')
+    parser.add_argument('--repeat', type=int, default=3)
+    parser.add_argument('--top', type=int, default=20)
+    args = parser.parse_args()
+
+    runs = [replay(args.trace, args.backend, args.marker) for _ in range(args.repeat)]
+    renderer = runs[0][0]
+    results = [result for _, result in runs]
+
+    print(renderer)
+    print()
+    print('%-8s %12s %12s' % ('frame', 'replay ms', 'captured ms'))
+
+    for i, frames in enumerate(zip(*[result['frames'] for result in results])):
+        best = min(replay_ns for replay_ns, _ in frames)
+        print('%-8d %12.3f %12.3f' % (i, best / 1e6, frames[0][1] / 1e6))
+
+    calls = results[-1]['calls']
+    print()
+    print('%-40s %8s %12s %12s' % ('call', 'count', 'replay ms', 'captured ms'))
+
+    for name, (count, replay_ns, captured_ns) in sorted(calls.items(), key=lambda x: -x[1][1])[:args.top]:
+        print('%-40s %8d %12.3f %12.3f' % (name, count, replay_ns / 1e6, captured_ns / 1e6))
+
+    skipped = results[-1]['skipped']
+    if skipped:
+        print()
+        print('skipped: %s' % ', '.join('%s x%d' % item for item in sorted(skipped.items())))
+
+
+if __name__ == '__main__':
+    main()
@@ -24,7 +24,7 @@ libraries = {
 
 sources = [
     'gltraces.cpp',
-    '../../moderngl/mgl/internal/opengl/gl_methods.cpp',
+    'recorder.cpp',
 ]
 
 gltraces = Extension(
@@ -32,10 +32,12 @@ gltraces = Extension(
     sources=sources,
     libraries=libraries[target],
     include_dirs=['../..'],
+    depends=['recorder.hpp', 'replay.hpp', 'analyze.hpp'],
 )
 
 setup(
     name='gltraces',
     version='6.0.0',
     ext_modules=[gltraces],
+    py_modules=['gltraces_backend'],
 )
@@ -4,19 +4,27 @@
 
 from .error import *
 from .buffer import *
+from .command_list import *
 from .compute_shader import *
 from .conditional_render import *
 from .context import *
 from .framebuffer import *
 from .program import *
 from .program_members import *
+from .program_cache import *
+from .profiler import *
 from .query import *
+from .query_pool import *
+from .readback import *
 from .renderbuffer import *
 from .scope import *
+from .stream_buffer import *
 from .texture import *
 from .texture_3d import *
 from .texture_array import *
 from .texture_cube import *
+from .tiled_framebuffer import *
+from .upload_queue import *
 from .vertex_array import *
 from .sampler import *
 
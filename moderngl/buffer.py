@@ -19,12 +19,14 @@ class Buffer:
         Copy buffer content using :py:meth:`Context.copy_buffer`.
     '''
 
-    __slots__ = ['mglo', '_size', '_dynamic', '_glo', 'ctx', 'extra']
+    __slots__ = ['mglo', '_size', '_dynamic', '_persistent', '_mapping', '_glo', 'ctx', 'extra']
 
     def __init__(self):
         self.mglo = None  #: Internal representation for debug purposes only.
         self._size = None  #: Original buffer size during creation
         self._dynamic = None
+        self._persistent = None
+        self._mapping = None
         self._glo = None
         self.ctx = None  #: The context this object belongs to
         self.extra = None  #: Any - Attribute for storing user defined objects
@@ -63,6 +65,39 @@ class Buffer:
 
         return self._dynamic
 
+    @property
+    def persistent(self) -> bool:
+        '''
+            bool: Is the buffer persistently mapped?
+        '''
+
+        return self._persistent
+
+    @property
+    def mapping(self) -> memoryview:
+        '''
+            memoryview: Writable view of a persistent buffer's memory.
+
+            The view stays valid until the buffer is released. Releasing the buffer
+            raises :py:exc:`BufferError` while views of the mapping are still alive.
+            The mapping is coherent but not synchronized with the GPU,
+            it is the caller's responsibility not to modify memory
+            that is still used by previously issued commands.
+
+            .. code-block:: python
+
+                >>> vbo = ctx.buffer(reserve=1024, persistent=True)
+                >>> vbo.mapping[0:4] = struct.pack('f', 1.0)
+        '''
+
+        if not self._persistent:
+            raise ValueError('the buffer is not persistent')
+
+        if self._mapping is None:
+            self._mapping = memoryview(self.mglo)
+
+        return self._mapping
+
     @property
     def glo(self) -> int:
         '''
@@ -116,6 +151,49 @@ class Buffer:
 
         return self.mglo.read(size, offset)
 
+    def view(self, offset=0, size=-1, dtype='u1', shape=None, access='r', *,
+             invalidate=False, unsynchronized=False) -> memoryview:
+        '''
+            Map a range of the buffer and expose it as a typed memoryview.
+
+            Only the requested range is mapped with the requested access.
+            The memoryview reports the format, shape and strides so numpy can
+            wrap it without copies. The range is unmapped when the memoryview
+            and every object exported from it are released.
+
+            Views can be nested as long as the inner view is inside the range of the
+            outer view and does not need more access. The buffer cannot be written
+            or read with the other methods while it is mapped. Releasing it raises
+            :py:exc:`BufferError` until every view is released.
+
+            .. code-block:: python
+
+                with vbo.view(dtype='f4', shape=(-1, 3), access='w', invalidate=True) as mem:
+                    np.asarray(mem)[:] = vertices
+
+            Args:
+                offset (int): The offset in bytes.
+                size (int): The size in bytes. By default the size of the shape or the rest of the buffer.
+                dtype (str): The data type. ``'f2'``, ``'f4'``, ``'f8'``,
+                             ``'u1'``, ``'u2'``, ``'u4'``, ``'u8'``,
+                             ``'i1'``, ``'i2'``, ``'i4'`` or ``'i8'``.
+                shape (tuple): The shape of the view. One dimension can be ``-1``.
+                access (str): ``'r'``, ``'w'`` or ``'rw'``.
+
+            Keyword Args:
+                invalidate (bool): Discard the previous content of the range. Requires ``access='w'``.
+                unsynchronized (bool): Do not wait for the GPU to finish using the buffer.
+                                       Requires ``access='w'``.
+
+            Returns:
+                memoryview
+        '''
+
+        if shape is not None:
+            shape = tuple(shape)
+
+        return memoryview(self.mglo.view(offset, size, dtype, shape, access, invalidate, unsynchronized))
+
     def read_into(self, buffer, size=-1, *, offset=0, write_offset=0) -> None:
         '''
             Read the content into a buffer.
@@ -174,6 +252,10 @@ class Buffer:
         '''
             Clear the content.
 
+            The buffer is cleared with ``glClearBufferSubData`` when available and
+            the chunk is empty or 1, 2, 4, 8, 12 or 16 bytes long and the offset is
+            a multiple of its length. Otherwise the range is filled through a mapping.
+
             Args:
                 size (int): The size. Value ``-1`` means all.
 
@@ -270,6 +352,7 @@ class Buffer:
         '''
         LOG.debug(f"{self.__class__.__name__}.release() {self}")
         if not isinstance(self.mglo, InvalidObject):
+            self._mapping = None
             self.mglo.release()
 
     def bind(self, *attribs, layout=None):
@@ -0,0 +1,308 @@
+import logging
+
+from moderngl.mgl import InvalidObject  # type: ignore
+
+__all__ = ['CommandList']
+
+LOG = logging.getLogger(__name__)
+
+
+class CommandList:
+    '''
+        A recorded sequence of rendering commands replayed with a single call.
+
+        Recording resolves the OpenGL objects and stores the parameters in a compact
+        command array. :py:meth:`CommandList.execute` replays the commands without
+        returning to python. The commands go through the state cache of the context
+        just like the regular methods.
+
+        Recording methods return the index of the command. Uniform commands and buffer
+        binding commands can be patched between executions with
+        :py:meth:`CommandList.write_uniform` and :py:meth:`CommandList.set_offset`.
+
+        The recorded objects are kept alive by the command list.
+        Executing a command list referencing a released object raises an error.
+
+        A CommandList object cannot be instantiated directly, it requires a context.
+        Use :py:meth:`Context.command_list` to create one.
+    '''
+
+    __slots__ = ['mglo', '_objects', 'ctx', 'extra']
+
+    def __init__(self):
+        self.mglo = None  #: Internal representation for debug purposes only.
+        self._objects = None
+        self.ctx = None  #: The context this object belongs to
+        self.extra = None  #: Any - Attribute for storing user defined objects
+        raise TypeError()
+
+    def __repr__(self):
+        return '<CommandList: %d>' % self.size
+
+    def __hash__(self) -> int:
+        return id(self)
+
+    def __del__(self):
+        LOG.debug(f"{self.__class__.__name__}.__del__ {self}")
+        if hasattr(self, "ctx") and self.ctx.gc_mode == "auto":
+            self.release()
+
+    @property
+    def size(self) -> int:
+        '''
+            int: The number of recorded commands.
+        '''
+
+        return self.mglo.size
+
+    def begin_scope(self, scope) -> int:
+        '''
+            Record entering a :py:class:`Scope`.
+
+            Args:
+                scope (Scope): The scope.
+
+            Returns:
+                int: The index of the command.
+        '''
+
+        self._objects.append(scope)
+        return self.mglo.scope(scope.mglo, True)
+
+    def end_scope(self, scope) -> int:
+        '''
+            Record leaving a :py:class:`Scope`.
+
+            Args:
+                scope (Scope): The scope.
+
+            Returns:
+                int: The index of the command.
+        '''
+
+        self._objects.append(scope)
+        return self.mglo.scope(scope.mglo, False)
+
+    def use_framebuffer(self, framebuffer) -> int:
+        '''
+            Record :py:meth:`Framebuffer.use`.
+
+            Args:
+                framebuffer (Framebuffer): The framebuffer.
+
+            Returns:
+                int: The index of the command.
+        '''
+
+        self._objects.append(framebuffer)
+        return self.mglo.framebuffer(framebuffer.mglo)
+
+    def use_texture(self, texture, location=0) -> int:
+        '''
+            Record binding a :py:class:`Texture`, :py:class:`Texture3D`,
+            :py:class:`TextureArray` or :py:class:`TextureCube` to a texture unit.
+
+            Args:
+                texture: The texture.
+                location (int): The texture unit.
+
+            Returns:
+                int: The index of the command.
+        '''
+
+        self._objects.append(texture)
+        return self.mglo.texture(texture.mglo, location)
+
+    def use_sampler(self, sampler, location=0) -> int:
+        '''
+            Record binding a :py:class:`Sampler` to a texture unit.
+
+            Args:
+                sampler (Sampler): The sampler.
+                location (int): The texture unit.
+
+            Returns:
+                int: The index of the command.
+        '''
+
+        self._objects.append(sampler)
+        return self.mglo.sampler(sampler.mglo, location)
+
+    def bind_uniform_buffer(self, buffer, binding=0, *, offset=0, size=-1) -> int:
+        '''
+            Record binding a range of a :py:class:`Buffer` to a uniform block binding.
+            The offset can be patched with :py:meth:`CommandList.set_offset`.
+
+            Args:
+                buffer (Buffer): The buffer.
+                binding (int): The uniform block binding.
+
+            Keyword Args:
+                offset (int): The offset of the range.
+                size (int): The size of the range, by default until the end of the buffer.
+
+            Returns:
+                int: The index of the command.
+        '''
+
+        self._objects.append(buffer)
+        return self.mglo.buffer(buffer.mglo, False, binding, offset, size)
+
+    def bind_storage_buffer(self, buffer, binding=0, *, offset=0, size=-1) -> int:
+        '''
+            Record binding a range of a :py:class:`Buffer` to a shader storage binding.
+            The offset can be patched with :py:meth:`CommandList.set_offset`.
+
+            Args:
+                buffer (Buffer): The buffer.
+                binding (int): The shader storage binding.
+
+            Keyword Args:
+                offset (int): The offset of the range.
+                size (int): The size of the range, by default until the end of the buffer.
+
+            Returns:
+                int: The index of the command.
+        '''
+
+        self._objects.append(buffer)
+        return self.mglo.buffer(buffer.mglo, True, binding, offset, size)
+
+    def enable_only(self, flags) -> int:
+        '''
+            Record :py:meth:`Context.enable_only`.
+
+            Args:
+                flags (int): The flags to enable.
+
+            Returns:
+                int: The index of the command.
+        '''
+
+        return self.mglo.enable(flags)
+
+    def uniform(self, uniform, data) -> int:
+        '''
+            Record writing the raw data of a :py:class:`Uniform`.
+            The data can be patched with :py:meth:`CommandList.write_uniform`.
+
+            Args:
+                uniform (Uniform): The uniform, for example ``program['mvp']``.
+                data (bytes): The data, the same as for :py:meth:`Uniform.write`.
+
+            Returns:
+                int: The index of the command.
+        '''
+
+        return self.mglo.uniform(uniform.mglo, data)
+
+    def render(self, vertex_array, mode=None, vertices=-1, *, first=0, instances=-1) -> int:
+        '''
+            Record :py:meth:`VertexArray.render`.
+            The scope of the vertex array is recorded around the draw call.
+
+            Args:
+                vertex_array (VertexArray): The vertex array.
+                mode (int): By default the mode of the vertex array will be used.
+                vertices (int): The number of vertices.
+
+            Keyword Args:
+                first (int): The index of the first vertex to start with.
+                instances (int): The number of instances.
+
+            Returns:
+                int: The index of the command.
+        '''
+
+        if mode is None:
+            mode = vertex_array.mode
+
+        self._objects.append(vertex_array)
+
+        if vertex_array.scope:
+            self.begin_scope(vertex_array.scope)
+            index = self.mglo.render(vertex_array.mglo, mode, vertices, first, instances)
+            self.end_scope(vertex_array.scope)
+            return index
+
+        return self.mglo.render(vertex_array.mglo, mode, vertices, first, instances)
+
+    def render_indirect(self, vertex_array, buffer, mode=None, count=-1, *, first=0) -> int:
+        '''
+            Record :py:meth:`VertexArray.render_indirect`.
+            The scope of the vertex array is recorded around the draw call.
+
+            Args:
+                vertex_array (VertexArray): The vertex array.
+                buffer (Buffer): Indirect drawing commands.
+                mode (int): By default the mode of the vertex array will be used.
+                count (int): The number of draws.
+
+            Keyword Args:
+                first (int): The index of the first indirect draw command.
+
+            Returns:
+                int: The index of the command.
+        '''
+
+        if mode is None:
+            mode = vertex_array.mode
+
+        self._objects.append(vertex_array)
+        self._objects.append(buffer)
+
+        if vertex_array.scope:
+            self.begin_scope(vertex_array.scope)
+            index = self.mglo.render_indirect(vertex_array.mglo, buffer.mglo, mode, count, first)
+            self.end_scope(vertex_array.scope)
+            return index
+
+        return self.mglo.render_indirect(vertex_array.mglo, buffer.mglo, mode, count, first)
+
+    def write_uniform(self, index, data) -> None:
+        '''
+            Replace the data of a recorded uniform command.
+
+            Args:
+                index (int): The index returned by :py:meth:`CommandList.uniform`.
+                data (bytes): The new data. The size must match.
+        '''
+
+        self.mglo.write_uniform(index, data)
+
+    def set_offset(self, index, offset) -> None:
+        '''
+            Replace the offset of a recorded buffer binding command.
+
+            Args:
+                index (int): The index returned by :py:meth:`CommandList.bind_uniform_buffer`
+                             or :py:meth:`CommandList.bind_storage_buffer`.
+                offset (int): The new offset.
+        '''
+
+        self.mglo.set_offset(index, offset)
+
+    def execute(self) -> None:
+        '''
+            Replay the recorded commands.
+        '''
+
+        self.mglo.execute()
+
+    def clear(self) -> None:
+        '''
+            Remove all the recorded commands.
+        '''
+
+        self.mglo.clear()
+        self._objects = []
+
+    def release(self) -> None:
+        '''
+            Release the ModernGL object.
+        '''
+
+        LOG.debug(f"{self.__class__.__name__}.release() {self}")
+        if not isinstance(self.mglo, InvalidObject):
+            self.mglo.release()
+            self._objects = None
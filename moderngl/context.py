@@ -4,19 +4,26 @@ from typing import Any, Dict, Optional, Set, Tuple
 
 from moderngl.mgl import InvalidObject  # type: ignore
 from .buffer import Buffer
+from .command_list import CommandList
 from .compute_shader import ComputeShader
 from .conditional_render import ConditionalRender
 from .framebuffer import Framebuffer
 from .program import Program, detect_format
+from .program_cache import ProgramCache
+from .profiler import Profiler
 from .program_members import (Attribute, Subroutine, Uniform, UniformBlock,
                               Varying)
 from .query import Query
+from .query_pool import QueryPool
 from .renderbuffer import Renderbuffer
 from .scope import Scope
+from .stream_buffer import StreamBuffer
 from .texture import Texture
 from .texture_3d import Texture3D
 from .texture_array import TextureArray
 from .texture_cube import TextureCube
+from .tiled_framebuffer import TiledFramebuffer
+from .upload_queue import UploadQueue
 from .vertex_array import VertexArray
 from .sampler import Sampler
 
@@ -253,13 +260,15 @@ class Context:
     #: Used with :py:attr:`Context.provoking_vertex`.
     LAST_VERTEX_CONVENTION = 0x8E4E
 
-    __slots__ = ['mglo', '_screen', '_info', '_extensions', 'version_code', 'fbo', '_gc_mode', 'extra']
+    __slots__ = ['mglo', '_screen', '_info', '_extensions', '_program_cache', '_profiler', 'version_code', 'fbo', '_gc_mode', 'extra']
 
     def __init__(self):
         self.mglo = None  #: Internal representation for debug purposes only.
         self._screen = None
         self._info = None
         self._extensions = None
+        self._program_cache = None
+        self._profiler = None
         self.version_code = None  #: int: The OpenGL version code. Reports ``410`` for OpenGL 4.1
         #: Framebuffer: The active framebuffer.
         #: Set every time :py:meth:`Framebuffer.use()` is called.
@@ -606,6 +615,137 @@ class Context:
     def wireframe(self, value):
         self.mglo.wireframe = value
 
+    @property
+    def program_cache(self) -> Optional[ProgramCache]:
+        '''
+            ProgramCache: The cache of program binaries used by :py:meth:`Context.program`.
+            ``None`` by default.
+
+            Example::
+
+                ctx.program_cache = moderngl.ProgramCache('.shader_cache')
+        '''
+
+        return self._program_cache
+
+    @program_cache.setter
+    def program_cache(self, value):
+        self._program_cache = value
+
+    @property
+    def profiler(self) -> Profiler:
+        '''
+            Profiler: The profiler used by :py:meth:`Context.profile`.
+            Created on first use with the default settings.
+        '''
+
+        if self._profiler is None:
+            self._profiler = Profiler(self)
+
+        return self._profiler
+
+    @profiler.setter
+    def profiler(self, value):
+        self._profiler = value
+
+    @property
+    def state_cache(self) -> bool:
+        '''
+            bool: Skip OpenGL calls that would not change the state (default ``True``).
+
+            ModernGL tracks the bound program, vertex array, framebuffer,
+            textures and samplers per unit, uniform and storage buffer bindings
+            and the enable flags. When the state is changed with raw OpenGL calls
+            outside of ModernGL the cache must be invalidated with
+            :py:meth:`Context.invalidate_state_cache` or disabled entirely.
+
+            Example::
+
+                ctx.state_cache = False
+        '''
+
+        return self.mglo.state_cache
+
+    @state_cache.setter
+    def state_cache(self, value):
+        self.mglo.state_cache = value
+
+    @property
+    def uniform_shadowing(self) -> bool:
+        '''
+            bool: Skip uniform uploads that would not change the value (default ``True``).
+
+            Every uniform keeps a copy of the last written value and assigning
+            the same bytes again does not call OpenGL. Uniforms written with raw
+            OpenGL calls require :py:meth:`Context.invalidate_state_cache`.
+
+            Example::
+
+                ctx.uniform_shadowing = False
+        '''
+
+        return self.mglo.uniform_shadowing
+
+    @uniform_shadowing.setter
+    def uniform_shadowing(self, value):
+        self.mglo.uniform_shadowing = value
+
+    @property
+    def native_loader(self) -> bool:
+        '''
+            bool: The OpenGL functions were resolved by calling the GetProcAddress
+            function of the window system directly.
+
+            It is ``False`` when ``native_loader=False`` was passed to :py:func:`create_context`,
+            for backend factories and for backends without such a function.
+            The functions were then resolved by calling ``load(name)`` on the backend.
+        '''
+
+        return self.mglo.native_loader
+
+    @property
+    def uniform_uploads(self) -> Tuple[int, int]:
+        '''
+            tuple: The number of uniform uploads issued and skipped since the context was created
+            or :py:meth:`Context.reset_stats` was called.
+
+            Example::
+
+                issued, skipped = ctx.uniform_uploads
+        '''
+
+        return self.mglo.uniform_uploads
+
+    @property
+    def stats(self) -> Dict[str, int]:
+        '''
+            dict: A snapshot of the work issued since the context was created
+            or :py:meth:`Context.reset_stats` was called.
+
+            The counters are always on, they are incremented by the draw, bind and transfer methods.
+
+            - ``draw_calls``, ``vertices``, ``instances``: the vertices are counted once per instance.
+              The vertices and instances of indirect draws are not known and not counted.
+            - ``dispatches``: the compute shader dispatches.
+            - ``program_binds``, ``vertex_array_binds``, ``framebuffer_binds``, ``texture_binds``:
+              the binds skipped by the :py:attr:`Context.state_cache` are not counted.
+            - ``uniform_uploads``, ``uniform_uploads_skipped``: see :py:attr:`Context.uniform_shadowing`.
+            - ``bytes_written``, ``bytes_read``: the bytes transferred by the ``write``, ``read``
+              and ``read_into`` methods of buffers and textures, ``Framebuffer.read``, ``StreamBuffer.write``,
+              ``UploadQueue.flush``, :py:class:`Readback` and :py:class:`TiledFramebuffer` reads.
+              Mapped buffers and buffer views count their full size once per export,
+              as written for writable exports and as read otherwise.
+              Transfers between buffers and textures on the GPU are not counted.
+
+            Example::
+
+                ctx.reset_stats()
+                render_frame()
+                print(ctx.stats['draw_calls'], ctx.stats['bytes_written'])
+        '''
+
+        return self.mglo.stats
+
     @property
     def front_face(self) -> str:
         '''
@@ -951,6 +1091,24 @@ class Context:
         """
         self.mglo.disable_direct(enum)
 
+    def profile(self, name, scope=None):
+        '''
+            Profile a named region with :py:attr:`Context.profiler`.
+
+            Call ``ctx.profiler.next_frame()`` once per frame to resolve the regions.
+
+            .. code-block:: python
+
+                with ctx.profile('shadow_pass'):
+                    render_shadows()
+
+            Args:
+                name (str): The name of the region.
+                scope (Scope): A scope entered inside the region.
+        '''
+
+        return self.profiler.region(name, scope)
+
     def finish(self) -> None:
         '''
             Wait for all drawing commands to finish.
@@ -1011,19 +1169,27 @@ class Context:
         res._depth_attachment = None
         res.ctx = self
         res._is_reference = True
+        res._readbacks = None
+        res._readback_index = None
         res.extra = None
         return res
 
-    def buffer(self, data=None, *, reserve=0, dynamic=False) -> Buffer:
+    def buffer(self, data=None, *, reserve=0, dynamic=False, persistent=False) -> Buffer:
         '''
             Create a :py:class:`Buffer` object.
 
+            A persistent buffer is allocated with immutable storage and stays
+            mapped until it is released. Its content can be accessed without
+            copies through :py:attr:`Buffer.mapping`.
+            Persistent buffers require OpenGL 4.4 or ``GL_ARB_buffer_storage``.
+
             Args:
                 data (bytes): Content of the new buffer.
 
             Keyword Args:
                 reserve (int): The number of bytes to reserve.
                 dynamic (bool): Treat buffer as dynamic.
+                persistent (bool): Keep the buffer persistently mapped.
 
             Returns:
                 :py:class:`Buffer` object
@@ -1033,14 +1199,73 @@ class Context:
             reserve = mgl.strsize(reserve)
 
         res = Buffer.__new__(Buffer)
-        res.mglo, res._size, res._glo = self.mglo.buffer(data, reserve, dynamic)
+        res.mglo, res._size, res._glo = self.mglo.buffer(data, reserve, dynamic, persistent)
         res._dynamic = dynamic
+        res._persistent = persistent
+        res._mapping = None
+        res.ctx = self
+        res.extra = None
+        return res
+
+    def stream_buffer(self, size, *, regions=3, persistent=False) -> StreamBuffer:
+        '''
+            Create a :py:class:`StreamBuffer` object.
+
+            The underlying buffer is ``size * regions`` bytes large.
+            One region is written while the GPU reads the others.
+
+            Args:
+                size (int): The size of a single region in bytes.
+
+            Keyword Args:
+                regions (int): The number of regions. Usually the number of frames in flight.
+                persistent (bool): Write through a persistent mapping.
+
+            Returns:
+                :py:class:`StreamBuffer` object
+        '''
+
+        if type(size) is str:
+            size = mgl.strsize(size)
+
+        res = StreamBuffer.__new__(StreamBuffer)
+        res._buffer = self.buffer(reserve=size * regions, dynamic=True, persistent=persistent)
+        res._regions = regions
+        res.mglo = self.mglo.stream_buffer(res._buffer.mglo, regions)
+        res.ctx = self
+        res.extra = None
+        return res
+
+    def upload_queue(self, size, *, slots=3) -> UploadQueue:
+        '''
+            Create a :py:class:`UploadQueue` object.
+
+            The staging buffer is a persistent buffer of ``size * slots`` bytes.
+            One slot is written while the GPU reads the others.
+
+            Args:
+                size (int): The size of a single slot in bytes.
+
+            Keyword Args:
+                slots (int): The number of slots. Usually the number of frames in flight.
+
+            Returns:
+                :py:class:`UploadQueue` object
+        '''
+
+        if type(size) is str:
+            size = mgl.strsize(size)
+
+        res = UploadQueue.__new__(UploadQueue)
+        res._buffer = self.buffer(reserve=size * slots, dynamic=True, persistent=True)
+        res._slots = slots
+        res.mglo = self.mglo.upload_queue(res._buffer.mglo, slots)
         res.ctx = self
         res.extra = None
         return res
 
     def texture(self, size, components, data=None, *, samples=0, alignment=1,
-                dtype='f1', internal_format=None) -> 'Texture':
+                dtype='f1', internal_format=None, levels=None, immutable=False) -> 'Texture':
         '''
             Create a :py:class:`Texture` object.
 
@@ -1058,13 +1283,17 @@ class Context:
                 alignment (int): The byte alignment 1, 2, 4 or 8.
                 dtype (str): Data type.
                 internal_format (int): Override the internalformat of the texture (IF needed)
+                levels (int): The number of mipmap levels of an immutable texture.
+                immutable (bool): Allocate immutable storage with ``glTexStorage2D``.
+                                  By default the full mipmap chain is allocated.
 
             Returns:
                 :py:class:`Texture` object
         '''
 
+        levels = _storage_levels(levels, immutable)
         res = Texture.__new__(Texture)
-        res.mglo, res._glo = self.mglo.texture(size, components, data, samples, alignment, dtype, internal_format or 0)
+        res.mglo, res._glo = self.mglo.texture(size, components, data, samples, alignment, dtype, internal_format or 0, levels)
         res._size = size
         res._components = components
         res._samples = samples
@@ -1075,7 +1304,7 @@ class Context:
         return res
 
     def texture_array(self, size, components, data=None, *, alignment=1,
-                      dtype='f1') -> 'TextureArray':
+                      dtype='f1', levels=None, immutable=False) -> 'TextureArray':
         '''
             Create a :py:class:`TextureArray` object.
 
@@ -1088,13 +1317,17 @@ class Context:
             Keyword Args:
                 alignment (int): The byte alignment 1, 2, 4 or 8.
                 dtype (str): Data type.
+                levels (int): The number of mipmap levels of an immutable texture.
+                immutable (bool): Allocate immutable storage with ``glTexStorage3D``.
+                                  By default the full mipmap chain is allocated.
 
             Returns:
                 :py:class:`Texture3D` object
         '''
 
+        levels = _storage_levels(levels, immutable)
         res = TextureArray.__new__(TextureArray)
-        res.mglo, res._glo = self.mglo.texture_array(size, components, data, alignment, dtype)
+        res.mglo, res._glo = self.mglo.texture_array(size, components, data, alignment, dtype, levels)
         res._size = size
         res._components = components
         res._dtype = dtype
@@ -1102,7 +1335,8 @@ class Context:
         res.extra = None
         return res
 
-    def texture3d(self, size, components, data=None, *, alignment=1, dtype='f1') -> 'Texture3D':
+    def texture3d(self, size, components, data=None, *, alignment=1, dtype='f1',
+                  levels=None, immutable=False) -> 'Texture3D':
         '''
             Create a :py:class:`Texture3D` object.
 
@@ -1114,19 +1348,23 @@ class Context:
             Keyword Args:
                 alignment (int): The byte alignment 1, 2, 4 or 8.
                 dtype (str): Data type.
+                levels (int): The number of mipmap levels of an immutable texture.
+                immutable (bool): Allocate immutable storage with ``glTexStorage3D``.
+                                  By default the full mipmap chain is allocated.
 
             Returns:
                 :py:class:`Texture3D` object
         '''
 
+        levels = _storage_levels(levels, immutable)
         res = Texture3D.__new__(Texture3D)
-        res.mglo, res._glo = self.mglo.texture3d(size, components, data, alignment, dtype)
+        res.mglo, res._glo = self.mglo.texture3d(size, components, data, alignment, dtype, levels)
         res.ctx = self
         res.extra = None
         return res
 
     def texture_cube(self, size, components, data=None, *, alignment=1,
-                     dtype='f1') -> 'TextureCube':
+                     dtype='f1', levels=None, immutable=False) -> 'TextureCube':
         '''
             Create a :py:class:`TextureCube` object.
 
@@ -1140,13 +1378,17 @@ class Context:
             Keyword Args:
                 alignment (int): The byte alignment 1, 2, 4 or 8.
                 dtype (str): Data type.
+                levels (int): The number of mipmap levels of an immutable texture.
+                immutable (bool): Allocate immutable storage with ``glTexStorage2D``.
+                                  By default the full mipmap chain is allocated.
 
             Returns:
                 :py:class:`TextureCube` object
         '''
 
+        levels = _storage_levels(levels, immutable)
         res = TextureCube.__new__(TextureCube)
-        res.mglo, res._glo = self.mglo.texture_cube(size, components, data, alignment, dtype)
+        res.mglo, res._glo = self.mglo.texture_cube(size, components, data, alignment, dtype, levels)
         res._size = size
         res._components = components
         res._dtype = dtype
@@ -1252,6 +1494,9 @@ class Context:
                 :py:class:`VertexArray` object
         '''
 
+        if program._pending is not None:
+            program._resolve()
+
         members = program._members
         index_buffer_mglo = None if index_buffer is None else index_buffer.mglo
         mgl_content = tuple((a.mglo, b) + tuple(getattr(members.get(x), 'mglo', None)
@@ -1310,6 +1555,8 @@ class Context:
             Create a :py:class:`Program` object.
 
             Only linked programs will be returned.
+            When :py:attr:`Context.program_cache` is set the linked binary
+            is loaded from the cache if possible.
 
             A single shader in the `shaders` parameter is also accepted.
             The varyings are only used when a transform program is created.
@@ -1327,40 +1574,85 @@ class Context:
 
         varyings = tuple(varyings)
 
+        shaders = (vertex_shader, fragment_shader, geometry_shader, tess_control_shader, tess_evaluation_shader)
+        cache = self._program_cache
+        key, binary = None, None
+
+        if cache is not None:
+            key = cache.key(self, shaders, varyings)
+            binary = cache.load(key)
+
         res = Program.__new__(Program)
-        res.mglo, ls1, ls2, ls3, ls4, ls5, res._subroutines, res._geom, res._glo = self.mglo.program(
-            vertex_shader, fragment_shader, geometry_shader, tess_control_shader, tess_evaluation_shader,
-            varyings
-        )
+        res.mglo, reflection, loaded, binary = self.mglo.program(*shaders, varyings, binary, cache is not None)
+        res._set_reflection(reflection)
+        res._pending = None
+        res._error = None
+
+        if cache is not None:
+            if loaded:
+                cache.hits += 1
+            else:
+                cache.misses += 1
+                if binary is not None:
+                    cache.save(key, binary)
 
-        members = {}
+        res._is_transform = fragment_shader is None
+        res.ctx = self
+        res.extra = None
+        return res
 
-        for item in ls1:
-            obj = Attribute.__new__(Attribute)
-            obj.mglo, obj._location, obj._array_length, obj._dimension, obj._shape, obj._name = item
-            members[obj.name] = obj
+    def program_async(self, *, vertex_shader, fragment_shader=None, geometry_shader=None,
+                      tess_control_shader=None, tess_evaluation_shader=None, varyings=()) -> 'Program':
+        '''
+            Create a :py:class:`Program` object without waiting for the compiler.
 
-        for item in ls2:
-            obj = Varying.__new__(Varying)
-            obj._number, obj._array_length, obj._dimension, obj._name = item
-            members[obj.name] = obj
+            The shaders are compiled and linked without checking the status.
+            Drivers supporting ``GL_KHR_parallel_shader_compile`` compile
+            in background threads, so submitting many programs before using
+            any of them compiles them concurrently. The compile status and the
+            members of the program are resolved when the program is first used.
+            Compiler and linker errors are raised at that point.
 
-        for item in ls3:
-            obj = Uniform.__new__(Uniform)
-            obj.mglo, obj._location, obj._array_length, obj._dimension, obj._name = item
-            members[obj.name] = obj
+            Use :py:attr:`Program.ready` to check if the program can be used without blocking.
 
-        for item in ls4:
-            obj = UniformBlock.__new__(UniformBlock)
-            obj.mglo, obj._index, obj._size, obj._name = item
-            members[obj.name] = obj
+            Args:
+                vertex_shader (str): The vertex shader source.
+                fragment_shader (str): The fragment shader source.
+                geometry_shader (str): The geometry shader source.
+                tess_control_shader (str): The tessellation control shader source.
+                tess_evaluation_shader (str): The tessellation evaluation shader source.
+                varyings (list): A list of varying names.
 
-        for item in ls5:
-            obj = Subroutine.__new__(Subroutine)
-            obj._index, obj._name = item
-            members[obj.name] = obj
+            Returns:
+                :py:class:`Program` object
+        '''
 
-        res._members = members
+        if type(varyings) is str:
+            varyings = (varyings,)
+
+        varyings = tuple(varyings)
+
+        shaders = (vertex_shader, fragment_shader, geometry_shader, tess_control_shader, tess_evaluation_shader)
+        cache = self._program_cache
+        key = None
+
+        if cache is not None:
+            key = cache.key(self, shaders, varyings)
+            # Loading a binary does not involve the compiler
+            if cache.load(key) is not None:
+                return self.program(
+                    vertex_shader=vertex_shader, fragment_shader=fragment_shader, geometry_shader=geometry_shader,
+                    tess_control_shader=tess_control_shader, tess_evaluation_shader=tess_evaluation_shader,
+                    varyings=varyings,
+                )
+
+        res = Program.__new__(Program)
+        res.mglo, res._glo = self.mglo.program_submit(*shaders, varyings, cache is not None)
+        res._members = {}
+        res._subroutines = None
+        res._geom = (None, None, None)
+        res._pending = (cache, key)
+        res._error = None
         res._is_transform = fragment_shader is None
         res.ctx = self
         res.extra = None
@@ -1389,6 +1681,38 @@ class Context:
         res.extra = None
         return res
 
+    def query_pool(self, size=16) -> QueryPool:
+        '''
+            Create a :py:class:`QueryPool` object.
+
+            Args:
+                size (int): The initial number of query objects.
+
+            Returns:
+                :py:class:`QueryPool` object
+        '''
+
+        res = QueryPool.__new__(QueryPool)
+        res.mglo = self.mglo.query_pool(size)
+        res.ctx = self
+        res.extra = None
+        return res
+
+    def command_list(self) -> 'CommandList':
+        '''
+            Create an empty :py:class:`CommandList` object.
+
+            Returns:
+                :py:class:`CommandList` object
+        '''
+
+        res = CommandList.__new__(CommandList)
+        res.mglo = self.mglo.command_list()
+        res._objects = []
+        res.ctx = self
+        res.extra = None
+        return res
+
     def scope(self, framebuffer=None, enable_only=None, *, textures=(),
               uniform_buffers=(), storage_buffers=(), samplers=(), enable=None) -> 'Scope':
         '''
@@ -1402,8 +1726,12 @@ class Context:
                 textures (list): List of (texture, binding) tuples.
                 uniform_buffers (list): List of (buffer, binding) tuples.
                 storage_buffers (list): List of (buffer, binding) tuples.
-                samplers (list): List of sampler bindings
+                samplers (list): List of (sampler, binding) tuples.
+                                 The texture of the sampler is bound too.
                 enable (int): Flags to enable for this vao such as depth testing and blending
+
+            The bindings are resolved when the scope is created,
+            entering the scope does not call python methods.
         '''
 
         if enable is not None:
@@ -1412,13 +1740,17 @@ class Context:
         if framebuffer is None:
             framebuffer = self.screen
 
-        mgl_textures = tuple((tex.mglo, idx) for tex, idx in textures)
+        samplers = tuple(samplers)
+        sampler_textures = tuple((sampler.texture, idx) for sampler, idx in samplers if sampler.texture is not None)
+
+        mgl_textures = tuple((tex.mglo, idx) for tex, idx in tuple(textures) + sampler_textures)
+        mgl_samplers = tuple((sampler.mglo, idx) for sampler, idx in samplers)
         mgl_uniform_buffers = tuple((buf.mglo, idx) for buf, idx in uniform_buffers)
         mgl_storage_buffers = tuple((buf.mglo, idx) for buf, idx in storage_buffers)
 
         res = Scope.__new__(Scope)
         res.mglo = self.mglo.scope(framebuffer.mglo, enable_only, mgl_textures,
-                                   mgl_uniform_buffers, mgl_storage_buffers, samplers)
+                                   mgl_uniform_buffers, mgl_storage_buffers, mgl_samplers)
         res.ctx = self
         res._framebuffer = framebuffer
         res._textures = textures
@@ -1477,6 +1809,46 @@ class Context:
         res._depth_attachment = depth_attachment
         res.ctx = self
         res._is_reference = False
+        res._readbacks = None
+        res._readback_index = None
+        res.extra = None
+        return res
+
+    def tiled_framebuffer(self, size, tile_size=None, components=4, *, dtype='f1', depth=True) -> TiledFramebuffer:
+        '''
+            Create a :py:class:`TiledFramebuffer` object.
+
+            The image can be larger than ``GL_MAX_VIEWPORT_DIMS`` and ``GL_MAX_RENDERBUFFER_SIZE``,
+            only the tiles are limited by them.
+
+            Args:
+                size (tuple): The width and height of the whole image.
+                tile_size (tuple): The width and height of a tile.
+                                   By default the image size clamped to the framebuffer limits.
+                components (int): The number of components 1, 2, 3 or 4.
+
+            Keyword Args:
+                dtype (str): Data type.
+                depth (bool): Attach a depth renderbuffer to the tile framebuffer.
+
+            Returns:
+                :py:class:`TiledFramebuffer` object
+        '''
+
+        if tile_size is None:
+            limit = min(self.info['GL_MAX_RENDERBUFFER_SIZE'], *self.info['GL_MAX_VIEWPORT_DIMS'])
+            tile_size = (min(size[0], limit), min(size[1], limit))
+
+        color = self.renderbuffer(tile_size, components, dtype=dtype)
+        depth_attachment = self.depth_renderbuffer(tile_size) if depth else None
+
+        res = TiledFramebuffer.__new__(TiledFramebuffer)
+        res._framebuffer = self.framebuffer(color, depth_attachment)
+        res._size = tuple(size)
+        res._components = components
+        res._dtype = dtype
+        res.mglo = self.mglo.tiled_framebuffer(res._framebuffer.mglo, size[0], size[1], components, dtype)
+        res.ctx = self
         res.extra = None
         return res
 
@@ -1612,6 +1984,25 @@ class Context:
         res.texture = texture
         return res
 
+    def invalidate_state_cache(self) -> None:
+        '''
+            Forget the cached OpenGL state.
+
+            The next call of every kind will be issued unconditionally,
+            including uniform uploads skipped by :py:attr:`Context.uniform_shadowing`.
+            Call this after changing the OpenGL state with raw OpenGL calls
+            or other libraries sharing the context.
+        '''
+
+        self.mglo.invalidate_state_cache()
+
+    def reset_stats(self) -> None:
+        '''
+            Set every counter of :py:attr:`Context.stats` to zero.
+        '''
+
+        self.mglo.reset_stats()
+
     def clear_samplers(self, start=0, end=-1):
         '''
             Unbinds samplers from texture units.
@@ -1711,6 +2102,9 @@ def create_context(require=None, standalone=False, share=False, **settings) -> C
         Keyword Arguments:
             require (int): OpenGL version code (default: 330)
             standalone (bool): Headless flag
+            backend (str): The name of the glcontext backend or a callable creating the backend context
+            native_loader (bool): Resolve the OpenGL functions with the GetProcAddress function
+                of the window system when the backend has one (default: True)
             **settings: Other backend specific settings
 
         Returns:
@@ -1730,6 +2124,8 @@ def create_context(require=None, standalone=False, share=False, **settings) -> C
     ctx.mglo, ctx.version_code = mgl.create_context(glversion=require, mode=mode, **settings)
     ctx._info = None
     ctx._extensions = None
+    ctx._program_cache = None
+    ctx._profiler = None
     ctx.extra = None
     ctx._gc_mode = "auto"
 
@@ -1778,6 +2174,8 @@ def create_standalone_context(require=None, share=False, **settings) -> 'Context
     ctx.fbo = None
     ctx._info = None
     ctx._extensions = None
+    ctx._program_cache = None
+    ctx._profiler = None
     ctx.extra = None
     ctx._gc_mode = "auto"
 
@@ -1786,3 +2184,18 @@ def create_standalone_context(require=None, share=False, **settings) -> 'Context
             require, ctx.version_code))
 
     return ctx
+
+
+def _storage_levels(levels, immutable) -> int:
+    '''
+        The levels argument of the texture constructors.
+        Zero allocates mutable storage, -1 the full mipmap chain.
+    '''
+
+    if levels is None:
+        return -1 if immutable else 0
+
+    if levels < 1:
+        raise ValueError('the number of levels must be at least 1')
+
+    return levels
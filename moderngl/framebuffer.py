@@ -3,6 +3,7 @@ from typing import Any, Dict, List, Tuple, Union, TYPE_CHECKING
 
 from moderngl.mgl import InvalidObject  # type: ignore
 from .buffer import Buffer
+from .readback import Readback
 from .renderbuffer import Renderbuffer
 from .texture import Texture
 
@@ -24,9 +25,12 @@ class Framebuffer:
 
     __slots__ = [
         'mglo', '_color_attachments', '_depth_attachment', '_size', '_samples', '_glo',
-        'ctx', '_is_reference', 'extra'
+        'ctx', '_is_reference', '_readbacks', '_readback_index', 'extra'
     ]
 
+    #: The number of :py:class:`Readback` handles reused by :py:meth:`Framebuffer.read_async`.
+    READBACK_RING_SIZE = 3
+
     def __init__(self):
         self.mglo = None  #: Internal representation for debug purposes only.
         self._color_attachments = None
@@ -36,6 +40,8 @@ class Framebuffer:
         self._glo: int = None
         self.ctx: Context = None  #: The context this object belongs to
         self._is_reference = None  #: Detected framebuffers we should not delete
+        self._readbacks = None
+        self._readback_index = None
         self.extra: Any = None  #: Attribute for storing user defined objects
         raise TypeError()
 
@@ -291,6 +297,43 @@ class Framebuffer:
 
         return self.mglo.read(viewport, components, attachment, alignment, clamp, dtype)
 
+    def read_array(self, viewport=None, components=3, *, channels=None, attachment=0, dtype='f1',
+                   flip=False) -> memoryview:
+        '''
+            Read the content of the framebuffer as a typed memoryview.
+
+            The memoryview has the shape ``(height, width, channels)`` and the format
+            of the ``dtype``, so ``numpy.asarray()`` wraps it without copies.
+            Rows are tightly packed.
+
+            The flip and the channel drop run in native code without the GIL.
+            Reading four components and keeping three is usually faster than
+            asking the driver for three component pixels.
+
+            .. code-block:: python
+
+                # rgb image with the first row at the top
+                image = np.asarray(fbo.read_array(components=4, channels=3, flip=True))
+
+            Args:
+                viewport (tuple): The viewport.
+                components (int): The number of components to read.
+
+            Keyword Args:
+                channels (int): The number of components to keep. By default all of them.
+                attachment (int): The color attachment.
+                dtype (str): Data type.
+                flip (bool): Reverse the order of the rows.
+
+            Returns:
+                memoryview
+        '''
+
+        if channels is None:
+            channels = components
+
+        return memoryview(self.mglo.read_array(viewport, components, channels, attachment, dtype, flip))
+
     def read_into(self, buffer, viewport=None, components=3, *,
                   attachment=0, alignment=1, dtype='f1', write_offset=0) -> None:
         '''
@@ -313,6 +356,52 @@ class Framebuffer:
 
         return self.mglo.read_into(buffer, viewport, components, attachment, alignment, dtype, write_offset)
 
+    def read_async(self, viewport=None, components=3, *, attachment=0, alignment=1, dtype='f1') -> Readback:
+        '''
+            Start reading the content of the framebuffer without blocking.
+
+            The pixels are read into a pixel pack buffer taken from a small ring
+            owned by the framebuffer. The returned handle is reused after
+            :py:attr:`READBACK_RING_SIZE` further calls, so at most that many
+            reads can be in flight at the same time.
+
+            Args:
+                viewport (tuple): The viewport.
+                components (int): The number of components to read.
+
+            Keyword Args:
+                attachment (int): The color attachment.
+                alignment (int): The byte alignment of the pixels.
+                dtype (str): Data type.
+
+            Returns:
+                :py:class:`Readback` object
+
+            .. code-block:: python
+
+                >>> handle = fbo.read_async(components=4)
+                >>> # render the next frame
+                >>> if handle.ready():
+                ...     pixels = handle.data
+        '''
+
+        if self._readbacks is None:
+            self._readbacks = []
+            self._readback_index = 0
+
+        if len(self._readbacks) < self.READBACK_RING_SIZE:
+            res = Readback.__new__(Readback)
+            res.mglo = self.ctx.mglo.readback()
+            res.ctx = self.ctx
+            res.extra = None
+            self._readbacks.append(res)
+        else:
+            res = self._readbacks[self._readback_index]
+            self._readback_index = (self._readback_index + 1) % self.READBACK_RING_SIZE
+
+        res.mglo.read(self.mglo, viewport, components, attachment, alignment, dtype)
+        return res
+
     def release(self) -> None:
         '''
             Release the ModernGL object.
@@ -321,4 +410,7 @@ class Framebuffer:
         if not isinstance(self.mglo, InvalidObject):
             self._color_attachments = None
             self._depth_attachment = None
+            for readback in self._readbacks or ():
+                readback.release()
+            self._readbacks = None
             self.mglo.release()
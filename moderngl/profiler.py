@@ -0,0 +1,205 @@
+import collections
+import contextlib
+import json
+import math
+import time
+
+__all__ = ['Profiler']
+
+
+class Profiler:
+    '''
+        A per-pass CPU and GPU frame profiler.
+
+        Every region records the CPU wall time and a pair of GPU timestamps
+        taken from a :py:class:`QueryPool`. The timestamps are resolved by
+        :py:meth:`Profiler.next_frame` once they are ``latency`` frames old and
+        their results are available, so profiling never stalls the pipeline.
+        Unlike ``GL_TIME_ELAPSED`` queries, timestamps allow nested regions.
+
+        Usually the profiler of the context is used through :py:meth:`Context.profile`.
+
+        Example::
+
+            with ctx.profile('shadow_pass'):
+                render_shadows()
+
+            ctx.profiler.next_frame()
+            print(ctx.profiler.stats()['shadow_pass'])
+
+        Args:
+            ctx (Context): The context.
+
+        Keyword Args:
+            latency (int): The number of frames before the timestamps are resolved.
+            window (int): The number of samples per region the statistics are computed from.
+            max_events (int): The number of regions kept for :py:meth:`Profiler.export_chrome_trace`.
+    '''
+
+    __slots__ = ['_pool', '_latency', '_frame', '_pending', '_samples', '_counts', '_events', '_origin', 'ctx', 'extra']
+
+    def __init__(self, ctx, *, latency=3, window=120, max_events=100000):
+        self._pool = ctx.query_pool()
+        self._latency = latency
+        self._frame = 0
+        self._pending = collections.deque()
+        self._samples = collections.defaultdict(
+            lambda: (collections.deque(maxlen=window), collections.deque(maxlen=window)),
+        )
+        self._counts = collections.Counter()
+        self._events = collections.deque(maxlen=max_events)
+        self._origin = None
+        self.ctx = ctx  #: The context this object belongs to
+        self.extra = None  #: Any - Attribute for storing user defined objects
+
+    def __repr__(self):
+        return '<Profiler: %d regions>' % len(self._samples)
+
+    @property
+    def frame(self) -> int:
+        '''
+            int: The index of the current frame.
+        '''
+
+        return self._frame
+
+    @property
+    def pending(self) -> int:
+        '''
+            int: The number of regions waiting for their GPU timestamps.
+        '''
+
+        return len(self._pending)
+
+    @contextlib.contextmanager
+    def region(self, name, scope=None):
+        '''
+            Profile the commands issued inside a ``with`` block.
+
+            Args:
+                name (str): The name of the region.
+                scope (Scope): A scope entered inside the region.
+        '''
+
+        cpu_start = time.perf_counter_ns()
+        gpu_start = self._pool.timestamp()
+
+        try:
+            if scope is None:
+                yield
+            else:
+                with scope:
+                    yield
+
+        finally:
+            gpu_end = self._pool.timestamp()
+            cpu_end = time.perf_counter_ns()
+            self._pending.append((self._frame, name, cpu_start, cpu_end, gpu_start, gpu_end))
+
+    def next_frame(self) -> None:
+        '''
+            Mark the end of a frame and resolve the regions with available timestamps.
+
+            Regions are resolved in order, a region is skipped until the next frame
+            when its timestamps are not available yet.
+        '''
+
+        self._frame += 1
+        pool = self._pool
+
+        while self._pending:
+            frame, name, cpu_start, cpu_end, gpu_start, gpu_end = self._pending[0]
+
+            if self._frame - frame < self._latency or not pool.available(gpu_end):
+                break
+
+            self._pending.popleft()
+            gpu_start = pool.result(gpu_start)
+            gpu_end = pool.result(gpu_end)
+
+            if self._origin is None:
+                self._origin = (cpu_start, gpu_start)
+
+            cpu_samples, gpu_samples = self._samples[name]
+            cpu_samples.append(cpu_end - cpu_start)
+            gpu_samples.append(gpu_end - gpu_start)
+            self._counts[name] += 1
+            self._events.append((frame, name, cpu_start, cpu_end, gpu_start, gpu_end))
+
+    def stats(self) -> dict:
+        '''
+            The rolling statistics of every region in milliseconds.
+
+            Returns:
+                dict: ``{name: {'count': int, 'cpu': {'min', 'mean', 'p95'}, 'gpu': {'min', 'mean', 'p95'}}}``
+        '''
+
+        def summary(samples):
+            values = sorted(samples)
+            return {
+                'min': values[0] / 1e6,
+                'mean': sum(values) / len(values) / 1e6,
+                'p95': values[max(math.ceil(len(values) * 0.95) - 1, 0)] / 1e6,
+            }
+
+        return {
+            name: {'count': self._counts[name], 'cpu': summary(cpu_samples), 'gpu': summary(gpu_samples)}
+            for name, (cpu_samples, gpu_samples) in self._samples.items()
+        }
+
+    def export_chrome_trace(self, path) -> None:
+        '''
+            Write the resolved regions as a Chrome trace-event JSON file.
+
+            The file can be opened with ``chrome://tracing`` or Perfetto.
+            CPU and GPU regions are on separate tracks, the GPU clock is aligned
+            to the CPU clock at the first resolved region.
+
+            Args:
+                path (str): The output file.
+        '''
+
+        events = []
+
+        if self._origin is not None:
+            cpu_origin, gpu_origin = self._origin
+
+            for frame, name, cpu_start, cpu_end, gpu_start, gpu_end in self._events:
+                for tid, start, end in (('CPU', cpu_start - cpu_origin, cpu_end - cpu_origin),
+                                        ('GPU', gpu_start - gpu_origin, gpu_end - gpu_origin)):
+                    events.append({
+                        'name': name,
+                        'cat': tid.lower(),
+                        'ph': 'X',
+                        'pid': 0,
+                        'tid': tid,
+                        'ts': start / 1e3,
+                        'dur': (end - start) / 1e3,
+                        'args': {'frame': frame},
+                    })
+
+        with open(path, 'w') as f:
+            json.dump({'traceEvents': events, 'displayTimeUnit': 'ms'}, f)
+
+    def reset(self) -> None:
+        '''
+            Drop the statistics, the recorded events and the pending regions.
+        '''
+
+        for frame, name, cpu_start, cpu_end, gpu_start, gpu_end in self._pending:
+            self._pool.discard(gpu_start)
+            self._pool.discard(gpu_end)
+
+        self._pending.clear()
+        self._samples.clear()
+        self._counts.clear()
+        self._events.clear()
+        self._origin = None
+
+    def release(self) -> None:
+        '''
+            Release the query pool of the profiler.
+        '''
+
+        self._pending.clear()
+        self._pool.release()
@@ -29,7 +29,9 @@ class Program:
         performance consider using :py:class:`moderngl.Scope`.
     '''
 
-    __slots__ = ['mglo', '_members', '_subroutines', '_geom', '_glo', '_is_transform', 'ctx', 'extra']
+    __slots__ = [
+        'mglo', '_members', '_subroutines', '_geom', '_glo', '_is_transform', '_pending', '_error', 'ctx', 'extra'
+    ]
 
     def __init__(self):
         self.mglo = None  #: Internal representation for debug purposes only.
@@ -38,6 +40,8 @@ class Program:
         self._geom = (None, None, None)
         self._glo = None
         self._is_transform = None  #: bool: If this is a transform program
+        self._pending = None
+        self._error = None
         self.ctx = None  #: The context this object belongs to
         self.extra = None  #: Any - Attribute for storing user defined objects
         raise TypeError()
@@ -86,6 +90,9 @@ class Program:
             # Still when writing byte data we need to use the `write()` method
             program['color'].write(buffer)
         """
+        if self._pending is not None:
+            self._resolve()
+
         return self._members[key]
 
     def __setitem__(self, key, value):
@@ -103,6 +110,9 @@ class Program:
             uniform = program['cameraMatrix']
             uniform.write(camera_matrix)
         """
+        if self._pending is not None:
+            self._resolve()
+
         self._members[key].value = value
 
     def __iter__(self) -> Generator[str, None, None]:
@@ -142,6 +152,9 @@ class Program:
             {'rotation': <Uniform: 0>, 'scale': <Uniform: 1>}
 
         """
+        if self._pending is not None:
+            self._resolve()
+
         yield from self._members
 
     @property
@@ -161,6 +174,9 @@ class Program:
             This can only be ``POINTS``, ``LINES``, ``LINES_ADJACENCY``, ``TRIANGLES``, ``TRIANGLE_ADJACENCY``.
         '''
 
+        if self._pending is not None:
+            self._resolve()
+
         return self._geom[0]
 
     @property
@@ -173,6 +189,9 @@ class Program:
             (from ``layout(output_primitive​, max_vertices = vert_count) out;``)
         '''
 
+        if self._pending is not None:
+            self._resolve()
+
         return self._geom[1]
 
     @property
@@ -184,6 +203,9 @@ class Program:
             (from ``layout(output_primitive​, max_vertices = vert_count) out;``)
         '''
 
+        if self._pending is not None:
+            self._resolve()
+
         return self._geom[2]
 
     @property
@@ -192,8 +214,23 @@ class Program:
             tuple: The subroutine uniforms.
         '''
 
+        if self._pending is not None:
+            self._resolve()
+
         return self._subroutines
 
+    @property
+    def ready(self) -> bool:
+        '''
+            bool: True if the program was compiled and linked.
+
+            Always ``True`` for programs created with :py:meth:`Context.program`.
+            For programs created with :py:meth:`Context.program_async` this does not block
+            when the driver supports ``GL_KHR_parallel_shader_compile``.
+        '''
+
+        return self._pending is None or self._error is not None or self.mglo.ready
+
     @property
     def glo(self) -> int:
         '''
@@ -215,6 +252,9 @@ class Program:
                 :py:class:`Attribute` or :py:class:`Varying`
         '''
 
+        if self._pending is not None:
+            self._resolve()
+
         return self._members.get(key, default)
 
     def release(self) -> None:
@@ -225,6 +265,70 @@ class Program:
         if not isinstance(self.mglo, InvalidObject):
             self.mglo.release()
 
+    def _resolve(self) -> None:
+        '''
+            Wait for a program created with :py:meth:`Context.program_async`,
+            raise the compiler errors and build the members.
+
+            A program failing to compile or link is released and raises the same error on every use.
+        '''
+
+        if self._error is not None:
+            raise self._error.with_traceback(None)
+
+        cache, key = self._pending
+
+        try:
+            reflection, binary = self.mglo.resolve()
+        except Exception as error:
+            self._error = error
+            self.release()
+            raise
+
+        self._pending = None
+        self._set_reflection(reflection)
+
+        if cache is not None:
+            cache.misses += 1
+            if binary is not None:
+                cache.save(key, binary)
+
+    def _set_reflection(self, reflection) -> None:
+        '''
+            Build the members from the reflection data of the program.
+        '''
+
+        ls1, ls2, ls3, ls4, ls5, self._subroutines, self._geom, self._glo = reflection
+
+        members = {}
+
+        for item in ls1:
+            obj = Attribute.__new__(Attribute)
+            obj.mglo, obj._location, obj._array_length, obj._dimension, obj._shape, obj._name = item
+            members[obj.name] = obj
+
+        for item in ls2:
+            obj = Varying.__new__(Varying)
+            obj._number, obj._array_length, obj._dimension, obj._name = item
+            members[obj.name] = obj
+
+        for item in ls3:
+            obj = Uniform.__new__(Uniform)
+            obj.mglo, obj._location, obj._array_length, obj._dimension, obj._name = item
+            members[obj.name] = obj
+
+        for item in ls4:
+            obj = UniformBlock.__new__(UniformBlock)
+            obj.mglo, obj._index, obj._size, obj._name = item
+            members[obj.name] = obj
+
+        for item in ls5:
+            obj = Subroutine.__new__(Subroutine)
+            obj._index, obj._name = item
+            members[obj.name] = obj
+
+        self._members = members
+
 
 def detect_format(program, attributes, mode='mgl') -> str:
     '''
@@ -0,0 +1,120 @@
+import hashlib
+import logging
+import os
+
+import moderngl
+
+__all__ = ['ProgramCache']
+
+LOG = logging.getLogger(__name__)
+
+
+class ProgramCache:
+    '''
+        An on-disk cache of linked program binaries.
+
+        Assign it to :py:attr:`Context.program_cache` to load programs with
+        ``glProgramBinary`` instead of compiling and linking them from source.
+        Entries are keyed by the shader sources, the varyings, the driver vendor,
+        renderer and version strings and the moderngl version. A binary rejected
+        by the driver is compiled from source and replaced in the cache.
+
+        Example::
+
+            ctx.program_cache = moderngl.ProgramCache('.shader_cache')
+    '''
+
+    __slots__ = ['_path', 'hits', 'misses', 'extra']
+
+    def __init__(self, path):
+        self._path = os.fspath(path)
+        os.makedirs(self._path, exist_ok=True)
+        self.hits = 0  #: int: The number of programs loaded from the cache
+        self.misses = 0  #: int: The number of programs compiled from source
+        self.extra = None  #: Any - Attribute for storing user defined objects
+
+    def __repr__(self):
+        return '<ProgramCache: %s>' % self._path
+
+    @property
+    def path(self) -> str:
+        '''
+            str: The directory of the cache.
+        '''
+
+        return self._path
+
+    def key(self, ctx, shaders, varyings) -> str:
+        '''
+            The cache key of a program.
+
+            Args:
+                ctx (Context): The context. The driver strings are part of the key.
+                shaders (tuple): The shader sources, ``None`` for missing stages.
+                varyings (tuple): The varyings.
+
+            Returns:
+                str: A hex digest.
+        '''
+
+        info = ctx.info
+        digest = hashlib.sha256()
+
+        for item in (moderngl.__version__, info['GL_VENDOR'], info['GL_RENDERER'], info['GL_VERSION']):
+            digest.update(item.encode())
+            digest.update(b'\0')
+
+        for source in shaders:
+            digest.update(b'\1' if source is None else source.encode() + b'\0')
+
+        for name in varyings:
+            digest.update(name.encode())
+            digest.update(b'\0')
+
+        return digest.hexdigest()
+
+    def load(self, key):
+        '''
+            Load a cached binary.
+
+            Args:
+                key (str): The cache key.
+
+            Returns:
+                bytes: The binary or ``None``.
+        '''
+
+        try:
+            with open(os.path.join(self._path, key + '.bin'), 'rb') as f:
+                return f.read()
+        except OSError:
+            return None
+
+    def save(self, key, data) -> None:
+        '''
+            Store a binary. The file is replaced atomically
+            so concurrent workers never read a partial binary.
+
+            Args:
+                key (str): The cache key.
+                data (bytes): The binary.
+        '''
+
+        filename = os.path.join(self._path, key + '.bin')
+        temp = '%s.%d.tmp' % (filename, os.getpid())
+
+        try:
+            with open(temp, 'wb') as f:
+                f.write(data)
+            os.replace(temp, filename)
+        except OSError as e:
+            LOG.warning('cannot write the program cache: %s', e)
+
+    def clear(self) -> None:
+        '''
+            Remove every cached binary.
+        '''
+
+        for name in os.listdir(self._path):
+            if name.endswith('.bin'):
+                os.remove(os.path.join(self._path, name))
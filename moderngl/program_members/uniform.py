@@ -158,6 +158,12 @@ class Uniform:
 
             The value must be a tuple for non array uniforms.
             The value must be a list of tuples for array uniforms.
+
+            Contiguous arrays of the matching scalar type, such as float32 numpy arrays
+            for float uniforms or int32 arrays for int, bool and sampler uniforms,
+            are written without conversion when their size matches the uniform::
+
+                program['bones'].value = np.zeros((128, 4, 4), dtype='f4')
         '''
 
         return self.mglo.value
@@ -0,0 +1,141 @@
+import logging
+from typing import Optional
+
+from moderngl.mgl import InvalidObject  # type: ignore
+
+__all__ = ['QueryPool']
+
+LOG = logging.getLogger(__name__)
+
+
+class QueryPool:
+    '''
+        A pool of query objects recycled across frames.
+
+        Queries are identified by integer handles. A query goes back to the pool
+        when its result is read with :py:meth:`QueryPool.result` or when it is
+        discarded. The pool grows when every query is in use.
+
+        Results are 64-bit, polling :py:meth:`QueryPool.available` or reading
+        the result with ``wait=False`` never stalls the CPU.
+
+        A QueryPool object cannot be instantiated directly, it requires a context.
+        Use :py:meth:`Context.query_pool` to create one.
+    '''
+
+    __slots__ = ['mglo', 'ctx', 'extra']
+
+    def __init__(self):
+        self.mglo = None  #: Internal representation for debug purposes only.
+        self.ctx = None  #: The context this object belongs to
+        self.extra = None  #: Any - Attribute for storing user defined objects
+        raise TypeError()
+
+    def __repr__(self):
+        return '<QueryPool: %d>' % self.mglo.size
+
+    def __hash__(self) -> int:
+        return id(self)
+
+    def __del__(self):
+        LOG.debug(f"{self.__class__.__name__}.__del__ {self}")
+        if hasattr(self, "ctx") and self.ctx.gc_mode == "auto":
+            self.release()
+
+    @property
+    def size(self) -> int:
+        '''
+            int: The number of query objects.
+        '''
+
+        return self.mglo.size
+
+    @property
+    def free(self) -> int:
+        '''
+            int: The number of query objects not in use.
+        '''
+
+        return self.mglo.free
+
+    def begin(self, kind='elapsed') -> int:
+        '''
+            Begin a query.
+
+            Args:
+                kind (str): ``'elapsed'``, ``'samples'``, ``'any_samples'`` or ``'primitives'``.
+
+            Returns:
+                int: The query handle.
+        '''
+
+        return self.mglo.begin(kind)
+
+    def end(self, query) -> None:
+        '''
+            End a query started with :py:meth:`QueryPool.begin`.
+
+            Args:
+                query (int): The query handle.
+        '''
+
+        self.mglo.end(query)
+
+    def timestamp(self) -> int:
+        '''
+            Record the GPU time in nanoseconds when the previous commands are complete.
+
+            Returns:
+                int: The query handle.
+        '''
+
+        return self.mglo.timestamp()
+
+    def available(self, query) -> bool:
+        '''
+            Check if the result of a query is available without blocking.
+
+            Args:
+                query (int): The query handle.
+
+            Returns:
+                bool
+        '''
+
+        return self.mglo.available(query)
+
+    def result(self, query, *, wait=True) -> Optional[int]:
+        '''
+            Read the result of a query and return the query to the pool.
+
+            Args:
+                query (int): The query handle.
+
+            Keyword Args:
+                wait (bool): Block until the result is available.
+                             Otherwise ``None`` is returned and the query is kept.
+
+            Returns:
+                int: The result or ``None``.
+        '''
+
+        return self.mglo.result(query, wait)
+
+    def discard(self, query) -> None:
+        '''
+            Return a query to the pool without reading the result.
+
+            Args:
+                query (int): The query handle.
+        '''
+
+        self.mglo.discard(query)
+
+    def release(self) -> None:
+        '''
+            Release the ModernGL object.
+        '''
+
+        LOG.debug(f"{self.__class__.__name__}.release() {self}")
+        if not isinstance(self.mglo, InvalidObject):
+            self.mglo.release()
@@ -0,0 +1,80 @@
+import logging
+
+from moderngl.mgl import InvalidObject  # type: ignore
+
+__all__ = ['Readback']
+
+LOG = logging.getLogger(__name__)
+
+
+class Readback:
+    '''
+        The handle of an asynchronous framebuffer read.
+
+        The pixels are read into a pixel pack buffer and a fence is placed after the read.
+        The calling thread is not blocked until the pixels are accessed through
+        :py:attr:`Readback.data` or :py:meth:`Readback.wait`.
+
+        A Readback object cannot be instantiated directly.
+        Use :py:meth:`Framebuffer.read_async` to create one.
+    '''
+
+    __slots__ = ['mglo', 'ctx', 'extra']
+
+    def __init__(self):
+        self.mglo = None  #: Internal representation for debug purposes only.
+        self.ctx = None  #: The context this object belongs to
+        self.extra = None  #: Any - Attribute for storing user defined objects
+        raise TypeError()
+
+    def __repr__(self):
+        return '<Readback: %d>' % self.mglo.size
+
+    def __hash__(self) -> int:
+        return id(self)
+
+    @property
+    def size(self) -> int:
+        '''
+            int: The size of the pixel data in bytes.
+        '''
+
+        return self.mglo.size
+
+    @property
+    def data(self) -> memoryview:
+        '''
+            memoryview: Read-only view of the pixels.
+
+            Waits for the read to complete. The view points directly to the mapped
+            pixel pack buffer. Reusing the handle with a later :py:meth:`Framebuffer.read_async`
+            call or releasing it raises :py:exc:`BufferError` until every view is released.
+        '''
+
+        return memoryview(self.mglo)
+
+    def ready(self) -> bool:
+        '''
+            Check if the pixels are available without blocking.
+
+            Returns:
+                bool
+        '''
+
+        return self.mglo.ready()
+
+    def wait(self) -> None:
+        '''
+            Block until the pixels are available.
+        '''
+
+        self.mglo.wait()
+
+    def release(self) -> None:
+        '''
+            Release the ModernGL object.
+        '''
+
+        LOG.debug(f"{self.__class__.__name__}.release() {self}")
+        if not isinstance(self.mglo, InvalidObject):
+            self.mglo.release()
@@ -1,16 +1,97 @@
 #include "Types.hpp"
 
+// Persistent buffers stay mapped for their whole lifetime.
+// Both helpers synchronize like MapBufferRange would, so the python side
+// observes the same behaviour for persistent and regular buffers.
+
+// A buffer can only be mapped once. Nested requests share the active mapping
+// when it covers the requested range with the requested access, otherwise they fail.
+// Every successful MGLBuffer_map must be paired with a MGLBuffer_unmap.
+
+char * MGLBuffer_map(MGLBuffer * self, Py_ssize_t offset, Py_ssize_t size, int access) {
+	const GLMethods & gl = self->context->gl;
+
+	if (self->persistent) {
+		if (!(access & GL_MAP_UNSYNCHRONIZED_BIT)) {
+			gl.Finish();
+		}
+		return self->mapping + offset;
+	}
+
+	if (self->map_count) {
+		const int rw = GL_MAP_READ_BIT | GL_MAP_WRITE_BIT;
+
+		if (offset < self->map_offset || offset + size > self->map_offset + self->map_size) {
+			return 0;
+		}
+
+		if ((access & rw) & ~(self->map_access & rw)) {
+			return 0;
+		}
+
+		self->map_count += 1;
+		return self->map_ptr + (offset - self->map_offset);
+	}
+
+	gl.BindBuffer(GL_ARRAY_BUFFER, self->buffer_obj);
+	char * map = (char *)gl.MapBufferRange(GL_ARRAY_BUFFER, offset, size, access);
+
+	if (!map) {
+		return 0;
+	}
+
+	self->map_ptr = map;
+	self->map_offset = offset;
+	self->map_size = size;
+	self->map_access = access;
+	self->map_count = 1;
+	return map;
+}
+
+void MGLBuffer_unmap(MGLBuffer * self) {
+	if (self->persistent || !self->map_count) {
+		return;
+	}
+
+	self->map_count -= 1;
+
+	if (self->map_count) {
+		return;
+	}
+
+	// The buffer is bound again, the GL_ARRAY_BUFFER binding may have changed since mapping.
+
+	const GLMethods & gl = self->context->gl;
+	gl.BindBuffer(GL_ARRAY_BUFFER, self->buffer_obj);
+	gl.UnmapBuffer(GL_ARRAY_BUFFER);
+	self->map_ptr = 0;
+}
+
+// OpenGL cannot access a buffer while it is mapped without the persistent bit.
+// The methods reading or writing the buffer and the draws sourcing it fail instead.
+
+bool MGLBuffer_check_unmapped(MGLBuffer * self) {
+	if (self->map_count) {
+		MGLError_Set("the buffer is mapped, release its views first");
+		return false;
+	}
+
+	return true;
+}
+
 PyObject * MGLContext_buffer(MGLContext * self, PyObject * args) {
 	PyObject * data;
 	int reserve;
 	int dynamic;
+	int persistent;
 
 	int args_ok = PyArg_ParseTuple(
 		args,
-		"OIp",
+		"OIpp",
 		&data,
 		&reserve,
-		&dynamic
+		&dynamic,
+		&persistent
 	);
 
 	if (!args_ok) {
@@ -27,6 +108,13 @@ PyObject * MGLContext_buffer(MGLContext * self, PyObject * args) {
 		return 0;
 	}
 
+	const GLMethods & gl = self->gl;
+
+	if (persistent && !gl.BufferStorage) {
+		MGLError_Set("persistent buffers require OpenGL 4.4 or GL_ARB_buffer_storage");
+		return 0;
+	}
+
 	Py_buffer buffer_view;
 
 	if (data != Py_None) {
@@ -52,8 +140,15 @@ PyObject * MGLContext_buffer(MGLContext * self, PyObject * args) {
 
 	buffer->size = (int)buffer_view.len;
 	buffer->dynamic = dynamic ? true : false;
+	buffer->persistent = persistent ? true : false;
+	buffer->mapping = 0;
+	buffer->exports = 0;
 
-	const GLMethods & gl = self->gl;
+	buffer->map_ptr = 0;
+	buffer->map_offset = 0;
+	buffer->map_size = 0;
+	buffer->map_access = 0;
+	buffer->map_count = 0;
 
 	buffer->buffer_obj = 0;
 	gl.GenBuffers(1, (GLuint *)&buffer->buffer_obj);
@@ -65,15 +160,29 @@ PyObject * MGLContext_buffer(MGLContext * self, PyObject * args) {
 	}
 
 	gl.BindBuffer(GL_ARRAY_BUFFER, buffer->buffer_obj);
-	gl.BufferData(GL_ARRAY_BUFFER, buffer->size, buffer_view.buf, dynamic ? GL_DYNAMIC_DRAW : GL_STATIC_DRAW);
 
-	Py_INCREF(self);
-	buffer->context = self;
+	if (persistent) {
+		const int flags = GL_MAP_READ_BIT | GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+		gl.BufferStorage(GL_ARRAY_BUFFER, buffer->size, buffer_view.buf, flags | GL_DYNAMIC_STORAGE_BIT);
+		buffer->mapping = (char *)gl.MapBufferRange(GL_ARRAY_BUFFER, 0, buffer->size, flags);
+	} else {
+		gl.BufferData(GL_ARRAY_BUFFER, buffer->size, buffer_view.buf, dynamic ? GL_DYNAMIC_DRAW : GL_STATIC_DRAW);
+	}
 
 	if (data != Py_None) {
 		PyBuffer_Release(&buffer_view);
 	}
 
+	if (persistent && !buffer->mapping) {
+		MGLError_Set("cannot map the buffer");
+		gl.DeleteBuffers(1, (GLuint *)&buffer->buffer_obj);
+		Py_DECREF(buffer);
+		return 0;
+	}
+
+	Py_INCREF(self);
+	buffer->context = self;
+
 	Py_INCREF(buffer);
 
 	PyObject * result = PyTuple_New(3);
@@ -111,6 +220,10 @@ PyObject * MGLBuffer_write(MGLBuffer * self, PyObject * args) {
 		return 0;
 	}
 
+	if (!MGLBuffer_check_unmapped(self)) {
+		return 0;
+	}
+
 	Py_buffer buffer_view;
 
 	int get_buffer = PyObject_GetBuffer(data, &buffer_view, PyBUF_SIMPLE);
@@ -128,6 +241,7 @@ PyObject * MGLBuffer_write(MGLBuffer * self, PyObject * args) {
 	const GLMethods & gl = self->context->gl;
 	gl.BindBuffer(GL_ARRAY_BUFFER, self->buffer_obj);
 	gl.BufferSubData(GL_ARRAY_BUFFER, (GLintptr)offset, buffer_view.len, buffer_view.buf);
+	self->context->stats.bytes_written += buffer_view.len;
 	PyBuffer_Release(&buffer_view);
 	Py_RETURN_NONE;
 }
@@ -147,6 +261,10 @@ PyObject * MGLBuffer_read(MGLBuffer * self, PyObject * args) {
 		return 0;
 	}
 
+	if (!MGLBuffer_check_unmapped(self)) {
+		return 0;
+	}
+
 	if (size < 0) {
 		size = self->size - offset;
 	}
@@ -156,19 +274,17 @@ PyObject * MGLBuffer_read(MGLBuffer * self, PyObject * args) {
 		return 0;
 	}
 
-	const GLMethods & gl = self->context->gl;
-
-	gl.BindBuffer(GL_ARRAY_BUFFER, self->buffer_obj);
-	void * map = gl.MapBufferRange(GL_ARRAY_BUFFER, offset, size, GL_MAP_READ_BIT);
+	char * map = MGLBuffer_map(self, offset, size, GL_MAP_READ_BIT);
 
 	if (!map) {
 		MGLError_Set("cannot map the buffer");
 		return 0;
 	}
 
-	PyObject * data = PyBytes_FromStringAndSize((const char *)map, size);
+	PyObject * data = PyBytes_FromStringAndSize(map, size);
 
-	gl.UnmapBuffer(GL_ARRAY_BUFFER);
+	MGLBuffer_unmap(self);
+	self->context->stats.bytes_read += size;
 
 	return data;
 }
@@ -192,6 +308,10 @@ PyObject * MGLBuffer_read_into(MGLBuffer * self, PyObject * args) {
 		return 0;
 	}
 
+	if (!MGLBuffer_check_unmapped(self)) {
+		return 0;
+	}
+
 	if (size < 0) {
 		size = self->size - offset;
 	}
@@ -215,15 +335,19 @@ PyObject * MGLBuffer_read_into(MGLBuffer * self, PyObject * args) {
 		return 0;
 	}
 
-	const GLMethods & gl = self->context->gl;
+	char * map = MGLBuffer_map(self, offset, size, GL_MAP_READ_BIT);
 
-	gl.BindBuffer(GL_ARRAY_BUFFER, self->buffer_obj);
-	void * map = gl.MapBufferRange(GL_ARRAY_BUFFER, offset, size, GL_MAP_READ_BIT);
+	if (!map) {
+		MGLError_Set("cannot map the buffer");
+		PyBuffer_Release(&buffer_view);
+		return 0;
+	}
 
 	char * ptr = (char *)buffer_view.buf + write_offset;
 	memcpy(ptr, map, size);
 
-	gl.UnmapBuffer(GL_ARRAY_BUFFER);
+	MGLBuffer_unmap(self);
+	self->context->stats.bytes_read += size;
 
 	PyBuffer_Release(&buffer_view);
 	Py_RETURN_NONE;
@@ -248,6 +372,10 @@ PyObject * MGLBuffer_write_chunks(MGLBuffer * self, PyObject * args) {
 		return 0;
 	}
 
+	if (!MGLBuffer_check_unmapped(self)) {
+		return 0;
+	}
+
 	Py_ssize_t abs_step = step > 0 ? step : -step;
 
 	Py_buffer buffer_view;
@@ -258,9 +386,6 @@ PyObject * MGLBuffer_write_chunks(MGLBuffer * self, PyObject * args) {
 		return 0;
 	}
 
-	const GLMethods & gl = self->context->gl;
-	gl.BindBuffer(GL_ARRAY_BUFFER, self->buffer_obj);
-
 	Py_ssize_t chunk_size = buffer_view.len / count;
 
 	if (buffer_view.len != chunk_size * count) {
@@ -279,7 +404,7 @@ PyObject * MGLBuffer_write_chunks(MGLBuffer * self, PyObject * args) {
 		return 0;
 	}
 
-	char * write_ptr = (char *)gl.MapBufferRange(GL_ARRAY_BUFFER, 0, self->size, GL_MAP_WRITE_BIT);
+	char * write_ptr = MGLBuffer_map(self, 0, self->size, GL_MAP_WRITE_BIT);
 	char * read_ptr = (char *)buffer_view.buf;
 
 	if (!write_ptr) {
@@ -295,7 +420,8 @@ PyObject * MGLBuffer_write_chunks(MGLBuffer * self, PyObject * args) {
 		write_ptr += step;
 	}
 
-	gl.UnmapBuffer(GL_ARRAY_BUFFER);
+	MGLBuffer_unmap(self);
+	self->context->stats.bytes_written += chunk_size * count;
 	PyBuffer_Release(&buffer_view);
 	Py_RETURN_NONE;
 }
@@ -319,6 +445,10 @@ PyObject * MGLBuffer_read_chunks(MGLBuffer * self, PyObject * args) {
 		return 0;
 	}
 
+	if (!MGLBuffer_check_unmapped(self)) {
+		return 0;
+	}
+
 	Py_ssize_t abs_step = step > 0 ? step : -step;
 
 	if (start < 0) {
@@ -330,11 +460,7 @@ PyObject * MGLBuffer_read_chunks(MGLBuffer * self, PyObject * args) {
 		return 0;
 	}
 
-	const GLMethods & gl = self->context->gl;
-
-	gl.BindBuffer(GL_ARRAY_BUFFER, self->buffer_obj);
-
-	char * read_ptr = (char *)gl.MapBufferRange(GL_ARRAY_BUFFER, 0, self->size, GL_MAP_READ_BIT);
+	char * read_ptr = MGLBuffer_map(self, 0, self->size, GL_MAP_READ_BIT);
 
 	if (!read_ptr) {
 		MGLError_Set("cannot map the buffer");
@@ -351,7 +477,8 @@ PyObject * MGLBuffer_read_chunks(MGLBuffer * self, PyObject * args) {
 		read_ptr += step;
 	}
 
-	gl.UnmapBuffer(GL_ARRAY_BUFFER);
+	MGLBuffer_unmap(self);
+	self->context->stats.bytes_read += chunk_size * count;
 	return data;
 }
 
@@ -378,6 +505,10 @@ PyObject * MGLBuffer_read_chunks_into(MGLBuffer * self, PyObject * args) {
 		return 0;
 	}
 
+	if (!MGLBuffer_check_unmapped(self)) {
+		return 0;
+	}
+
 	Py_buffer buffer_view;
 
 	int get_buffer = PyObject_GetBuffer(data, &buffer_view, PyBUF_WRITABLE);
@@ -386,15 +517,12 @@ PyObject * MGLBuffer_read_chunks_into(MGLBuffer * self, PyObject * args) {
 		return 0;
 	}
 
-	const GLMethods & gl = self->context->gl;
-
-	gl.BindBuffer(GL_ARRAY_BUFFER, self->buffer_obj);
-
-	char * read_ptr = (char *)gl.MapBufferRange(GL_ARRAY_BUFFER, 0, self->size, GL_MAP_READ_BIT);
+	char * read_ptr = MGLBuffer_map(self, 0, self->size, GL_MAP_READ_BIT);
 	char * write_ptr = (char *)buffer_view.buf + write_offset;
 
 	if (!read_ptr) {
 		MGLError_Set("cannot map the buffer");
+		PyBuffer_Release(&buffer_view);
 		return 0;
 	}
 
@@ -405,11 +533,126 @@ PyObject * MGLBuffer_read_chunks_into(MGLBuffer * self, PyObject * args) {
 		read_ptr += step;
 	}
 
-	gl.UnmapBuffer(GL_ARRAY_BUFFER);
+	MGLBuffer_unmap(self);
+	self->context->stats.bytes_read += chunk_size * count;
 	PyBuffer_Release(&buffer_view);
 	Py_RETURN_NONE;
 }
 
+// The chunk is repeated from the offset. ClearBufferSubData requires the offset and the size
+// to be multiples of the texel size, so it is used only for chunks matching an integer format.
+
+bool MGLBuffer_clear_on_gpu(MGLBuffer * self, Py_ssize_t offset, Py_ssize_t size, const void * chunk, Py_ssize_t chunk_size) {
+	if (!self->context->clear_buffer_object) {
+		return false;
+	}
+
+	int internal_format;
+	int format;
+	int type;
+
+	switch (chunk_size) {
+		case 0:
+		case 1:
+			internal_format = GL_R8UI;
+			format = GL_RED_INTEGER;
+			type = GL_UNSIGNED_BYTE;
+			break;
+
+		case 2:
+			internal_format = GL_R16UI;
+			format = GL_RED_INTEGER;
+			type = GL_UNSIGNED_SHORT;
+			break;
+
+		case 4:
+			internal_format = GL_R32UI;
+			format = GL_RED_INTEGER;
+			type = GL_UNSIGNED_INT;
+			break;
+
+		case 8:
+			internal_format = GL_RG32UI;
+			format = GL_RG_INTEGER;
+			type = GL_UNSIGNED_INT;
+			break;
+
+		case 12:
+			internal_format = GL_RGB32UI;
+			format = GL_RGB_INTEGER;
+			type = GL_UNSIGNED_INT;
+			break;
+
+		case 16:
+			internal_format = GL_RGBA32UI;
+			format = GL_RGBA_INTEGER;
+			type = GL_UNSIGNED_INT;
+			break;
+
+		default:
+			return false;
+	}
+
+	if (chunk_size && offset % chunk_size) {
+		return false;
+	}
+
+	// A null chunk fills the range with zeros.
+
+	const GLMethods & gl = self->context->gl;
+	gl.BindBuffer(GL_ARRAY_BUFFER, self->buffer_obj);
+	gl.ClearBufferSubData(GL_ARRAY_BUFFER, internal_format, offset, size, format, type, chunk_size ? chunk : 0);
+	return true;
+}
+
+// The pattern is expanded with doubling memcpy calls into a block of the context scratch memory,
+// the block is then copied to the mapping. The mapping is never read, it may be write-combined memory.
+
+bool MGLBuffer_clear_on_cpu(MGLBuffer * self, Py_ssize_t offset, Py_ssize_t size, const char * chunk, Py_ssize_t chunk_size) {
+	int access = GL_MAP_WRITE_BIT | (self->persistent ? 0 : GL_MAP_INVALIDATE_RANGE_BIT);
+	char * map = MGLBuffer_map(self, offset, size, access);
+
+	if (!map) {
+		MGLError_Set("cannot map the buffer");
+		return false;
+	}
+
+	if (!chunk_size) {
+		memset(map, 0, size);
+		MGLBuffer_unmap(self);
+		return true;
+	}
+
+	Py_ssize_t block_size = 65536 / chunk_size * chunk_size;
+	if (block_size < chunk_size) {
+		block_size = chunk_size;
+	}
+	if (block_size > size) {
+		block_size = size;
+	}
+
+	char * block = (char *)MGLContext_scratch(self->context, block_size);
+
+	if (!block) {
+		MGLBuffer_unmap(self);
+		return false;
+	}
+
+	memcpy(block, chunk, chunk_size);
+
+	for (Py_ssize_t filled = chunk_size; filled < block_size; filled *= 2) {
+		memcpy(block + filled, block, filled < block_size - filled ? filled : block_size - filled);
+	}
+
+	for (Py_ssize_t i = 0; i < size; i += block_size) {
+		memcpy(map + i, block, block_size < size - i ? block_size : size - i);
+	}
+
+	MGLContext_release_scratch(self->context, block);
+	MGLBuffer_unmap(self);
+	return true;
+}
+
 PyObject * MGLBuffer_clear(MGLBuffer * self, PyObject * args) {
 	Py_ssize_t size;
 	Py_ssize_t offset;
@@ -427,6 +670,10 @@ PyObject * MGLBuffer_clear(MGLBuffer * self, PyObject * args) {
 		return 0;
 	}
 
+	if (!MGLBuffer_check_unmapped(self)) {
+		return 0;
+	}
+
 	if (size < 0) {
 		size = self->size - offset;
 	}
@@ -440,7 +687,7 @@ PyObject * MGLBuffer_clear(MGLBuffer * self, PyObject * args) {
 			return 0;
 		}
 
-		if (size % buffer_view.len != 0) {
+		if (!buffer_view.len || size % buffer_view.len != 0) {
 			MGLError_Set("the chunk does not fit the size");
 			PyBuffer_Release(&buffer_view);
 			return 0;
@@ -450,33 +697,35 @@ PyObject * MGLBuffer_clear(MGLBuffer * self, PyObject * args) {
 		buffer_view.buf = 0;
 	}
 
-	const GLMethods & gl = self->context->gl;
-	gl.BindBuffer(GL_ARRAY_BUFFER, self->buffer_obj);
-
-	char * map = (char *)gl.MapBufferRange(GL_ARRAY_BUFFER, offset, size, GL_MAP_WRITE_BIT);
-
-	if (!map) {
-		MGLError_Set("cannot map the buffer");
+	if (offset < 0 || offset + size > self->size) {
+		MGLError_Set("out of range offset = %d or size = %d", offset, size);
+		if (chunk != Py_None) {
+			PyBuffer_Release(&buffer_view);
+		}
 		return 0;
 	}
 
-	if (buffer_view.len) {
-		char * src = (char *)buffer_view.buf;
-		Py_ssize_t divisor = buffer_view.len;
-
-		for (Py_ssize_t i = 0; i < size; ++i) {
-			map[i] = src[i % divisor];
+	if (!size) {
+		if (chunk != Py_None) {
+			PyBuffer_Release(&buffer_view);
 		}
-	} else {
-		memset(map + offset, 0, size);
+		Py_RETURN_NONE;
 	}
 
-	gl.UnmapBuffer(GL_ARRAY_BUFFER);
+	bool cleared = MGLBuffer_clear_on_gpu(self, offset, size, buffer_view.buf, buffer_view.len);
+
+	if (!cleared) {
+		cleared = MGLBuffer_clear_on_cpu(self, offset, size, (const char *)buffer_view.buf, buffer_view.len);
+	}
 
 	if (chunk != Py_None) {
 		PyBuffer_Release(&buffer_view);
 	}
 
+	if (!cleared) {
+		return 0;
+	}
+
 	Py_RETURN_NONE;
 }
 
@@ -493,6 +742,15 @@ PyObject * MGLBuffer_orphan(MGLBuffer * self, PyObject * args) {
 		return 0;
 	}
 
+	if (self->persistent) {
+		MGLError_Set("persistent buffers cannot be orphaned");
+		return 0;
+	}
+
+	if (!MGLBuffer_check_unmapped(self)) {
+		return 0;
+	}
+
 	if (size > 0) {
 		self->size = size;
 	}
@@ -524,8 +782,7 @@ PyObject * MGLBuffer_bind_to_uniform_block(MGLBuffer * self, PyObject * args) {
 		size = self->size - offset;
 	}
 
-	const GLMethods & gl = self->context->gl;
-	gl.BindBufferRange(GL_UNIFORM_BUFFER, binding, self->buffer_obj, offset, size);
+	MGLContext_bind_buffer_range(self->context, GL_UNIFORM_BUFFER, binding, self->buffer_obj, offset, size);
 	Py_RETURN_NONE;
 }
 
@@ -550,12 +807,23 @@ PyObject * MGLBuffer_bind_to_storage_buffer(MGLBuffer * self, PyObject * args) {
 		size = self->size - offset;
 	}
 
-	const GLMethods & gl = self->context->gl;
-	gl.BindBufferRange(GL_SHADER_STORAGE_BUFFER, binding, self->buffer_obj, offset, size);
+	MGLContext_bind_buffer_range(self->context, GL_SHADER_STORAGE_BUFFER, binding, self->buffer_obj, offset, size);
 	Py_RETURN_NONE;
 }
 
+PyObject * MGLBuffer_view(MGLBuffer * self, PyObject * args);
+
 PyObject * MGLBuffer_release(MGLBuffer * self) {
+	if (self->exports) {
+		PyErr_Format(PyExc_BufferError, "Cannot release the buffer while its mapping is in use by memoryviews");
+		return 0;
+	}
+
+	if (self->map_count) {
+		PyErr_Format(PyExc_BufferError, "Cannot release the buffer while it is mapped by views");
+		return 0;
+	}
+
 	MGLBuffer_Invalidate(self);
 	Py_RETURN_NONE;
 }
@@ -577,15 +845,34 @@ PyMethodDef MGLBuffer_tp_methods[] = {
 	{"bind_to_storage_buffer", (PyCFunction)MGLBuffer_bind_to_storage_buffer, METH_VARARGS, 0},
 	{"release", (PyCFunction)MGLBuffer_release, METH_NOARGS, 0},
 	{"size", (PyCFunction)MGLBuffer_size, METH_NOARGS, 0},
+	{"view", (PyCFunction)MGLBuffer_view, METH_VARARGS, 0},
 	{0},
 };
 
+// The exported bytes are counted as written for writable views and as read otherwise.
+
+void MGLBuffer_count_export(MGLContext * context, Py_ssize_t size, int flags) {
+	if (flags & PyBUF_WRITABLE) {
+		context->stats.bytes_written += size;
+	} else {
+		context->stats.bytes_read += size;
+	}
+}
+
 int MGLBuffer_tp_as_buffer_get_view(MGLBuffer * self, Py_buffer * view, int flags) {
-	int access = (flags == PyBUF_SIMPLE) ? GL_MAP_READ_BIT : (GL_MAP_READ_BIT | GL_MAP_WRITE_BIT);
+	if (self->persistent) {
+		if (PyBuffer_FillInfo(view, (PyObject *)self, self->mapping, self->size, 0, flags) < 0) {
+			return -1;
+		}
 
-	const GLMethods & gl = self->context->gl;
-	gl.BindBuffer(GL_ARRAY_BUFFER, self->buffer_obj);
-	void * map = gl.MapBufferRange(GL_ARRAY_BUFFER, 0, self->size, access);
+		MGLBuffer_count_export(self->context, self->size, flags);
+		self->exports += 1;
+		return 0;
+	}
+
+	int access = (flags & PyBUF_WRITABLE) ? (GL_MAP_READ_BIT | GL_MAP_WRITE_BIT) : GL_MAP_READ_BIT;
+
+	char * map = MGLBuffer_map(self, 0, self->size, access);
 
 	if (!map) {
 		PyErr_Format(PyExc_BufferError, "Cannot map buffer");
@@ -593,24 +880,21 @@ int MGLBuffer_tp_as_buffer_get_view(MGLBuffer * self, Py_buffer * view, int flag
 		return -1;
 	}
 
-	view->buf = map;
-	view->len = self->size;
-	view->itemsize = 1;
-
-	view->format = 0;
-	view->ndim = 0;
-	view->shape = 0;
-	view->strides = 0;
-	view->suboffsets = 0;
+	if (PyBuffer_FillInfo(view, (PyObject *)self, map, self->size, 0, flags) < 0) {
+		return -1;
+	}
 
-	Py_INCREF(self);
-	view->obj = (PyObject *)self;
+	MGLBuffer_count_export(self->context, self->size, flags);
 	return 0;
 }
 
 void MGLBuffer_tp_as_buffer_release_view(MGLBuffer * self, Py_buffer * view) {
-	const GLMethods & gl = self->context->gl;
-	gl.UnmapBuffer(GL_ARRAY_BUFFER);
+	if (self->persistent) {
+		self->exports -= 1;
+		return;
+	}
+
+	MGLBuffer_unmap(self);
 }
 
 PyBufferProcs MGLBuffer_tp_as_buffer = {
@@ -665,7 +949,17 @@ void MGLBuffer_Invalidate(MGLBuffer * buffer) {
 	}
 
 	const GLMethods & gl = buffer->context->gl;
+
+	if (buffer->persistent || buffer->map_count) {
+		gl.BindBuffer(GL_ARRAY_BUFFER, buffer->buffer_obj);
+		gl.UnmapBuffer(GL_ARRAY_BUFFER);
+		buffer->mapping = 0;
+		buffer->map_ptr = 0;
+		buffer->map_count = 0;
+	}
+
 	gl.DeleteBuffers(1, (GLuint *)&buffer->buffer_obj);
+	MGLContext_forget_buffer(buffer->context, buffer->buffer_obj);
 
 	Py_TYPE(buffer) = &MGLInvalidObject_Type;
 	Py_DECREF(buffer->context);
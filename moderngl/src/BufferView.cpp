@@ -0,0 +1,331 @@
+#include "Types.hpp"
+
+struct MGLViewFormat {
+	const char * dtype;
+	const char * format;
+	Py_ssize_t itemsize;
+};
+
+static MGLViewFormat view_formats[] = {
+	{"f2", "e", 2},
+	{"f4", "f", 4},
+	{"f8", "d", 8},
+	{"u1", "B", 1},
+	{"u2", "H", 2},
+	{"u4", "I", 4},
+	{"u8", "Q", 8},
+	{"i1", "b", 1},
+	{"i2", "h", 2},
+	{"i4", "i", 4},
+	{"i8", "q", 8},
+	{0},
+};
+
+PyObject * MGLBuffer_view(MGLBuffer * self, PyObject * args) {
+	Py_ssize_t offset;
+	Py_ssize_t size;
+	const char * dtype;
+	PyObject * shape;
+	const char * access_str;
+	int invalidate;
+	int unsynchronized;
+
+	int args_ok = PyArg_ParseTuple(
+		args,
+		"nnsOspp",
+		&offset,
+		&size,
+		&dtype,
+		&shape,
+		&access_str,
+		&invalidate,
+		&unsynchronized
+	);
+
+	if (!args_ok) {
+		return 0;
+	}
+
+	MGLViewFormat * view_format = 0;
+
+	for (int i = 0; view_formats[i].dtype; ++i) {
+		if (!strcmp(dtype, view_formats[i].dtype)) {
+			view_format = &view_formats[i];
+			break;
+		}
+	}
+
+	if (!view_format) {
+		MGLError_Set("invalid dtype: %s", dtype);
+		return 0;
+	}
+
+	int access = 0;
+
+	for (int i = 0; access_str[i]; ++i) {
+		switch (access_str[i]) {
+			case 'r':
+				access |= GL_MAP_READ_BIT;
+				break;
+
+			case 'w':
+				access |= GL_MAP_WRITE_BIT;
+				break;
+
+			default:
+				MGLError_Set("invalid access: %s", access_str);
+				return 0;
+		}
+	}
+
+	if (!access) {
+		MGLError_Set("invalid access: %s", access_str);
+		return 0;
+	}
+
+	if (invalidate || unsynchronized) {
+		if (access & GL_MAP_READ_BIT) {
+			MGLError_Set("invalidate and unsynchronized require write only access");
+			return 0;
+		}
+
+		if (invalidate) {
+			access |= GL_MAP_INVALIDATE_RANGE_BIT;
+		}
+
+		if (unsynchronized) {
+			access |= GL_MAP_UNSYNCHRONIZED_BIT;
+		}
+	}
+
+	int ndim = 1;
+	int unknown = -1;
+	Py_ssize_t dims[8];
+
+	if (shape != Py_None) {
+		if (Py_TYPE(shape) != &PyTuple_Type) {
+			MGLError_Set("the shape must be a tuple not %s", Py_TYPE(shape)->tp_name);
+			return 0;
+		}
+
+		ndim = (int)PyTuple_GET_SIZE(shape);
+
+		if (ndim < 1 || ndim > 8) {
+			MGLError_Set("the shape must have 1 to 8 dimensions not %d", ndim);
+			return 0;
+		}
+
+		for (int i = 0; i < ndim; ++i) {
+			dims[i] = PyLong_AsSsize_t(PyTuple_GET_ITEM(shape, i));
+
+			if (dims[i] == -1 && PyErr_Occurred()) {
+				// Propagate the default error
+				return 0;
+			}
+
+			if (dims[i] == -1 && unknown < 0) {
+				unknown = i;
+				continue;
+			}
+
+			if (dims[i] < 0) {
+				MGLError_Set("invalid shape");
+				return 0;
+			}
+		}
+	} else {
+		unknown = 0;
+	}
+
+	Py_ssize_t known_size = view_format->itemsize;
+
+	for (int i = 0; i < ndim; ++i) {
+		if (i != unknown) {
+			known_size *= dims[i];
+		}
+	}
+
+	if (size < 0) {
+		size = unknown < 0 ? known_size : self->size - offset;
+	}
+
+	if (offset < 0 || size < 0 || offset + size > self->size) {
+		MGLError_Set("out of range offset = %d or size = %d", offset, size);
+		return 0;
+	}
+
+	if (unknown >= 0) {
+		if (!known_size || size % known_size) {
+			MGLError_Set("the size %d is not a multiple of %d", size, known_size);
+			return 0;
+		}
+
+		dims[unknown] = size / known_size;
+		known_size = size;
+	}
+
+	if (known_size != size) {
+		MGLError_Set("the shape does not match the size %d", size);
+		return 0;
+	}
+
+	MGLBufferView * view = (MGLBufferView *)MGLBufferView_Type.tp_alloc(&MGLBufferView_Type, 0);
+
+	view->offset = offset;
+	view->size = size;
+	view->access = access;
+	view->format = view_format->format;
+	view->itemsize = view_format->itemsize;
+	view->ndim = ndim;
+	view->shape = new Py_ssize_t[ndim];
+	view->strides = new Py_ssize_t[ndim];
+
+	for (int i = 0; i < ndim; ++i) {
+		view->shape[i] = dims[i];
+	}
+
+	// C-contiguous strides
+
+	Py_ssize_t stride = view->itemsize;
+	for (int i = ndim - 1; i >= 0; --i) {
+		view->strides[i] = stride;
+		stride *= view->shape[i];
+	}
+
+	Py_INCREF(self);
+	view->buffer = self;
+
+	return (PyObject *)view;
+}
+
+PyObject * MGLBufferView_tp_new(PyTypeObject * type, PyObject * args, PyObject * kwargs) {
+	MGLBufferView * self = (MGLBufferView *)type->tp_alloc(type, 0);
+
+	if (self) {
+	}
+
+	return (PyObject *)self;
+}
+
+void MGLBufferView_tp_dealloc(MGLBufferView * self) {
+	delete[] self->shape;
+	delete[] self->strides;
+	Py_XDECREF(self->buffer);
+	MGLBufferView_Type.tp_free((PyObject *)self);
+}
+
+// Every export maps the range of the view, nested exports share the mapping of the buffer.
+// The range is unmapped when the last export is released, the buffer cannot be released before.
+
+int MGLBufferView_tp_as_buffer_get_view(MGLBufferView * self, Py_buffer * view, int flags) {
+	MGLBuffer * buffer = self->buffer;
+
+	if (Py_TYPE(buffer) == &MGLInvalidObject_Type) {
+		PyErr_Format(PyExc_BufferError, "The buffer was released");
+		view->obj = 0;
+		return -1;
+	}
+
+	if ((flags & PyBUF_WRITABLE) && !(self->access & GL_MAP_WRITE_BIT)) {
+		PyErr_Format(PyExc_BufferError, "The view is read only");
+		view->obj = 0;
+		return -1;
+	}
+
+	char * map = MGLBuffer_map(buffer, self->offset, self->size, self->access);
+
+	if (!map) {
+		if (buffer->map_count) {
+			PyErr_Format(PyExc_BufferError, "Cannot map buffer, it is already mapped with a different range or access");
+		} else {
+			PyErr_Format(PyExc_BufferError, "Cannot map buffer");
+		}
+		view->obj = 0;
+		return -1;
+	}
+
+	view->buf = map;
+	view->len = self->size;
+	view->readonly = (self->access & GL_MAP_WRITE_BIT) ? 0 : 1;
+	view->itemsize = self->itemsize;
+	view->format = (flags & PyBUF_FORMAT) ? (char *)self->format : 0;
+	view->ndim = self->ndim;
+	view->shape = (flags & PyBUF_ND) == PyBUF_ND ? self->shape : 0;
+	view->strides = (flags & PyBUF_STRIDES) == PyBUF_STRIDES ? self->strides : 0;
+	view->suboffsets = 0;
+	view->internal = 0;
+
+	MGLBuffer_count_export(buffer->context, self->size, flags);
+
+	Py_INCREF(self);
+	view->obj = (PyObject *)self;
+	return 0;
+}
+
+void MGLBufferView_tp_as_buffer_release_view(MGLBufferView * self, Py_buffer * view) {
+	if (Py_TYPE(self->buffer) == &MGLInvalidObject_Type) {
+		return;
+	}
+
+	MGLBuffer_unmap(self->buffer);
+}
+
+PyBufferProcs MGLBufferView_tp_as_buffer = {
+	(getbufferproc)MGLBufferView_tp_as_buffer_get_view,              // getbufferproc bf_getbuffer
+	(releasebufferproc)MGLBufferView_tp_as_buffer_release_view,      // releasebufferproc bf_releasebuffer
+};
+
+PyObject * MGLBufferView_get_offset(MGLBufferView * self) {
+	return PyLong_FromSsize_t(self->offset);
+}
+
+PyObject * MGLBufferView_get_size(MGLBufferView * self) {
+	return PyLong_FromSsize_t(self->size);
+}
+
+PyGetSetDef MGLBufferView_tp_getseters[] = {
+	{(char *)"offset", (getter)MGLBufferView_get_offset, 0, 0, 0},
+	{(char *)"size", (getter)MGLBufferView_get_size, 0, 0, 0},
+	{0},
+};
+
+PyTypeObject MGLBufferView_Type = {
+	PyVarObject_HEAD_INIT(0, 0)
+	"mgl.BufferView",                                       // tp_name
+	sizeof(MGLBufferView),                                  // tp_basicsize
+	0,                                                      // tp_itemsize
+	(destructor)MGLBufferView_tp_dealloc,                   // tp_dealloc
+	0,                                                      // tp_print
+	0,                                                      // tp_getattr
+	0,                                                      // tp_setattr
+	0,                                                      // tp_reserved
+	0,                                                      // tp_repr
+	0,                                                      // tp_as_number
+	0,                                                      // tp_as_sequence
+	0,                                                      // tp_as_mapping
+	0,                                                      // tp_hash
+	0,                                                      // tp_call
+	0,                                                      // tp_str
+	0,                                                      // tp_getattro
+	0,                                                      // tp_setattro
+	&MGLBufferView_tp_as_buffer,                            // tp_as_buffer
+	Py_TPFLAGS_DEFAULT,                                     // tp_flags
+	0,                                                      // tp_doc
+	0,                                                      // tp_traverse
+	0,                                                      // tp_clear
+	0,                                                      // tp_richcompare
+	0,                                                      // tp_weaklistoffset
+	0,                                                      // tp_iter
+	0,                                                      // tp_iternext
+	0,                                                      // tp_methods
+	0,                                                      // tp_members
+	MGLBufferView_tp_getseters,                             // tp_getset
+	0,                                                      // tp_base
+	0,                                                      // tp_dict
+	0,                                                      // tp_descr_get
+	0,                                                      // tp_descr_set
+	0,                                                      // tp_dictoffset
+	0,                                                      // tp_init
+	0,                                                      // tp_alloc
+	MGLBufferView_tp_new,                                   // tp_new
+};
@@ -0,0 +1,613 @@
+#include "Types.hpp"
+
+#include "UniformGetSetters.hpp"
+
+extern PyObject * MGLFramebuffer_use(MGLFramebuffer * self);
+extern PyObject * MGLScope_begin(MGLScope * self);
+extern PyObject * MGLScope_end(MGLScope * self);
+
+PyObject * MGLContext_command_list(MGLContext * self, PyObject * args) {
+	int args_ok = PyArg_ParseTuple(
+		args,
+		""
+	);
+
+	if (!args_ok) {
+		return 0;
+	}
+
+	MGLCommandList * command_list = (MGLCommandList *)MGLCommandList_Type.tp_alloc(&MGLCommandList_Type, 0);
+
+	command_list->commands = 0;
+	command_list->num_commands = 0;
+	command_list->commands_capacity = 0;
+
+	command_list->blob = 0;
+	command_list->blob_size = 0;
+	command_list->blob_capacity = 0;
+
+	Py_INCREF(self);
+	command_list->context = self;
+
+	Py_INCREF(command_list);
+
+	return (PyObject *)command_list;
+}
+
+PyObject * MGLCommandList_tp_new(PyTypeObject * type, PyObject * args, PyObject * kwargs) {
+	MGLCommandList * self = (MGLCommandList *)type->tp_alloc(type, 0);
+
+	if (self) {
+	}
+
+	return (PyObject *)self;
+}
+
+void MGLCommandList_tp_dealloc(MGLCommandList * self) {
+	MGLCommandList_Type.tp_free((PyObject *)self);
+}
+
+// Appends a command and returns its index. The object reference is stolen.
+
+int MGLCommandList_append(MGLCommandList * self, int type, PyObject * object) {
+	if (self->num_commands == self->commands_capacity) {
+		int capacity = self->commands_capacity ? self->commands_capacity * 2 : 16;
+		self->commands = (MGLCommand *)realloc(self->commands, capacity * sizeof(MGLCommand));
+		self->commands_capacity = capacity;
+	}
+
+	MGLCommand & command = self->commands[self->num_commands];
+	memset(&command, 0, sizeof(MGLCommand));
+	command.type = type;
+	command.object = object;
+	return self->num_commands++;
+}
+
+PyObject * MGLCommandList_scope(MGLCommandList * self, PyObject * args) {
+	MGLScope * scope;
+	int begin;
+
+	int args_ok = PyArg_ParseTuple(
+		args,
+		"O!p",
+		&MGLScope_Type,
+		&scope,
+		&begin
+	);
+
+	if (!args_ok) {
+		return 0;
+	}
+
+	Py_INCREF(scope);
+	int index = MGLCommandList_append(self, begin ? MGL_COMMAND_SCOPE_BEGIN : MGL_COMMAND_SCOPE_END, (PyObject *)scope);
+	return PyLong_FromLong(index);
+}
+
+PyObject * MGLCommandList_framebuffer(MGLCommandList * self, PyObject * args) {
+	MGLFramebuffer * framebuffer;
+
+	int args_ok = PyArg_ParseTuple(
+		args,
+		"O!",
+		&MGLFramebuffer_Type,
+		&framebuffer
+	);
+
+	if (!args_ok) {
+		return 0;
+	}
+
+	Py_INCREF(framebuffer);
+	int index = MGLCommandList_append(self, MGL_COMMAND_FRAMEBUFFER, (PyObject *)framebuffer);
+	return PyLong_FromLong(index);
+}
+
+PyObject * MGLCommandList_texture(MGLCommandList * self, PyObject * args) {
+	PyObject * texture;
+	int location;
+
+	int args_ok = PyArg_ParseTuple(
+		args,
+		"OI",
+		&texture,
+		&location
+	);
+
+	if (!args_ok) {
+		return 0;
+	}
+
+	int target;
+	int texture_obj;
+
+	if (Py_TYPE(texture) == &MGLTexture_Type) {
+		target = ((MGLTexture *)texture)->samples ? GL_TEXTURE_2D_MULTISAMPLE : GL_TEXTURE_2D;
+		texture_obj = ((MGLTexture *)texture)->texture_obj;
+	} else if (Py_TYPE(texture) == &MGLTexture3D_Type) {
+		target = GL_TEXTURE_3D;
+		texture_obj = ((MGLTexture3D *)texture)->texture_obj;
+	} else if (Py_TYPE(texture) == &MGLTextureArray_Type) {
+		target = GL_TEXTURE_2D_ARRAY;
+		texture_obj = ((MGLTextureArray *)texture)->texture_obj;
+	} else if (Py_TYPE(texture) == &MGLTextureCube_Type) {
+		target = GL_TEXTURE_CUBE_MAP;
+		texture_obj = ((MGLTextureCube *)texture)->texture_obj;
+	} else {
+		MGLError_Set("invalid texture type %s", Py_TYPE(texture)->tp_name);
+		return 0;
+	}
+
+	Py_INCREF(texture);
+	int index = MGLCommandList_append(self, MGL_COMMAND_TEXTURE, texture);
+	self->commands[index].params[0] = location;
+	self->commands[index].params[1] = target;
+	self->commands[index].params[2] = texture_obj;
+	return PyLong_FromLong(index);
+}
+
+PyObject * MGLCommandList_sampler(MGLCommandList * self, PyObject * args) {
+	MGLSampler * sampler;
+	int location;
+
+	int args_ok = PyArg_ParseTuple(
+		args,
+		"O!I",
+		&MGLSampler_Type,
+		&sampler,
+		&location
+	);
+
+	if (!args_ok) {
+		return 0;
+	}
+
+	Py_INCREF(sampler);
+	int index = MGLCommandList_append(self, MGL_COMMAND_SAMPLER, (PyObject *)sampler);
+	self->commands[index].params[0] = location;
+	self->commands[index].params[1] = sampler->sampler_obj;
+	return PyLong_FromLong(index);
+}
+
+PyObject * MGLCommandList_buffer(MGLCommandList * self, PyObject * args) {
+	MGLBuffer * buffer;
+	int storage;
+	int binding;
+	Py_ssize_t offset;
+	Py_ssize_t size;
+
+	int args_ok = PyArg_ParseTuple(
+		args,
+		"O!pInn",
+		&MGLBuffer_Type,
+		&buffer,
+		&storage,
+		&binding,
+		&offset,
+		&size
+	);
+
+	if (!args_ok) {
+		return 0;
+	}
+
+	if (size < 0) {
+		size = buffer->size - offset;
+	}
+
+	if (offset < 0 || offset + size > buffer->size) {
+		MGLError_Set("out of range offset = %d or size = %d", offset, size);
+		return 0;
+	}
+
+	Py_INCREF(buffer);
+	int index = MGLCommandList_append(self, MGL_COMMAND_BUFFER, (PyObject *)buffer);
+	self->commands[index].params[0] = storage ? GL_SHADER_STORAGE_BUFFER : GL_UNIFORM_BUFFER;
+	self->commands[index].params[1] = binding;
+	self->commands[index].offset = offset;
+	self->commands[index].size = size;
+	return PyLong_FromLong(index);
+}
+
+PyObject * MGLCommandList_uniform(MGLCommandList * self, PyObject * args) {
+	MGLUniform * uniform;
+	PyObject * data;
+
+	int args_ok = PyArg_ParseTuple(
+		args,
+		"O!O",
+		&MGLUniform_Type,
+		&uniform,
+		&data
+	);
+
+	if (!args_ok) {
+		return 0;
+	}
+
+	Py_buffer buffer_view;
+
+	int get_buffer = PyObject_GetBuffer(data, &buffer_view, PyBUF_SIMPLE);
+	if (get_buffer < 0) {
+		// Propagate the default error
+		return 0;
+	}
+
+	Py_ssize_t size = uniform->array_length * uniform->element_size;
+
+	if (buffer_view.len != size) {
+		MGLError_Set("data size mismatch %d != %d", buffer_view.len, size);
+		PyBuffer_Release(&buffer_view);
+		return 0;
+	}
+
+	// The uniform data is stored by offset, the blob may be reallocated while recording.
+
+	if (self->blob_size + size > self->blob_capacity) {
+		Py_ssize_t capacity = self->blob_capacity ? self->blob_capacity : 256;
+		while (capacity < self->blob_size + size) {
+			capacity *= 2;
+		}
+		self->blob = (char *)realloc(self->blob, capacity);
+		self->blob_capacity = capacity;
+	}
+
+	memcpy(self->blob + self->blob_size, buffer_view.buf, size);
+	PyBuffer_Release(&buffer_view);
+
+	Py_INCREF(uniform);
+	int index = MGLCommandList_append(self, MGL_COMMAND_UNIFORM, (PyObject *)uniform);
+	self->commands[index].offset = self->blob_size;
+	self->commands[index].size = size;
+	self->blob_size += size;
+	return PyLong_FromLong(index);
+}
+
+PyObject * MGLCommandList_enable(MGLCommandList * self, PyObject * args) {
+	int flags;
+
+	int args_ok = PyArg_ParseTuple(
+		args,
+		"i",
+		&flags
+	);
+
+	if (!args_ok) {
+		return 0;
+	}
+
+	int index = MGLCommandList_append(self, MGL_COMMAND_ENABLE, 0);
+	self->commands[index].params[0] = flags;
+	return PyLong_FromLong(index);
+}
+
+PyObject * MGLCommandList_render(MGLCommandList * self, PyObject * args) {
+	MGLVertexArray * vertex_array;
+	int mode;
+	int vertices;
+	int first;
+	int instances;
+
+	int args_ok = PyArg_ParseTuple(
+		args,
+		"O!IIII",
+		&MGLVertexArray_Type,
+		&vertex_array,
+		&mode,
+		&vertices,
+		&first,
+		&instances
+	);
+
+	if (!args_ok) {
+		return 0;
+	}
+
+	if (vertices < 0) {
+		if (vertex_array->num_vertices < 0) {
+			MGLError_Set("cannot detect the number of vertices");
+			return 0;
+		}
+
+		vertices = vertex_array->num_vertices;
+	}
+
+	if (instances < 0) {
+		instances = vertex_array->num_instances;
+	}
+
+	Py_INCREF(vertex_array);
+	int index = MGLCommandList_append(self, MGL_COMMAND_RENDER, (PyObject *)vertex_array);
+	self->commands[index].params[0] = mode;
+	self->commands[index].params[1] = vertices;
+	self->commands[index].params[2] = first;
+	self->commands[index].params[3] = instances;
+	return PyLong_FromLong(index);
+}
+
+PyObject * MGLCommandList_render_indirect(MGLCommandList * self, PyObject * args) {
+	MGLVertexArray * vertex_array;
+	MGLBuffer * buffer;
+	int mode;
+	int count;
+	int first;
+
+	int args_ok = PyArg_ParseTuple(
+		args,
+		"O!O!III",
+		&MGLVertexArray_Type,
+		&vertex_array,
+		&MGLBuffer_Type,
+		&buffer,
+		&mode,
+		&count,
+		&first
+	);
+
+	if (!args_ok) {
+		return 0;
+	}
+
+	if (count < 0) {
+		count = (int)(buffer->size / 20 - first);
+	}
+
+	Py_INCREF(vertex_array);
+	Py_INCREF(buffer);
+	int index = MGLCommandList_append(self, MGL_COMMAND_RENDER_INDIRECT, (PyObject *)vertex_array);
+	self->commands[index].indirect_buffer = buffer;
+	self->commands[index].params[0] = mode;
+	self->commands[index].params[1] = count;
+	self->commands[index].params[2] = first;
+	return PyLong_FromLong(index);
+}
+
+PyObject * MGLCommandList_write_uniform(MGLCommandList * self, PyObject * args) {
+	int index;
+	PyObject * data;
+
+	int args_ok = PyArg_ParseTuple(
+		args,
+		"IO",
+		&index,
+		&data
+	);
+
+	if (!args_ok) {
+		return 0;
+	}
+
+	if (index < 0 || index >= self->num_commands || self->commands[index].type != MGL_COMMAND_UNIFORM) {
+		MGLError_Set("command %d is not a uniform", index);
+		return 0;
+	}
+
+	MGLCommand & command = self->commands[index];
+
+	Py_buffer buffer_view;
+
+	int get_buffer = PyObject_GetBuffer(data, &buffer_view, PyBUF_SIMPLE);
+	if (get_buffer < 0) {
+		// Propagate the default error
+		return 0;
+	}
+
+	if (buffer_view.len != command.size) {
+		MGLError_Set("data size mismatch %d != %d", buffer_view.len, command.size);
+		PyBuffer_Release(&buffer_view);
+		return 0;
+	}
+
+	memcpy(self->blob + command.offset, buffer_view.buf, command.size);
+	PyBuffer_Release(&buffer_view);
+	Py_RETURN_NONE;
+}
+
+PyObject * MGLCommandList_set_offset(MGLCommandList * self, PyObject * args) {
+	int index;
+	Py_ssize_t offset;
+
+	int args_ok = PyArg_ParseTuple(
+		args,
+		"In",
+		&index,
+		&offset
+	);
+
+	if (!args_ok) {
+		return 0;
+	}
+
+	if (index < 0 || index >= self->num_commands || self->commands[index].type != MGL_COMMAND_BUFFER) {
+		MGLError_Set("command %d is not a buffer binding", index);
+		return 0;
+	}
+
+	MGLCommand & command = self->commands[index];
+	MGLBuffer * buffer = (MGLBuffer *)command.object;
+
+	if (offset < 0 || offset + command.size > buffer->size) {
+		MGLError_Set("out of range offset = %d or size = %d", offset, command.size);
+		return 0;
+	}
+
+	command.offset = offset;
+	Py_RETURN_NONE;
+}
+
+PyObject * MGLCommandList_execute(MGLCommandList * self) {
+	MGLContext * context = self->context;
+
+	for (int i = 0; i < self->num_commands; ++i) {
+		MGLCommand & command = self->commands[i];
+
+		bool released = command.object && Py_TYPE(command.object) == &MGLInvalidObject_Type;
+		released = released || (command.indirect_buffer && Py_TYPE(command.indirect_buffer) == &MGLInvalidObject_Type);
+
+		if (released) {
+			MGLError_Set("command %d refers to a released object", i);
+			return 0;
+		}
+
+		switch (command.type) {
+			case MGL_COMMAND_SCOPE_BEGIN:
+			case MGL_COMMAND_SCOPE_END: {
+				MGLScope * scope = (MGLScope *)command.object;
+				PyObject * result = command.type == MGL_COMMAND_SCOPE_BEGIN ? MGLScope_begin(scope) : MGLScope_end(scope);
+				if (!result) {
+					return 0;
+				}
+				Py_DECREF(result);
+				break;
+			}
+
+			case MGL_COMMAND_FRAMEBUFFER: {
+				PyObject * result = MGLFramebuffer_use((MGLFramebuffer *)command.object);
+				Py_XDECREF(result);
+				break;
+			}
+
+			case MGL_COMMAND_TEXTURE:
+				MGLContext_bind_texture(context, command.params[0], command.params[1], command.params[2]);
+				break;
+
+			case MGL_COMMAND_SAMPLER:
+				MGLContext_bind_sampler(context, command.params[0], command.params[1]);
+				break;
+
+			case MGL_COMMAND_BUFFER: {
+				MGLBuffer * buffer = (MGLBuffer *)command.object;
+				MGLContext_bind_buffer_range(context, command.params[0], command.params[1], buffer->buffer_obj, command.offset, command.size);
+				break;
+			}
+
+			case MGL_COMMAND_UNIFORM: {
+				MGLUniform * uniform = (MGLUniform *)command.object;
+				const void * data = self->blob + command.offset;
+				MGLUniform_write(uniform, data);
+				break;
+			}
+
+			case MGL_COMMAND_ENABLE:
+				MGLContext_set_enable_flags(context, command.params[0]);
+				break;
+
+			case MGL_COMMAND_RENDER:
+				if (!MGLVertexArray_check_unmapped((MGLVertexArray *)command.object)) {
+					return 0;
+				}
+				MGLVertexArray_draw((MGLVertexArray *)command.object, command.params[0], command.params[1], command.params[2], command.params[3]);
+				break;
+
+			case MGL_COMMAND_RENDER_INDIRECT:
+				if (!MGLVertexArray_check_unmapped((MGLVertexArray *)command.object) || !MGLBuffer_check_unmapped(command.indirect_buffer)) {
+					return 0;
+				}
+				MGLVertexArray_draw_indirect((MGLVertexArray *)command.object, command.indirect_buffer->buffer_obj, command.params[0], command.params[1], command.params[2]);
+				break;
+		}
+	}
+
+	Py_RETURN_NONE;
+}
+
+PyObject * MGLCommandList_clear(MGLCommandList * self) {
+	for (int i = 0; i < self->num_commands; ++i) {
+		Py_XDECREF(self->commands[i].object);
+		Py_XDECREF(self->commands[i].indirect_buffer);
+	}
+
+	self->num_commands = 0;
+	self->blob_size = 0;
+	Py_RETURN_NONE;
+}
+
+PyObject * MGLCommandList_release(MGLCommandList * self) {
+	MGLCommandList_Invalidate(self);
+	Py_RETURN_NONE;
+}
+
+PyMethodDef MGLCommandList_tp_methods[] = {
+	{"scope", (PyCFunction)MGLCommandList_scope, METH_VARARGS, 0},
+	{"framebuffer", (PyCFunction)MGLCommandList_framebuffer, METH_VARARGS, 0},
+	{"texture", (PyCFunction)MGLCommandList_texture, METH_VARARGS, 0},
+	{"sampler", (PyCFunction)MGLCommandList_sampler, METH_VARARGS, 0},
+	{"buffer", (PyCFunction)MGLCommandList_buffer, METH_VARARGS, 0},
+	{"uniform", (PyCFunction)MGLCommandList_uniform, METH_VARARGS, 0},
+	{"enable", (PyCFunction)MGLCommandList_enable, METH_VARARGS, 0},
+	{"render", (PyCFunction)MGLCommandList_render, METH_VARARGS, 0},
+	{"render_indirect", (PyCFunction)MGLCommandList_render_indirect, METH_VARARGS, 0},
+	{"write_uniform", (PyCFunction)MGLCommandList_write_uniform, METH_VARARGS, 0},
+	{"set_offset", (PyCFunction)MGLCommandList_set_offset, METH_VARARGS, 0},
+	{"execute", (PyCFunction)MGLCommandList_execute, METH_NOARGS, 0},
+	{"clear", (PyCFunction)MGLCommandList_clear, METH_NOARGS, 0},
+	{"release", (PyCFunction)MGLCommandList_release, METH_NOARGS, 0},
+	{0},
+};
+
+PyObject * MGLCommandList_get_size(MGLCommandList * self) {
+	return PyLong_FromLong(self->num_commands);
+}
+
+PyGetSetDef MGLCommandList_tp_getseters[] = {
+	{(char *)"size", (getter)MGLCommandList_get_size, 0, 0, 0},
+	{0},
+};
+
+PyTypeObject MGLCommandList_Type = {
+	PyVarObject_HEAD_INIT(0, 0)
+	"mgl.CommandList",                                      // tp_name
+	sizeof(MGLCommandList),                                 // tp_basicsize
+	0,                                                      // tp_itemsize
+	(destructor)MGLCommandList_tp_dealloc,                  // tp_dealloc
+	0,                                                      // tp_print
+	0,                                                      // tp_getattr
+	0,                                                      // tp_setattr
+	0,                                                      // tp_reserved
+	0,                                                      // tp_repr
+	0,                                                      // tp_as_number
+	0,                                                      // tp_as_sequence
+	0,                                                      // tp_as_mapping
+	0,                                                      // tp_hash
+	0,                                                      // tp_call
+	0,                                                      // tp_str
+	0,                                                      // tp_getattro
+	0,                                                      // tp_setattro
+	0,                                                      // tp_as_buffer
+	Py_TPFLAGS_DEFAULT,                                     // tp_flags
+	0,                                                      // tp_doc
+	0,                                                      // tp_traverse
+	0,                                                      // tp_clear
+	0,                                                      // tp_richcompare
+	0,                                                      // tp_weaklistoffset
+	0,                                                      // tp_iter
+	0,                                                      // tp_iternext
+	MGLCommandList_tp_methods,                              // tp_methods
+	0,                                                      // tp_members
+	MGLCommandList_tp_getseters,                            // tp_getset
+	0,                                                      // tp_base
+	0,                                                      // tp_dict
+	0,                                                      // tp_descr_get
+	0,                                                      // tp_descr_set
+	0,                                                      // tp_dictoffset
+	0,                                                      // tp_init
+	0,                                                      // tp_alloc
+	MGLCommandList_tp_new,                                  // tp_new
+};
+
+void MGLCommandList_Invalidate(MGLCommandList * command_list) {
+	if (Py_TYPE(command_list) == &MGLInvalidObject_Type) {
+		return;
+	}
+
+	PyObject * result = MGLCommandList_clear(command_list);
+	Py_XDECREF(result);
+
+	free(command_list->commands);
+	free(command_list->blob);
+
+	Py_DECREF(command_list->context);
+
+	Py_TYPE(command_list) = &MGLInvalidObject_Type;
+	Py_DECREF(command_list);
+}
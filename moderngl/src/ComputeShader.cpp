@@ -134,6 +134,7 @@ PyObject * MGLContext_compute_shader(MGLContext * self, PyObject * args) {
 		mglo->location = location;
 		mglo->array_length = array_length;
 		mglo->program_obj = program_obj;
+		mglo->context = self;
 		MGLUniform_Complete(mglo, gl);
 
 		PyObject * item = PyTuple_New(5);
@@ -266,8 +267,9 @@ PyObject * MGLComputeShader_run(MGLComputeShader * self, PyObject * args) {
 
 	const GLMethods & gl = self->context->gl;
 
-	gl.UseProgram(self->program_obj);
+	MGLContext_use_program(self->context, self->program_obj);
 	gl.DispatchCompute(x, y, z);
+	self->context->stats.dispatches += 1;
 
 	Py_RETURN_NONE;
 }
@@ -338,6 +340,7 @@ void MGLComputeShader_Invalidate(MGLComputeShader * compute_shader) {
 	const GLMethods & gl = compute_shader->context->gl;
 	gl.DeleteShader(compute_shader->shader_obj);
 	gl.DeleteProgram(compute_shader->program_obj);
+	MGLContext_forget_program(compute_shader->context, compute_shader->program_obj);
 
 	Py_DECREF(compute_shader->context);
 	Py_TYPE(compute_shader) = &MGLInvalidObject_Type;
@@ -16,93 +16,282 @@ void MGLContext_tp_dealloc(MGLContext * self) {
 	MGLContext_Type.tp_free((PyObject *)self);
 }
 
-PyObject * MGLContext_enable_only(MGLContext * self, PyObject * args) {
-	int flags;
+void MGLContext_reset_state_cache(MGLContext * self) {
+	self->uniform_epoch += 1;
+	self->bound_program = -1;
+	self->bound_vertex_array = -1;
+	self->applied_enable_flags = -1;
+	self->used_framebuffer = 0;
 
-	int args_ok = PyArg_ParseTuple(
-		args,
-		"i",
-		&flags
-	);
+	for (int i = 0; i < self->max_texture_units * 2; ++i) {
+		self->bound_textures[i] = -1;
+	}
 
-	if (!args_ok) {
-		return 0;
+	for (int i = 0; i < self->max_texture_units; ++i) {
+		self->bound_samplers[i] = -1;
 	}
 
-	self->enable_flags = flags;
+	for (int i = 0; i < self->max_uniform_buffer_bindings; ++i) {
+		self->uniform_buffer_bindings[i].buffer_obj = -1;
+	}
 
-	if (flags & MGL_BLEND) {
-		self->gl.Enable(GL_BLEND);
-	} else {
-		self->gl.Disable(GL_BLEND);
+	for (int i = 0; i < self->max_storage_buffer_bindings; ++i) {
+		self->storage_buffer_bindings[i].buffer_obj = -1;
 	}
+}
 
-	if (flags & MGL_DEPTH_TEST) {
-		self->gl.Enable(GL_DEPTH_TEST);
-	} else {
-		self->gl.Disable(GL_DEPTH_TEST);
+void MGLContext_use_program(MGLContext * self, int program_obj) {
+	if (self->state_cache && self->bound_program == program_obj) {
+		return;
 	}
 
-	if (flags & MGL_CULL_FACE) {
-		self->gl.Enable(GL_CULL_FACE);
-	} else {
-		self->gl.Disable(GL_CULL_FACE);
+	self->gl.UseProgram(program_obj);
+	self->bound_program = program_obj;
+	self->stats.program_binds += 1;
+}
+
+void MGLContext_bind_vertex_array(MGLContext * self, int vertex_array_obj) {
+	if (self->state_cache && self->bound_vertex_array == vertex_array_obj) {
+		return;
 	}
 
-	if (flags & MGL_RASTERIZER_DISCARD) {
-		self->gl.Enable(GL_RASTERIZER_DISCARD);
-	} else {
-		self->gl.Disable(GL_RASTERIZER_DISCARD);
+	self->gl.BindVertexArray(vertex_array_obj);
+	self->bound_vertex_array = vertex_array_obj;
+	self->stats.vertex_array_binds += 1;
+}
+
+void MGLContext_bind_texture(MGLContext * self, int unit, int target, int texture_obj) {
+	// The default texture unit is used internally without going through the cache.
+	bool cached = unit >= 0 && unit < self->max_texture_units && unit != self->default_texture_unit;
+
+	if (cached && self->state_cache) {
+		if (self->bound_textures[unit * 2] == target && self->bound_textures[unit * 2 + 1] == texture_obj) {
+			return;
+		}
+	}
+
+	self->gl.ActiveTexture(GL_TEXTURE0 + unit);
+	self->gl.BindTexture(target, texture_obj);
+	self->stats.texture_binds += 1;
+
+	if (cached) {
+		self->bound_textures[unit * 2] = target;
+		self->bound_textures[unit * 2 + 1] = texture_obj;
+	}
+}
+
+void MGLContext_bind_sampler(MGLContext * self, int unit, int sampler_obj) {
+	bool cached = unit >= 0 && unit < self->max_texture_units;
+
+	if (cached && self->state_cache && self->bound_samplers[unit] == sampler_obj) {
+		return;
+	}
+
+	self->gl.BindSampler(unit, sampler_obj);
+
+	if (cached) {
+		self->bound_samplers[unit] = sampler_obj;
+	}
+}
+
+// A negative size binds the whole buffer.
+
+void MGLContext_bind_buffer_range(MGLContext * self, int target, int binding, int buffer_obj, Py_ssize_t offset, Py_ssize_t size) {
+	MGLBufferBinding * bindings = 0;
+	int max_bindings = 0;
+
+	if (target == GL_UNIFORM_BUFFER) {
+		bindings = self->uniform_buffer_bindings;
+		max_bindings = self->max_uniform_buffer_bindings;
+	} else if (target == GL_SHADER_STORAGE_BUFFER) {
+		bindings = self->storage_buffer_bindings;
+		max_bindings = self->max_storage_buffer_bindings;
+	}
+
+	bool cached = binding >= 0 && binding < max_bindings;
+
+	if (cached && self->state_cache) {
+		MGLBufferBinding & current = bindings[binding];
+		if (current.buffer_obj == buffer_obj && current.offset == offset && current.size == size) {
+			return;
+		}
 	}
 
-	if (flags & MGL_PROGRAM_POINT_SIZE) {
-		self->gl.Enable(GL_PROGRAM_POINT_SIZE);
+	if (size < 0) {
+		self->gl.BindBufferBase(target, binding, buffer_obj);
 	} else {
-		self->gl.Disable(GL_PROGRAM_POINT_SIZE);
+		self->gl.BindBufferRange(target, binding, buffer_obj, offset, size);
 	}
 
-	Py_RETURN_NONE;
+	if (cached) {
+		bindings[binding].buffer_obj = buffer_obj;
+		bindings[binding].offset = offset;
+		bindings[binding].size = size;
+	}
 }
 
-PyObject * MGLContext_enable(MGLContext * self, PyObject * args) {
-	int flags;
+void MGLContext_set_enable_flags(MGLContext * self, int flags) {
+	int changed = ~0;
 
-	int args_ok = PyArg_ParseTuple(
-		args,
-		"i",
-		&flags
-	);
+	if (self->state_cache && self->applied_enable_flags != -1) {
+		changed = self->applied_enable_flags ^ flags;
+	}
 
-	if (!args_ok) {
-		return 0;
+	self->enable_flags = flags;
+	self->applied_enable_flags = flags;
+
+	if (changed & MGL_BLEND) {
+		if (flags & MGL_BLEND) {
+			self->gl.Enable(GL_BLEND);
+		} else {
+			self->gl.Disable(GL_BLEND);
+		}
 	}
 
-	self->enable_flags |= flags;
+	if (changed & MGL_DEPTH_TEST) {
+		if (flags & MGL_DEPTH_TEST) {
+			self->gl.Enable(GL_DEPTH_TEST);
+		} else {
+			self->gl.Disable(GL_DEPTH_TEST);
+		}
+	}
 
-	if (flags & MGL_BLEND) {
-		self->gl.Enable(GL_BLEND);
+	if (changed & MGL_CULL_FACE) {
+		if (flags & MGL_CULL_FACE) {
+			self->gl.Enable(GL_CULL_FACE);
+		} else {
+			self->gl.Disable(GL_CULL_FACE);
+		}
 	}
 
-	if (flags & MGL_DEPTH_TEST) {
-		self->gl.Enable(GL_DEPTH_TEST);
+	if (changed & MGL_RASTERIZER_DISCARD) {
+		if (flags & MGL_RASTERIZER_DISCARD) {
+			self->gl.Enable(GL_RASTERIZER_DISCARD);
+		} else {
+			self->gl.Disable(GL_RASTERIZER_DISCARD);
+		}
 	}
 
-	if (flags & MGL_CULL_FACE) {
-		self->gl.Enable(GL_CULL_FACE);
+	if (changed & MGL_PROGRAM_POINT_SIZE) {
+		if (flags & MGL_PROGRAM_POINT_SIZE) {
+			self->gl.Enable(GL_PROGRAM_POINT_SIZE);
+		} else {
+			self->gl.Disable(GL_PROGRAM_POINT_SIZE);
+		}
 	}
+}
+
+// Capabilities changed by enable_direct and disable_direct keep the cached flags in sync.
+
+void MGLContext_apply_direct(MGLContext * self, int capability, bool enabled) {
+	int flag = 0;
 
-	if (flags & MGL_RASTERIZER_DISCARD) {
-		self->gl.Enable(GL_RASTERIZER_DISCARD);
+	switch (capability) {
+		case GL_BLEND: flag = MGL_BLEND; break;
+		case GL_DEPTH_TEST: flag = MGL_DEPTH_TEST; break;
+		case GL_CULL_FACE: flag = MGL_CULL_FACE; break;
+		case GL_RASTERIZER_DISCARD: flag = MGL_RASTERIZER_DISCARD; break;
+		case GL_PROGRAM_POINT_SIZE: flag = MGL_PROGRAM_POINT_SIZE; break;
 	}
 
-	if (flags & MGL_PROGRAM_POINT_SIZE) {
-		self->gl.Enable(GL_PROGRAM_POINT_SIZE);
+	if (!flag || self->applied_enable_flags == -1) {
+		return;
 	}
 
-	Py_RETURN_NONE;
+	if (enabled) {
+		self->applied_enable_flags |= flag;
+	} else {
+		self->applied_enable_flags &= ~flag;
+	}
 }
 
-PyObject * MGLContext_disable(MGLContext * self, PyObject * args) {
+// Deleted object names can be reused by OpenGL, the cached bindings must be forgotten.
+
+void MGLContext_forget_program(MGLContext * self, int program_obj) {
+	if (self->bound_program == program_obj) {
+		self->bound_program = -1;
+	}
+}
+
+void MGLContext_forget_vertex_array(MGLContext * self, int vertex_array_obj) {
+	if (self->bound_vertex_array == vertex_array_obj) {
+		self->bound_vertex_array = -1;
+	}
+}
+
+void MGLContext_forget_texture(MGLContext * self, int texture_obj) {
+	for (int i = 0; i < self->max_texture_units; ++i) {
+		if (self->bound_textures[i * 2 + 1] == texture_obj) {
+			self->bound_textures[i * 2] = -1;
+			self->bound_textures[i * 2 + 1] = -1;
+		}
+	}
+}
+
+void MGLContext_forget_sampler(MGLContext * self, int sampler_obj) {
+	for (int i = 0; i < self->max_texture_units; ++i) {
+		if (self->bound_samplers[i] == sampler_obj) {
+			self->bound_samplers[i] = -1;
+		}
+	}
+}
+
+void MGLContext_forget_buffer(MGLContext * self, int buffer_obj) {
+	for (int i = 0; i < self->max_uniform_buffer_bindings; ++i) {
+		if (self->uniform_buffer_bindings[i].buffer_obj == buffer_obj) {
+			self->uniform_buffer_bindings[i].buffer_obj = -1;
+		}
+	}
+
+	for (int i = 0; i < self->max_storage_buffer_bindings; ++i) {
+		if (self->storage_buffer_bindings[i].buffer_obj == buffer_obj) {
+			self->storage_buffer_bindings[i].buffer_obj = -1;
+		}
+	}
+}
+
+// Temporary memory for the uniform setters. The memory grows to fit the largest request and it is reused.
+// A nested request, for example from a __float__ method setting another uniform, gets a separate allocation.
+// Returns NULL with a python exception set when out of memory.
+
+void * MGLContext_scratch(MGLContext * self, Py_ssize_t size) {
+	if (self->scratch_busy) {
+		void * scratch = PyMem_Malloc(size ? size : 1);
+		if (!scratch) {
+			PyErr_NoMemory();
+		}
+		return scratch;
+	}
+
+	if (!self->scratch || self->scratch_size < size) {
+		Py_ssize_t scratch_size = self->scratch_size ? self->scratch_size : 256;
+		while (scratch_size < size) {
+			scratch_size *= 2;
+		}
+
+		char * scratch = (char *)PyMem_Realloc(self->scratch, scratch_size);
+		if (!scratch) {
+			PyErr_NoMemory();
+			return 0;
+		}
+
+		self->scratch = scratch;
+		self->scratch_size = scratch_size;
+	}
+
+	self->scratch_busy = true;
+	return self->scratch;
+}
+
+void MGLContext_release_scratch(MGLContext * self, void * scratch) {
+	if (scratch == self->scratch) {
+		self->scratch_busy = false;
+	} else {
+		PyMem_Free(scratch);
+	}
+}
+
+PyObject * MGLContext_enable_only(MGLContext * self, PyObject * args) {
 	int flags;
 
 	int args_ok = PyArg_ParseTuple(
@@ -115,28 +304,41 @@ PyObject * MGLContext_disable(MGLContext * self, PyObject * args) {
 		return 0;
 	}
 
-	self->enable_flags &= ~flags;
+	MGLContext_set_enable_flags(self, flags);
+	Py_RETURN_NONE;
+}
 
-	if (flags & MGL_BLEND) {
-		self->gl.Disable(GL_BLEND);
-	}
+PyObject * MGLContext_enable(MGLContext * self, PyObject * args) {
+	int flags;
 
-	if (flags & MGL_DEPTH_TEST) {
-		self->gl.Disable(GL_DEPTH_TEST);
-	}
+	int args_ok = PyArg_ParseTuple(
+		args,
+		"i",
+		&flags
+	);
 
-	if (flags & MGL_CULL_FACE) {
-		self->gl.Disable(GL_CULL_FACE);
+	if (!args_ok) {
+		return 0;
 	}
 
-	if (flags & MGL_RASTERIZER_DISCARD) {
-		self->gl.Disable(GL_RASTERIZER_DISCARD);
-	}
+	MGLContext_set_enable_flags(self, self->enable_flags | flags);
+	Py_RETURN_NONE;
+}
 
-	if (flags & MGL_PROGRAM_POINT_SIZE) {
-		self->gl.Disable(GL_PROGRAM_POINT_SIZE);
+PyObject * MGLContext_disable(MGLContext * self, PyObject * args) {
+	int flags;
+
+	int args_ok = PyArg_ParseTuple(
+		args,
+		"i",
+		&flags
+	);
+
+	if (!args_ok) {
+		return 0;
 	}
 
+	MGLContext_set_enable_flags(self, self->enable_flags & ~flags);
 	Py_RETURN_NONE;
 }
 
@@ -154,6 +356,7 @@ PyObject * MGLContext_enable_direct(MGLContext * self, PyObject * args) {
 	}
 
 	self->gl.Enable(value);
+	MGLContext_apply_direct(self, value, true);
 	Py_RETURN_NONE;
 }
 
@@ -171,6 +374,7 @@ PyObject * MGLContext_disable_direct(MGLContext * self, PyObject * args) {
 	}
 
 	self->gl.Disable(value);
+	MGLContext_apply_direct(self, value, false);
 	Py_RETURN_NONE;
 }
 
@@ -482,11 +686,22 @@ PyObject * MGLContext_clear_samplers(MGLContext * self, PyObject * args) {
 
 	for(int i = start; i < end; i++) {
 		gl.BindSampler(i, 0);
+		self->bound_samplers[i] = 0;
 	}
 
 	Py_RETURN_NONE;
 }
 
+PyObject * MGLContext_invalidate_state_cache(MGLContext * self) {
+	MGLContext_reset_state_cache(self);
+	Py_RETURN_NONE;
+}
+
+PyObject * MGLContext_reset_stats(MGLContext * self) {
+	memset(&self->stats, 0, sizeof(self->stats));
+	Py_RETURN_NONE;
+}
+
 PyObject * MGLContext_buffer(MGLContext * self, PyObject * args);
 PyObject * MGLContext_texture(MGLContext * self, PyObject * args);
 PyObject * MGLContext_texture3d(MGLContext * self, PyObject * args);
@@ -495,6 +710,7 @@ PyObject * MGLContext_texture_cube(MGLContext * self, PyObject * args);
 PyObject * MGLContext_depth_texture(MGLContext * self, PyObject * args);
 PyObject * MGLContext_vertex_array(MGLContext * self, PyObject * args);
 PyObject * MGLContext_program(MGLContext * self, PyObject * args);
+PyObject * MGLContext_program_submit(MGLContext * self, PyObject * args);
 PyObject * MGLContext_framebuffer(MGLContext * self, PyObject * args);
 PyObject * MGLContext_renderbuffer(MGLContext * self, PyObject * args);
 PyObject * MGLContext_depth_renderbuffer(MGLContext * self, PyObject * args);
@@ -502,6 +718,12 @@ PyObject * MGLContext_compute_shader(MGLContext * self, PyObject * args);
 PyObject * MGLContext_query(MGLContext * self, PyObject * args);
 PyObject * MGLContext_scope(MGLContext * self, PyObject * args);
 PyObject * MGLContext_sampler(MGLContext * self, PyObject * args);
+PyObject * MGLContext_query_pool(MGLContext * self, PyObject * args);
+PyObject * MGLContext_tiled_framebuffer(MGLContext * self, PyObject * args);
+PyObject * MGLContext_upload_queue(MGLContext * self, PyObject * args);
+PyObject * MGLContext_command_list(MGLContext * self, PyObject * args);
+PyObject * MGLContext_readback(MGLContext * self, PyObject * args);
+PyObject * MGLContext_stream_buffer(MGLContext * self, PyObject * args);
 
 PyObject * MGLContext_enter(MGLContext * self) {
 	PyObject_CallMethod(self->ctx, "__enter__", NULL);
@@ -529,6 +751,8 @@ PyMethodDef MGLContext_tp_methods[] = {
 	{"copy_framebuffer", (PyCFunction)MGLContext_copy_framebuffer, METH_VARARGS, 0},
 	{"detect_framebuffer", (PyCFunction)MGLContext_detect_framebuffer, METH_VARARGS, 0},
 	{"clear_samplers", (PyCFunction)MGLContext_clear_samplers, METH_VARARGS, 0},
+	{"invalidate_state_cache", (PyCFunction)MGLContext_invalidate_state_cache, METH_NOARGS, 0},
+	{"reset_stats", (PyCFunction)MGLContext_reset_stats, METH_NOARGS, 0},
 
 	{"buffer", (PyCFunction)MGLContext_buffer, METH_VARARGS, 0},
 	{"texture", (PyCFunction)MGLContext_texture, METH_VARARGS, 0},
@@ -538,6 +762,7 @@ PyMethodDef MGLContext_tp_methods[] = {
 	{"depth_texture", (PyCFunction)MGLContext_depth_texture, METH_VARARGS, 0},
 	{"vertex_array", (PyCFunction)MGLContext_vertex_array, METH_VARARGS, 0},
 	{"program", (PyCFunction)MGLContext_program, METH_VARARGS, 0},
+	{"program_submit", (PyCFunction)MGLContext_program_submit, METH_VARARGS, 0},
 	// {"shader", (PyCFunction)MGLContext_shader, METH_VARARGS, 0},
 	{"framebuffer", (PyCFunction)MGLContext_framebuffer, METH_VARARGS, 0},
 	{"renderbuffer", (PyCFunction)MGLContext_renderbuffer, METH_VARARGS, 0},
@@ -546,6 +771,12 @@ PyMethodDef MGLContext_tp_methods[] = {
 	{"query", (PyCFunction)MGLContext_query, METH_VARARGS, 0},
 	{"scope", (PyCFunction)MGLContext_scope, METH_VARARGS, 0},
 	{"sampler", (PyCFunction)MGLContext_sampler, METH_VARARGS, 0},
+	{"query_pool", (PyCFunction)MGLContext_query_pool, METH_VARARGS, 0},
+	{"tiled_framebuffer", (PyCFunction)MGLContext_tiled_framebuffer, METH_VARARGS, 0},
+	{"upload_queue", (PyCFunction)MGLContext_upload_queue, METH_VARARGS, 0},
+	{"command_list", (PyCFunction)MGLContext_command_list, METH_VARARGS, 0},
+	{"readback", (PyCFunction)MGLContext_readback, METH_VARARGS, 0},
+	{"stream_buffer", (PyCFunction)MGLContext_stream_buffer, METH_VARARGS, 0},
 
 	{"__enter__", (PyCFunction)MGLContext_enter, METH_NOARGS, 0},
 	{"__exit__", (PyCFunction)MGLContext_exit, METH_VARARGS, 0},
@@ -780,6 +1011,63 @@ int MGLContext_set_wireframe(MGLContext * self, PyObject * value) {
 	return 0;
 }
 
+PyObject * MGLContext_get_state_cache(MGLContext * self) {
+	return PyBool_FromLong(self->state_cache);
+}
+
+int MGLContext_set_state_cache(MGLContext * self, PyObject * value) {
+	if (value == Py_True) {
+		MGLContext_reset_state_cache(self);
+		self->state_cache = true;
+	} else if (value == Py_False) {
+		self->state_cache = false;
+	} else {
+		MGLError_Set("invalid value for state_cache");
+		return -1;
+	}
+	return 0;
+}
+
+PyObject * MGLContext_get_uniform_shadowing(MGLContext * self) {
+	return PyBool_FromLong(self->uniform_shadowing);
+}
+
+int MGLContext_set_uniform_shadowing(MGLContext * self, PyObject * value) {
+	if (value == Py_True) {
+		self->uniform_epoch += 1;
+		self->uniform_shadowing = true;
+	} else if (value == Py_False) {
+		self->uniform_shadowing = false;
+	} else {
+		MGLError_Set("invalid value for uniform_shadowing");
+		return -1;
+	}
+	return 0;
+}
+
+PyObject * MGLContext_get_uniform_uploads(MGLContext * self) {
+	return Py_BuildValue("(LL)", self->stats.uniform_uploads, self->stats.uniform_uploads_skipped);
+}
+
+PyObject * MGLContext_get_stats(MGLContext * self) {
+	const MGLStats & stats = self->stats;
+	return Py_BuildValue(
+		"{sLsLsLsLsLsLsLsLsLsLsLsL}",
+		"draw_calls", stats.draw_calls,
+		"vertices", stats.vertices,
+		"instances", stats.instances,
+		"dispatches", stats.dispatches,
+		"program_binds", stats.program_binds,
+		"vertex_array_binds", stats.vertex_array_binds,
+		"framebuffer_binds", stats.framebuffer_binds,
+		"texture_binds", stats.texture_binds,
+		"uniform_uploads", stats.uniform_uploads,
+		"uniform_uploads_skipped", stats.uniform_uploads_skipped,
+		"bytes_written", stats.bytes_written,
+		"bytes_read", stats.bytes_read
+	);
+}
+
 PyObject * MGLContext_get_front_face(MGLContext * self) {
 	if (self->front_face == GL_CW) {
 		static PyObject * res_cw = PyUnicode_FromString("cw");
@@ -892,6 +1180,10 @@ PyObject * MGLContext_get_version_code(MGLContext * self, void * closure) {
 	return PyLong_FromLong(self->version_code);
 }
 
+PyObject * MGLContext_get_native_loader(MGLContext * self, void * closure) {
+	return PyBool_FromLong(self->native_loader);
+}
+
 PyObject * MGLContext_get_extensions(MGLContext * self, void * closure) {
 	return self->extensions;
 }
@@ -1425,11 +1717,16 @@ PyGetSetDef MGLContext_tp_getseters[] = {
 	{(char *)"fbo", (getter)MGLContext_get_fbo, (setter)MGLContext_set_fbo, 0, 0},
 
 	{(char *)"wireframe", (getter)MGLContext_get_wireframe, (setter)MGLContext_set_wireframe, 0, 0},
+	{(char *)"state_cache", (getter)MGLContext_get_state_cache, (setter)MGLContext_set_state_cache, 0, 0},
+	{(char *)"uniform_shadowing", (getter)MGLContext_get_uniform_shadowing, (setter)MGLContext_set_uniform_shadowing, 0, 0},
+	{(char *)"uniform_uploads", (getter)MGLContext_get_uniform_uploads, 0, 0, 0},
+	{(char *)"stats", (getter)MGLContext_get_stats, 0, 0, 0},
 	{(char *)"front_face", (getter)MGLContext_get_front_face, (setter)MGLContext_set_front_face, 0, 0},
 	{(char *)"cull_face", (getter)MGLContext_get_cull_face, (setter)MGLContext_set_cull_face, 0, 0},
 
 	{(char *)"patch_vertices", (getter)MGLContext_get_patch_vertices, (setter)MGLContext_set_patch_vertices, 0, 0},
 
+	{(char *)"native_loader", (getter)MGLContext_get_native_loader, 0, 0, 0},
 	{(char *)"extensions", (getter)MGLContext_get_extensions, 0, 0, 0},
 	{(char *)"info", (getter)MGLContext_get_info, 0, 0, 0},
 	{(char *)"error", (getter)MGLContext_get_error, 0, 0, 0},
@@ -1484,6 +1781,24 @@ void MGLContext_Invalidate(MGLContext * context) {
 
 	PyObject_CallMethod(context->ctx, "release", NULL);
 
+	PyMem_Free(context->scratch);
+	context->scratch = 0;
+	context->scratch_size = 0;
+
+	// Objects outliving the context must not reach the freed state cache, the zero limits skip it.
+
+	delete[] context->bound_textures;
+	delete[] context->bound_samplers;
+	delete[] context->uniform_buffer_bindings;
+	delete[] context->storage_buffer_bindings;
+	context->bound_textures = 0;
+	context->bound_samplers = 0;
+	context->uniform_buffer_bindings = 0;
+	context->storage_buffer_bindings = 0;
+	context->max_texture_units = 0;
+	context->max_uniform_buffer_bindings = 0;
+	context->max_storage_buffer_bindings = 0;
+
 	// TODO: decref
 
 	Py_TYPE(context) = &MGLInvalidObject_Type;
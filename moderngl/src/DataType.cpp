@@ -23,8 +23,124 @@ static MGLDataType i1 = {int_base_format, i1_internal_format, GL_BYTE, 1, false}
 static MGLDataType i2 = {int_base_format, i2_internal_format, GL_SHORT, 2, false};
 static MGLDataType i4 = {int_base_format, i4_internal_format, GL_INT, 4, false};
 
+// Compressed formats are uploaded as pre-compressed blocks.
+// Reading them back returns the decompressed pixels.
+
+static int bc1_internal_format[5] = {0, GL_COMPRESSED_RGB_S3TC_DXT1_EXT, GL_COMPRESSED_RGB_S3TC_DXT1_EXT, GL_COMPRESSED_RGB_S3TC_DXT1_EXT, GL_COMPRESSED_RGB_S3TC_DXT1_EXT};
+static int bc1a_internal_format[5] = {0, GL_COMPRESSED_RGBA_S3TC_DXT1_EXT, GL_COMPRESSED_RGBA_S3TC_DXT1_EXT, GL_COMPRESSED_RGBA_S3TC_DXT1_EXT, GL_COMPRESSED_RGBA_S3TC_DXT1_EXT};
+static int bc2_internal_format[5] = {0, GL_COMPRESSED_RGBA_S3TC_DXT3_EXT, GL_COMPRESSED_RGBA_S3TC_DXT3_EXT, GL_COMPRESSED_RGBA_S3TC_DXT3_EXT, GL_COMPRESSED_RGBA_S3TC_DXT3_EXT};
+static int bc3_internal_format[5] = {0, GL_COMPRESSED_RGBA_S3TC_DXT5_EXT, GL_COMPRESSED_RGBA_S3TC_DXT5_EXT, GL_COMPRESSED_RGBA_S3TC_DXT5_EXT, GL_COMPRESSED_RGBA_S3TC_DXT5_EXT};
+static int bc4_internal_format[5] = {0, GL_COMPRESSED_RED_RGTC1, GL_COMPRESSED_RED_RGTC1, GL_COMPRESSED_RED_RGTC1, GL_COMPRESSED_RED_RGTC1};
+static int bc4s_internal_format[5] = {0, GL_COMPRESSED_SIGNED_RED_RGTC1, GL_COMPRESSED_SIGNED_RED_RGTC1, GL_COMPRESSED_SIGNED_RED_RGTC1, GL_COMPRESSED_SIGNED_RED_RGTC1};
+static int bc5_internal_format[5] = {0, GL_COMPRESSED_RG_RGTC2, GL_COMPRESSED_RG_RGTC2, GL_COMPRESSED_RG_RGTC2, GL_COMPRESSED_RG_RGTC2};
+static int bc5s_internal_format[5] = {0, GL_COMPRESSED_SIGNED_RG_RGTC2, GL_COMPRESSED_SIGNED_RG_RGTC2, GL_COMPRESSED_SIGNED_RG_RGTC2, GL_COMPRESSED_SIGNED_RG_RGTC2};
+static int bc6h_internal_format[5] = {0, GL_COMPRESSED_RGB_BPTC_UNSIGNED_FLOAT, GL_COMPRESSED_RGB_BPTC_UNSIGNED_FLOAT, GL_COMPRESSED_RGB_BPTC_UNSIGNED_FLOAT, GL_COMPRESSED_RGB_BPTC_UNSIGNED_FLOAT};
+static int bc6hs_internal_format[5] = {0, GL_COMPRESSED_RGB_BPTC_SIGNED_FLOAT, GL_COMPRESSED_RGB_BPTC_SIGNED_FLOAT, GL_COMPRESSED_RGB_BPTC_SIGNED_FLOAT, GL_COMPRESSED_RGB_BPTC_SIGNED_FLOAT};
+static int bc7_internal_format[5] = {0, GL_COMPRESSED_RGBA_BPTC_UNORM, GL_COMPRESSED_RGBA_BPTC_UNORM, GL_COMPRESSED_RGBA_BPTC_UNORM, GL_COMPRESSED_RGBA_BPTC_UNORM};
+static int bc7srgb_internal_format[5] = {0, GL_COMPRESSED_SRGB_ALPHA_BPTC_UNORM, GL_COMPRESSED_SRGB_ALPHA_BPTC_UNORM, GL_COMPRESSED_SRGB_ALPHA_BPTC_UNORM, GL_COMPRESSED_SRGB_ALPHA_BPTC_UNORM};
+static int etc2_internal_format[5] = {0, GL_COMPRESSED_RGB8_ETC2, GL_COMPRESSED_RGB8_ETC2, GL_COMPRESSED_RGB8_ETC2, GL_COMPRESSED_RGB8_ETC2};
+static int etc2a1_internal_format[5] = {0, GL_COMPRESSED_RGB8_PUNCHTHROUGH_ALPHA1_ETC2, GL_COMPRESSED_RGB8_PUNCHTHROUGH_ALPHA1_ETC2, GL_COMPRESSED_RGB8_PUNCHTHROUGH_ALPHA1_ETC2, GL_COMPRESSED_RGB8_PUNCHTHROUGH_ALPHA1_ETC2};
+static int etc2a_internal_format[5] = {0, GL_COMPRESSED_RGBA8_ETC2_EAC, GL_COMPRESSED_RGBA8_ETC2_EAC, GL_COMPRESSED_RGBA8_ETC2_EAC, GL_COMPRESSED_RGBA8_ETC2_EAC};
+static int eacr_internal_format[5] = {0, GL_COMPRESSED_R11_EAC, GL_COMPRESSED_R11_EAC, GL_COMPRESSED_R11_EAC, GL_COMPRESSED_R11_EAC};
+static int eacrg_internal_format[5] = {0, GL_COMPRESSED_RG11_EAC, GL_COMPRESSED_RG11_EAC, GL_COMPRESSED_RG11_EAC, GL_COMPRESSED_RG11_EAC};
+static int astc4_4_internal_format[5] = {0, GL_COMPRESSED_RGBA_ASTC_4x4_KHR, GL_COMPRESSED_RGBA_ASTC_4x4_KHR, GL_COMPRESSED_RGBA_ASTC_4x4_KHR, GL_COMPRESSED_RGBA_ASTC_4x4_KHR};
+static int astc5_4_internal_format[5] = {0, GL_COMPRESSED_RGBA_ASTC_5x4_KHR, GL_COMPRESSED_RGBA_ASTC_5x4_KHR, GL_COMPRESSED_RGBA_ASTC_5x4_KHR, GL_COMPRESSED_RGBA_ASTC_5x4_KHR};
+static int astc5_5_internal_format[5] = {0, GL_COMPRESSED_RGBA_ASTC_5x5_KHR, GL_COMPRESSED_RGBA_ASTC_5x5_KHR, GL_COMPRESSED_RGBA_ASTC_5x5_KHR, GL_COMPRESSED_RGBA_ASTC_5x5_KHR};
+static int astc6_5_internal_format[5] = {0, GL_COMPRESSED_RGBA_ASTC_6x5_KHR, GL_COMPRESSED_RGBA_ASTC_6x5_KHR, GL_COMPRESSED_RGBA_ASTC_6x5_KHR, GL_COMPRESSED_RGBA_ASTC_6x5_KHR};
+static int astc6_6_internal_format[5] = {0, GL_COMPRESSED_RGBA_ASTC_6x6_KHR, GL_COMPRESSED_RGBA_ASTC_6x6_KHR, GL_COMPRESSED_RGBA_ASTC_6x6_KHR, GL_COMPRESSED_RGBA_ASTC_6x6_KHR};
+static int astc8_5_internal_format[5] = {0, GL_COMPRESSED_RGBA_ASTC_8x5_KHR, GL_COMPRESSED_RGBA_ASTC_8x5_KHR, GL_COMPRESSED_RGBA_ASTC_8x5_KHR, GL_COMPRESSED_RGBA_ASTC_8x5_KHR};
+static int astc8_6_internal_format[5] = {0, GL_COMPRESSED_RGBA_ASTC_8x6_KHR, GL_COMPRESSED_RGBA_ASTC_8x6_KHR, GL_COMPRESSED_RGBA_ASTC_8x6_KHR, GL_COMPRESSED_RGBA_ASTC_8x6_KHR};
+static int astc8_8_internal_format[5] = {0, GL_COMPRESSED_RGBA_ASTC_8x8_KHR, GL_COMPRESSED_RGBA_ASTC_8x8_KHR, GL_COMPRESSED_RGBA_ASTC_8x8_KHR, GL_COMPRESSED_RGBA_ASTC_8x8_KHR};
+static int astc10_5_internal_format[5] = {0, GL_COMPRESSED_RGBA_ASTC_10x5_KHR, GL_COMPRESSED_RGBA_ASTC_10x5_KHR, GL_COMPRESSED_RGBA_ASTC_10x5_KHR, GL_COMPRESSED_RGBA_ASTC_10x5_KHR};
+static int astc10_6_internal_format[5] = {0, GL_COMPRESSED_RGBA_ASTC_10x6_KHR, GL_COMPRESSED_RGBA_ASTC_10x6_KHR, GL_COMPRESSED_RGBA_ASTC_10x6_KHR, GL_COMPRESSED_RGBA_ASTC_10x6_KHR};
+static int astc10_8_internal_format[5] = {0, GL_COMPRESSED_RGBA_ASTC_10x8_KHR, GL_COMPRESSED_RGBA_ASTC_10x8_KHR, GL_COMPRESSED_RGBA_ASTC_10x8_KHR, GL_COMPRESSED_RGBA_ASTC_10x8_KHR};
+static int astc10_10_internal_format[5] = {0, GL_COMPRESSED_RGBA_ASTC_10x10_KHR, GL_COMPRESSED_RGBA_ASTC_10x10_KHR, GL_COMPRESSED_RGBA_ASTC_10x10_KHR, GL_COMPRESSED_RGBA_ASTC_10x10_KHR};
+static int astc12_10_internal_format[5] = {0, GL_COMPRESSED_RGBA_ASTC_12x10_KHR, GL_COMPRESSED_RGBA_ASTC_12x10_KHR, GL_COMPRESSED_RGBA_ASTC_12x10_KHR, GL_COMPRESSED_RGBA_ASTC_12x10_KHR};
+static int astc12_12_internal_format[5] = {0, GL_COMPRESSED_RGBA_ASTC_12x12_KHR, GL_COMPRESSED_RGBA_ASTC_12x12_KHR, GL_COMPRESSED_RGBA_ASTC_12x12_KHR, GL_COMPRESSED_RGBA_ASTC_12x12_KHR};
+
+static MGLDataType bc1 = {float_base_format, bc1_internal_format, GL_UNSIGNED_BYTE, 1, true, 4, 4, 8};
+static MGLDataType bc1a = {float_base_format, bc1a_internal_format, GL_UNSIGNED_BYTE, 1, true, 4, 4, 8};
+static MGLDataType bc2 = {float_base_format, bc2_internal_format, GL_UNSIGNED_BYTE, 1, true, 4, 4, 16};
+static MGLDataType bc3 = {float_base_format, bc3_internal_format, GL_UNSIGNED_BYTE, 1, true, 4, 4, 16};
+static MGLDataType bc4 = {float_base_format, bc4_internal_format, GL_UNSIGNED_BYTE, 1, true, 4, 4, 8};
+static MGLDataType bc4s = {float_base_format, bc4s_internal_format, GL_UNSIGNED_BYTE, 1, true, 4, 4, 8};
+static MGLDataType bc5 = {float_base_format, bc5_internal_format, GL_UNSIGNED_BYTE, 1, true, 4, 4, 16};
+static MGLDataType bc5s = {float_base_format, bc5s_internal_format, GL_UNSIGNED_BYTE, 1, true, 4, 4, 16};
+static MGLDataType bc6h = {float_base_format, bc6h_internal_format, GL_HALF_FLOAT, 2, true, 4, 4, 16};
+static MGLDataType bc6hs = {float_base_format, bc6hs_internal_format, GL_HALF_FLOAT, 2, true, 4, 4, 16};
+static MGLDataType bc7 = {float_base_format, bc7_internal_format, GL_UNSIGNED_BYTE, 1, true, 4, 4, 16};
+static MGLDataType bc7srgb = {float_base_format, bc7srgb_internal_format, GL_UNSIGNED_BYTE, 1, true, 4, 4, 16};
+static MGLDataType etc2 = {float_base_format, etc2_internal_format, GL_UNSIGNED_BYTE, 1, true, 4, 4, 8};
+static MGLDataType etc2a1 = {float_base_format, etc2a1_internal_format, GL_UNSIGNED_BYTE, 1, true, 4, 4, 8};
+static MGLDataType etc2a = {float_base_format, etc2a_internal_format, GL_UNSIGNED_BYTE, 1, true, 4, 4, 16};
+static MGLDataType eacr = {float_base_format, eacr_internal_format, GL_UNSIGNED_BYTE, 1, true, 4, 4, 8};
+static MGLDataType eacrg = {float_base_format, eacrg_internal_format, GL_UNSIGNED_BYTE, 1, true, 4, 4, 16};
+static MGLDataType astc4_4 = {float_base_format, astc4_4_internal_format, GL_UNSIGNED_BYTE, 1, true, 4, 4, 16};
+static MGLDataType astc5_4 = {float_base_format, astc5_4_internal_format, GL_UNSIGNED_BYTE, 1, true, 5, 4, 16};
+static MGLDataType astc5_5 = {float_base_format, astc5_5_internal_format, GL_UNSIGNED_BYTE, 1, true, 5, 5, 16};
+static MGLDataType astc6_5 = {float_base_format, astc6_5_internal_format, GL_UNSIGNED_BYTE, 1, true, 6, 5, 16};
+static MGLDataType astc6_6 = {float_base_format, astc6_6_internal_format, GL_UNSIGNED_BYTE, 1, true, 6, 6, 16};
+static MGLDataType astc8_5 = {float_base_format, astc8_5_internal_format, GL_UNSIGNED_BYTE, 1, true, 8, 5, 16};
+static MGLDataType astc8_6 = {float_base_format, astc8_6_internal_format, GL_UNSIGNED_BYTE, 1, true, 8, 6, 16};
+static MGLDataType astc8_8 = {float_base_format, astc8_8_internal_format, GL_UNSIGNED_BYTE, 1, true, 8, 8, 16};
+static MGLDataType astc10_5 = {float_base_format, astc10_5_internal_format, GL_UNSIGNED_BYTE, 1, true, 10, 5, 16};
+static MGLDataType astc10_6 = {float_base_format, astc10_6_internal_format, GL_UNSIGNED_BYTE, 1, true, 10, 6, 16};
+static MGLDataType astc10_8 = {float_base_format, astc10_8_internal_format, GL_UNSIGNED_BYTE, 1, true, 10, 8, 16};
+static MGLDataType astc10_10 = {float_base_format, astc10_10_internal_format, GL_UNSIGNED_BYTE, 1, true, 10, 10, 16};
+static MGLDataType astc12_10 = {float_base_format, astc12_10_internal_format, GL_UNSIGNED_BYTE, 1, true, 12, 10, 16};
+static MGLDataType astc12_12 = {float_base_format, astc12_12_internal_format, GL_UNSIGNED_BYTE, 1, true, 12, 12, 16};
+
+struct MGLCompressedDataType {
+	const char * name;
+	MGLDataType * data_type;
+};
+
+static MGLCompressedDataType compressed_types[] = {
+	{"bc1", &bc1},
+	{"bc1a", &bc1a},
+	{"bc2", &bc2},
+	{"bc3", &bc3},
+	{"bc4", &bc4},
+	{"bc4s", &bc4s},
+	{"bc5", &bc5},
+	{"bc5s", &bc5s},
+	{"bc6h", &bc6h},
+	{"bc6hs", &bc6hs},
+	{"bc7", &bc7},
+	{"bc7srgb", &bc7srgb},
+	{"etc2", &etc2},
+	{"etc2a1", &etc2a1},
+	{"etc2a", &etc2a},
+	{"eacr", &eacr},
+	{"eacrg", &eacrg},
+	{"astc4x4", &astc4_4},
+	{"astc5x4", &astc5_4},
+	{"astc5x5", &astc5_5},
+	{"astc6x5", &astc6_5},
+	{"astc6x6", &astc6_6},
+	{"astc8x5", &astc8_5},
+	{"astc8x6", &astc8_6},
+	{"astc8x8", &astc8_8},
+	{"astc10x5", &astc10_5},
+	{"astc10x6", &astc10_6},
+	{"astc10x8", &astc10_8},
+	{"astc10x10", &astc10_10},
+	{"astc12x10", &astc12_10},
+	{"astc12x12", &astc12_12},
+	{0},
+};
+
 MGLDataType * from_dtype(const char * dtype) {
-	if (!dtype[0] || (dtype[1] && dtype[2])) {
+	if (dtype[0] && dtype[1] && dtype[2]) {
+		for (int i = 0; compressed_types[i].name; ++i) {
+			if (!strcmp(dtype, compressed_types[i].name)) {
+				return compressed_types[i].data_type;
+			}
+		}
+		return 0;
+	}
+
+	if (!dtype[0]) {
 		return 0;
 	}
 
@@ -60,3 +176,35 @@ MGLDataType * from_dtype(const char * dtype) {
 			return 0;
 	}
 }
+
+Py_ssize_t compressed_size(MGLDataType * data_type, int width, int height, int depth) {
+	Py_ssize_t blocks_x = (width + data_type->block_width - 1) / data_type->block_width;
+	Py_ssize_t blocks_y = (height + data_type->block_height - 1) / data_type->block_height;
+	return blocks_x * blocks_y * data_type->block_size * depth;
+}
+
+// Regions of compressed textures must start on a block boundary
+// and cover whole blocks unless they end at the edge of the level.
+// The size of the level is clamped to 1 like for the mipmaps.
+
+bool compressed_region(MGLDataType * data_type, int x, int y, int width, int height, int level_width, int level_height) {
+	int bw = data_type->block_width;
+	int bh = data_type->block_height;
+
+	level_width = level_width > 1 ? level_width : 1;
+	level_height = level_height > 1 ? level_height : 1;
+
+	if (x % bw || y % bh) {
+		return false;
+	}
+
+	if (width % bw && x + width != level_width) {
+		return false;
+	}
+
+	if (height % bh && y + height != level_height) {
+		return false;
+	}
+
+	return true;
+}
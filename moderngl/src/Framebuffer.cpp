@@ -399,6 +399,11 @@ PyObject * MGLFramebuffer_clear(MGLFramebuffer * self, PyObject * args) {
 
 	const GLMethods & gl = self->context->gl;
 
+	// Clearing applies the masks and the scissor of this framebuffer.
+	if (self->context->used_framebuffer != self) {
+		self->context->used_framebuffer = 0;
+	}
+
 	gl.BindFramebuffer(GL_FRAMEBUFFER, self->framebuffer_obj);
 
 	if (self->framebuffer_obj) {
@@ -453,9 +458,17 @@ PyObject * MGLFramebuffer_clear(MGLFramebuffer * self, PyObject * args) {
 }
 
 PyObject * MGLFramebuffer_use(MGLFramebuffer * self) {
+	MGLContext * context = self->context;
+
+	// The viewport, scissor and masks of the bound framebuffer are applied by their setters.
+	if (context->state_cache && context->used_framebuffer == self && context->bound_framebuffer == self) {
+		Py_RETURN_NONE;
+	}
+
 	const GLMethods & gl = self->context->gl;
 
 	gl.BindFramebuffer(GL_FRAMEBUFFER, self->framebuffer_obj);
+	context->stats.framebuffer_binds += 1;
 
 	if (self->framebuffer_obj) {
 		gl.DrawBuffers(self->draw_buffers_len, self->draw_buffers);
@@ -495,6 +508,7 @@ PyObject * MGLFramebuffer_use(MGLFramebuffer * self) {
 	Py_INCREF(self);
 	Py_DECREF(self->context->bound_framebuffer);
 	self->context->bound_framebuffer = self;
+	self->context->used_framebuffer = self;
 
 	Py_RETURN_NONE;
 }
@@ -614,11 +628,154 @@ PyObject * MGLFramebuffer_read(MGLFramebuffer * self, PyObject * args) {
 	gl.PixelStorei(GL_PACK_ALIGNMENT, alignment);
 	gl.PixelStorei(GL_UNPACK_ALIGNMENT, alignment);
 	gl.ReadPixels(x, y, width, height, base_format, pixel_type, data);
+	self->context->stats.bytes_read += expected_size;
 	gl.BindFramebuffer(GL_FRAMEBUFFER, self->context->bound_framebuffer->framebuffer_obj);
 
 	return result;
 }
 
+PyObject * MGLFramebuffer_read_array(MGLFramebuffer * self, PyObject * args) {
+	PyObject * viewport;
+	int components;
+	int channels;
+	int attachment;
+	int flip;
+
+	const char * dtype;
+	Py_ssize_t dtype_size;
+
+	int args_ok = PyArg_ParseTuple(
+		args,
+		"OIIIs#p",
+		&viewport,
+		&components,
+		&channels,
+		&attachment,
+		&dtype,
+		&dtype_size,
+		&flip
+	);
+
+	if (!args_ok) {
+		return 0;
+	}
+
+	if (dtype_size != 2) {
+		MGLError_Set("invalid dtype");
+		return 0;
+	}
+
+	MGLDataType * data_type = from_dtype(dtype);
+
+	if (!data_type) {
+		MGLError_Set("invalid dtype");
+		return 0;
+	}
+
+	int x = 0;
+	int y = 0;
+	int width = self->width;
+	int height = self->height;
+
+	if (viewport != Py_None) {
+		if (Py_TYPE(viewport) != &PyTuple_Type) {
+			MGLError_Set("the viewport must be a tuple not %s", Py_TYPE(viewport)->tp_name);
+			return 0;
+		}
+
+		if (PyTuple_GET_SIZE(viewport) == 4) {
+
+			x = PyLong_AsLong(PyTuple_GET_ITEM(viewport, 0));
+			y = PyLong_AsLong(PyTuple_GET_ITEM(viewport, 1));
+			width = PyLong_AsLong(PyTuple_GET_ITEM(viewport, 2));
+			height = PyLong_AsLong(PyTuple_GET_ITEM(viewport, 3));
+
+		} else if (PyTuple_GET_SIZE(viewport) == 2) {
+
+			width = PyLong_AsLong(PyTuple_GET_ITEM(viewport, 0));
+			height = PyLong_AsLong(PyTuple_GET_ITEM(viewport, 1));
+
+		} else {
+
+			MGLError_Set("the viewport size %d is invalid", PyTuple_GET_SIZE(viewport));
+			return 0;
+
+		}
+
+		if (PyErr_Occurred()) {
+			MGLError_Set("wrong values in the viewport");
+			return 0;
+		}
+
+	}
+
+	bool read_depth = false;
+
+	if (attachment == -1) {
+		components = 1;
+		channels = 1;
+		read_depth = true;
+	}
+
+	if (components < 1 || components > 4) {
+		MGLError_Set("the components must be 1, 2, 3 or 4");
+		return 0;
+	}
+
+	if (channels < 1 || channels > components) {
+		MGLError_Set("the channels must be between 1 and %d", components);
+		return 0;
+	}
+
+	MGLPixels * pixels = MGLPixels_New(data_type, width, height, channels);
+
+	if (!pixels) {
+		return 0;
+	}
+
+	// Without flipping or dropping channels the pixels are read in place.
+	// Otherwise they are read into a temporary allocation and copied row by row.
+
+	bool convert = flip || channels != components;
+	char * data = pixels->data;
+
+	if (convert) {
+		data = (char *)PyMem_Malloc((Py_ssize_t)width * height * components * data_type->size);
+
+		if (!data) {
+			Py_DECREF(pixels);
+			return PyErr_NoMemory();
+		}
+	}
+
+	int pixel_type = data_type->gl_type;
+	int base_format = read_depth ? GL_DEPTH_COMPONENT : data_type->base_format[components];
+
+	const GLMethods & gl = self->context->gl;
+
+	gl.ClampColor(GL_CLAMP_READ_COLOR, GL_FIXED_ONLY);
+	gl.BindFramebuffer(GL_FRAMEBUFFER, self->framebuffer_obj);
+	gl.ReadBuffer(read_depth ? GL_NONE : (GL_COLOR_ATTACHMENT0 + attachment));
+	gl.PixelStorei(GL_PACK_ALIGNMENT, 1);
+	gl.PixelStorei(GL_UNPACK_ALIGNMENT, 1);
+	gl.ReadPixels(x, y, width, height, base_format, pixel_type, data);
+	self->context->stats.bytes_read += (long long)width * height * components * data_type->size;
+	gl.BindFramebuffer(GL_FRAMEBUFFER, self->context->bound_framebuffer->framebuffer_obj);
+
+	if (convert) {
+		int src_pixel = components * data_type->size;
+		int dst_pixel = channels * data_type->size;
+
+		Py_BEGIN_ALLOW_THREADS
+		MGLPixels_copy(pixels->data, data, width, height, src_pixel, dst_pixel, flip);
+		Py_END_ALLOW_THREADS
+
+		PyMem_Free(data);
+	}
+
+	return (PyObject *)pixels;
+}
+
 PyObject * MGLFramebuffer_read_into(MGLFramebuffer * self, PyObject * args) {
 	PyObject * data;
 	PyObject * viewport;
@@ -754,6 +911,7 @@ PyObject * MGLFramebuffer_read_into(MGLFramebuffer * self, PyObject * args) {
 		gl.PixelStorei(GL_PACK_ALIGNMENT, alignment);
 		gl.PixelStorei(GL_UNPACK_ALIGNMENT, alignment);
 		gl.ReadPixels(x, y, width, height, base_format, pixel_type, ptr);
+		self->context->stats.bytes_read += expected_size;
 		gl.BindFramebuffer(GL_FRAMEBUFFER, self->context->bound_framebuffer->framebuffer_obj);
 
 		PyBuffer_Release(&buffer_view);
@@ -767,6 +925,7 @@ PyMethodDef MGLFramebuffer_tp_methods[] = {
 	{"use", (PyCFunction)MGLFramebuffer_use, METH_NOARGS, 0},
 	{"read", (PyCFunction)MGLFramebuffer_read, METH_VARARGS, 0},
 	{"read_into", (PyCFunction)MGLFramebuffer_read_into, METH_VARARGS, 0},
+	{"read_array", (PyCFunction)MGLFramebuffer_read_array, METH_VARARGS, 0},
 	{"release", (PyCFunction)MGLFramebuffer_release, METH_NOARGS, 0},
 	{0},
 };
@@ -1142,6 +1301,9 @@ void MGLFramebuffer_Invalidate(MGLFramebuffer * framebuffer) {
 	}
 
 	if (framebuffer->framebuffer_obj) {
+		if (framebuffer->context->used_framebuffer == framebuffer) {
+			framebuffer->context->used_framebuffer = 0;
+		}
 		framebuffer->context->gl.DeleteFramebuffers(1, (GLuint *)&framebuffer->framebuffer_obj);
 		Py_DECREF(framebuffer->context);
 		delete[] framebuffer->draw_buffers;
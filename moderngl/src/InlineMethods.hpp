@@ -176,3 +176,16 @@ inline PyObject * tuple3(PyObject * a, PyObject * b, PyObject * c) {
 	PyTuple_SET_ITEM(res, 2, c);
 	return res;
 }
+
+inline int mipmap_levels(int width, int height, int depth) {
+	int size = width > height ? width : height;
+	size = size > depth ? size : depth;
+
+	int levels = 1;
+	while (size > 1) {
+		size /= 2;
+		levels += 1;
+	}
+
+	return levels;
+}
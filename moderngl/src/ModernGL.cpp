@@ -98,19 +98,115 @@ PyObject * fmtdebug(PyObject * self, PyObject * args) {
 	return res;
 }
 
+// The native loader calls the GetProcAddress function of the window system directly.
+// The function itself is resolved once through load(name), the window system is known from the type
+// of the glcontext backend context. Darwin has no such function and keeps the load(name) path.
+
+typedef void * (GLAPI * MGLGetProcAddressProc)(const char * name);
+
+MGLGetProcAddressProc get_native_loader(PyObject * context, PyObject * load) {
+	const char * type_name = Py_TYPE(context)->tp_name;
+	const char * loader_name = 0;
+
+#if defined(_WIN32)
+	if (strstr(type_name, "wgl.")) {
+		loader_name = "wglGetProcAddress";
+	}
+#elif !defined(__APPLE__)
+	if (strstr(type_name, "egl.")) {
+		loader_name = "eglGetProcAddress";
+	} else if (strstr(type_name, "x11.")) {
+		loader_name = "glXGetProcAddressARB";
+	}
+#endif
+
+	if (!loader_name) {
+		return 0;
+	}
+
+	PyObject * val = PyObject_CallFunction(load, "s", loader_name);
+	if (!val) {
+		PyErr_Clear();
+		return 0;
+	}
+
+	void * proc = PyLong_AsVoidPtr(val);
+	Py_DECREF(val);
+	PyErr_Clear();
+
+	return (MGLGetProcAddressProc)proc;
+}
+
+// wglGetProcAddress returns small integers instead of null on failure.
+
+bool valid_proc(void * proc) {
+	intptr_t value = (intptr_t)proc;
+	return value != 0 && value != 1 && value != 2 && value != 3 && value != -1;
+}
+
+// Fills the GLMethods table in the order of GL_FUNCTIONS.
+// The functions the native loader cannot resolve, such as the OpenGL 1.1 entry points
+// on Windows, are resolved by calling load(name) on the backend context.
+// Backend factories given by the caller may wrap load, they never use the native loader.
+
+bool load_gl_methods(MGLContext * ctx, bool native_loader) {
+	void ** gl_function = (void **)&ctx->gl;
+
+	PyObject * load = PyObject_GetAttrString(ctx->ctx, "load");
+	if (!load) {
+		return false;
+	}
+
+	MGLGetProcAddressProc loader = native_loader ? get_native_loader(ctx->ctx, load) : 0;
+	ctx->native_loader = loader != 0;
+
+	for (int i = 0; GL_FUNCTIONS[i]; ++i) {
+		void * proc = loader ? loader(GL_FUNCTIONS[i]) : 0;
+
+		if (!valid_proc(proc)) {
+			PyObject * val = PyObject_CallFunction(load, "s", GL_FUNCTIONS[i]);
+			if (!val) {
+				Py_DECREF(load);
+				return false;
+			}
+			proc = PyLong_AsVoidPtr(val);
+			Py_DECREF(val);
+		}
+
+		gl_function[i] = proc;
+	}
+
+	Py_DECREF(load);
+	return true;
+}
+
 PyObject * create_context(PyObject * self, PyObject * args, PyObject * kwargs) {
 	PyObject * backend;
 	PyObject * backend_name = PyDict_GetItemString(kwargs, "backend");
 	PyErr_Clear();
 
+	// The native_loader setting is not forwarded to the backend
+	bool native_loader = true;
+	PyObject * native_loader_setting = PyDict_GetItemString(kwargs, "native_loader");
+	if (native_loader_setting) {
+		native_loader = PyObject_IsTrue(native_loader_setting) == 1;
+		PyDict_DelItemString(kwargs, "native_loader");
+	}
+	PyErr_Clear();
+
 	PyObject * glcontext = PyImport_ImportModule("glcontext");
 	if (!glcontext) {
 		// Displayed to user: ModuleNotFoundError: No module named 'glcontext'
 		return NULL;
 	}
 
+	// Use a backend factory, tools wrapping the OpenGL functions pass one
+	if (backend_name && PyCallable_Check(backend_name)) {
+		Py_INCREF(backend_name);
+		backend = backend_name;
+		native_loader = false;
 	// Use the specified backend
-    if (backend_name) {
+	} else if (backend_name) {
 		backend = PyObject_CallMethod(glcontext, "get_backend_by_name", "O", backend_name);
 		if (backend == Py_None || backend == NULL) {
 			return NULL;
@@ -156,15 +252,9 @@ PyObject * create_context(PyObject * self, PyObject * args, PyObject * kwargs) {
     }
 
 	// Map OpenGL functions
-    void ** gl_function = (void **)&ctx->gl;
-    for (int i = 0; GL_FUNCTIONS[i]; ++i) {
-        PyObject * val = PyObject_CallMethod(ctx->ctx, "load", "s", GL_FUNCTIONS[i]);
-        if (!val) {
-            return NULL;
-        }
-        gl_function[i] = PyLong_AsVoidPtr(val);
-        Py_DECREF(val);
-    }
+	if (!load_gl_methods(ctx, native_loader)) {
+		return NULL;
+	}
 
     const GLMethods & gl = ctx->gl;
 
@@ -187,6 +277,30 @@ PyObject * create_context(PyObject * self, PyObject * args, PyObject * kwargs) {
 		PySet_Add(ctx->extensions, ext_name);
 	}
 
+	// Let the driver pick the number of shader compiler threads.
+	// The ARB version of the extension shares the enums but not the entry point.
+
+	PyObject * khr_parallel = PyUnicode_FromString("GL_KHR_parallel_shader_compile");
+	PyObject * arb_parallel = PyUnicode_FromString("GL_ARB_parallel_shader_compile");
+
+	bool has_khr_parallel = PySet_Contains(ctx->extensions, khr_parallel) == 1;
+	ctx->parallel_shader_compile = has_khr_parallel || PySet_Contains(ctx->extensions, arb_parallel) == 1;
+
+	Py_DECREF(khr_parallel);
+	Py_DECREF(arb_parallel);
+
+	if (has_khr_parallel && gl.MaxShaderCompilerThreadsKHR) {
+		gl.MaxShaderCompilerThreadsKHR(0xFFFFFFFF);
+	}
+
+	PyObject * arb_clear_buffer = PyUnicode_FromString("GL_ARB_clear_buffer_object");
+	ctx->clear_buffer_object = ctx->version_code >= 430 || PySet_Contains(ctx->extensions, arb_clear_buffer) == 1;
+	Py_DECREF(arb_clear_buffer);
+
+	PyObject * arb_texture_storage = PyUnicode_FromString("GL_ARB_texture_storage");
+	ctx->texture_storage = ctx->version_code >= 420 || PySet_Contains(ctx->extensions, arb_texture_storage) == 1;
+	Py_DECREF(arb_texture_storage);
+
 	gl.BlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
 
 	gl.Enable(GL_TEXTURE_CUBE_MAP_SEAMLESS);
@@ -284,6 +398,31 @@ PyObject * create_context(PyObject * self, PyObject * args, PyObject * kwargs) {
 	ctx->multisample = true;
 
 	ctx->provoking_vertex = GL_LAST_VERTEX_CONVENTION;
+
+	ctx->max_uniform_buffer_bindings = 0;
+	gl.GetIntegerv(GL_MAX_UNIFORM_BUFFER_BINDINGS, (GLint *)&ctx->max_uniform_buffer_bindings);
+
+	ctx->max_storage_buffer_bindings = 0;
+	if (ctx->version_code >= 430) {
+		gl.GetIntegerv(GL_MAX_SHADER_STORAGE_BUFFER_BINDINGS, (GLint *)&ctx->max_storage_buffer_bindings);
+	}
+
+	ctx->bound_textures = new int[ctx->max_texture_units * 2];
+	ctx->bound_samplers = new int[ctx->max_texture_units];
+	ctx->uniform_buffer_bindings = new MGLBufferBinding[ctx->max_uniform_buffer_bindings];
+	ctx->storage_buffer_bindings = new MGLBufferBinding[ctx->max_storage_buffer_bindings];
+
+	ctx->scratch = 0;
+	ctx->scratch_size = 0;
+	ctx->scratch_busy = false;
+
+	ctx->uniform_shadowing = true;
+	ctx->uniform_epoch = 0;
+	memset(&ctx->stats, 0, sizeof(ctx->stats));
+
+	ctx->state_cache = true;
+	MGLContext_reset_state_cache(ctx);
+
 	gl.GetError(); // clear errors
 
 	if (PyErr_Occurred()) {
@@ -317,6 +456,28 @@ bool MGL_InitializeModule(PyObject * module) {
 		PyModule_AddObject(module, "Attribute", (PyObject *)&MGLAttribute_Type);
 	}
 
+	{
+		if (PyType_Ready(&MGLBufferView_Type) < 0) {
+			PyErr_Format(PyExc_ImportError, "Cannot register BufferView in %s (%s:%d)", __FUNCTION__, __FILE__, __LINE__);
+			return false;
+		}
+
+		Py_INCREF(&MGLBufferView_Type);
+
+		PyModule_AddObject(module, "BufferView", (PyObject *)&MGLBufferView_Type);
+	}
+
+	{
+		if (PyType_Ready(&MGLPixels_Type) < 0) {
+			PyErr_Format(PyExc_ImportError, "Cannot register Pixels in %s (%s:%d)", __FUNCTION__, __FILE__, __LINE__);
+			return false;
+		}
+
+		Py_INCREF(&MGLPixels_Type);
+
+		PyModule_AddObject(module, "Pixels", (PyObject *)&MGLPixels_Type);
+	}
+
 	{
 		if (PyType_Ready(&MGLBuffer_Type) < 0) {
 			PyErr_Format(PyExc_ImportError, "Cannot register Buffer in %s (%s:%d)", __FUNCTION__, __FILE__, __LINE__);
@@ -328,6 +489,17 @@ bool MGL_InitializeModule(PyObject * module) {
 		PyModule_AddObject(module, "Buffer", (PyObject *)&MGLBuffer_Type);
 	}
 
+	{
+		if (PyType_Ready(&MGLCommandList_Type) < 0) {
+			PyErr_Format(PyExc_ImportError, "Cannot register CommandList in %s (%s:%d)", __FUNCTION__, __FILE__, __LINE__);
+			return false;
+		}
+
+		Py_INCREF(&MGLCommandList_Type);
+
+		PyModule_AddObject(module, "CommandList", (PyObject *)&MGLCommandList_Type);
+	}
+
 	{
 		if (PyType_Ready(&MGLComputeShader_Type) < 0) {
 			PyErr_Format(PyExc_ImportError, "Cannot register ComputeShader in %s (%s:%d)", __FUNCTION__, __FILE__, __LINE__);
@@ -394,6 +566,28 @@ bool MGL_InitializeModule(PyObject * module) {
 		PyModule_AddObject(module, "Query", (PyObject *)&MGLQuery_Type);
 	}
 
+	{
+		if (PyType_Ready(&MGLQueryPool_Type) < 0) {
+			PyErr_Format(PyExc_ImportError, "Cannot register QueryPool in %s (%s:%d)", __FUNCTION__, __FILE__, __LINE__);
+			return false;
+		}
+
+		Py_INCREF(&MGLQueryPool_Type);
+
+		PyModule_AddObject(module, "QueryPool", (PyObject *)&MGLQueryPool_Type);
+	}
+
+	{
+		if (PyType_Ready(&MGLReadback_Type) < 0) {
+			PyErr_Format(PyExc_ImportError, "Cannot register Readback in %s (%s:%d)", __FUNCTION__, __FILE__, __LINE__);
+			return false;
+		}
+
+		Py_INCREF(&MGLReadback_Type);
+
+		PyModule_AddObject(module, "Readback", (PyObject *)&MGLReadback_Type);
+	}
+
 	{
 		if (PyType_Ready(&MGLRenderbuffer_Type) < 0) {
 			PyErr_Format(PyExc_ImportError, "Cannot register Renderbuffer in %s (%s:%d)", __FUNCTION__, __FILE__, __LINE__);
@@ -416,6 +610,39 @@ bool MGL_InitializeModule(PyObject * module) {
 		PyModule_AddObject(module, "Scope", (PyObject *)&MGLScope_Type);
 	}
 
+	{
+		if (PyType_Ready(&MGLStreamBuffer_Type) < 0) {
+			PyErr_Format(PyExc_ImportError, "Cannot register StreamBuffer in %s (%s:%d)", __FUNCTION__, __FILE__, __LINE__);
+			return false;
+		}
+
+		Py_INCREF(&MGLStreamBuffer_Type);
+
+		PyModule_AddObject(module, "StreamBuffer", (PyObject *)&MGLStreamBuffer_Type);
+	}
+
+	{
+		if (PyType_Ready(&MGLTiledFramebuffer_Type) < 0) {
+			PyErr_Format(PyExc_ImportError, "Cannot register TiledFramebuffer in %s (%s:%d)", __FUNCTION__, __FILE__, __LINE__);
+			return false;
+		}
+
+		Py_INCREF(&MGLTiledFramebuffer_Type);
+
+		PyModule_AddObject(module, "TiledFramebuffer", (PyObject *)&MGLTiledFramebuffer_Type);
+	}
+
+	{
+		if (PyType_Ready(&MGLUploadQueue_Type) < 0) {
+			PyErr_Format(PyExc_ImportError, "Cannot register UploadQueue in %s (%s:%d)", __FUNCTION__, __FILE__, __LINE__);
+			return false;
+		}
+
+		Py_INCREF(&MGLUploadQueue_Type);
+
+		PyModule_AddObject(module, "UploadQueue", (PyObject *)&MGLUploadQueue_Type);
+	}
+
 	{
 		if (PyType_Ready(&MGLTexture_Type) < 0) {
 			PyErr_Format(PyExc_ImportError, "Cannot register Texture in %s (%s:%d)", __FUNCTION__, __FILE__, __LINE__);
@@ -0,0 +1,174 @@
+#include "Types.hpp"
+
+static const char * pixel_format(MGLDataType * data_type) {
+	switch (data_type->gl_type) {
+		case GL_UNSIGNED_BYTE: return "B";
+		case GL_BYTE: return "b";
+		case GL_UNSIGNED_SHORT: return "H";
+		case GL_SHORT: return "h";
+		case GL_UNSIGNED_INT: return "I";
+		case GL_INT: return "i";
+		case GL_HALF_FLOAT: return "e";
+		case GL_FLOAT: return "f";
+		default: return "B";
+	}
+}
+
+// The pixels are stored as a C-contiguous (height, width, channels) array.
+// Returns NULL with a python exception set when out of memory.
+
+MGLPixels * MGLPixels_New(MGLDataType * data_type, int width, int height, int channels) {
+	MGLPixels * pixels = (MGLPixels *)MGLPixels_Type.tp_alloc(&MGLPixels_Type, 0);
+
+	if (!pixels) {
+		return 0;
+	}
+
+	pixels->itemsize = data_type->size;
+	pixels->format = pixel_format(data_type);
+	pixels->size = (Py_ssize_t)width * height * channels * data_type->size;
+	pixels->data = (char *)PyMem_Malloc(pixels->size ? pixels->size : 1);
+
+	if (!pixels->data) {
+		Py_DECREF(pixels);
+		PyErr_NoMemory();
+		return 0;
+	}
+
+	pixels->shape[0] = height;
+	pixels->shape[1] = width;
+	pixels->shape[2] = channels;
+
+	pixels->strides[2] = pixels->itemsize;
+	pixels->strides[1] = pixels->itemsize * channels;
+	pixels->strides[0] = pixels->itemsize * channels * width;
+
+	return pixels;
+}
+
+template <int N>
+static void copy_row(char * dst, const char * src, int width, int src_pixel) {
+	for (int x = 0; x < width; ++x) {
+		memcpy(dst, src, N);
+		dst += N;
+		src += src_pixel;
+	}
+}
+
+// Copies tightly packed rows, keeping the first dst_pixel bytes of every pixel and
+// optionally reversing the order of the rows. The fixed size copies compile to plain
+// moves, so the loop is safe to run with the GIL released on large images.
+
+void MGLPixels_copy(char * dst, const char * src, int width, int height, int src_pixel, int dst_pixel, bool flip) {
+	Py_ssize_t src_stride = (Py_ssize_t)width * src_pixel;
+	Py_ssize_t dst_stride = (Py_ssize_t)width * dst_pixel;
+
+	for (int y = 0; y < height; ++y) {
+		const char * src_row = src + (flip ? height - y - 1 : y) * src_stride;
+		char * dst_row = dst + y * dst_stride;
+
+		if (src_pixel == dst_pixel) {
+			memcpy(dst_row, src_row, dst_stride);
+			continue;
+		}
+
+		switch (dst_pixel) {
+			case 1: copy_row<1>(dst_row, src_row, width, src_pixel); break;
+			case 2: copy_row<2>(dst_row, src_row, width, src_pixel); break;
+			case 3: copy_row<3>(dst_row, src_row, width, src_pixel); break;
+			case 4: copy_row<4>(dst_row, src_row, width, src_pixel); break;
+			case 6: copy_row<6>(dst_row, src_row, width, src_pixel); break;
+			case 8: copy_row<8>(dst_row, src_row, width, src_pixel); break;
+			case 12: copy_row<12>(dst_row, src_row, width, src_pixel); break;
+
+			default:
+				for (int x = 0; x < width; ++x) {
+					memcpy(dst_row + x * dst_pixel, src_row + x * src_pixel, dst_pixel);
+				}
+				break;
+		}
+	}
+}
+
+PyObject * MGLPixels_tp_new(PyTypeObject * type, PyObject * args, PyObject * kwargs) {
+	MGLPixels * self = (MGLPixels *)type->tp_alloc(type, 0);
+
+	if (self) {
+	}
+
+	return (PyObject *)self;
+}
+
+void MGLPixels_tp_dealloc(MGLPixels * self) {
+	PyMem_Free(self->data);
+	MGLPixels_Type.tp_free((PyObject *)self);
+}
+
+int MGLPixels_tp_as_buffer_get_view(MGLPixels * self, Py_buffer * view, int flags) {
+	if (!self->data) {
+		PyErr_Format(PyExc_BufferError, "The pixels are empty");
+		view->obj = 0;
+		return -1;
+	}
+
+	view->buf = self->data;
+	view->len = self->size;
+	view->readonly = 0;
+	view->itemsize = self->itemsize;
+	view->format = (flags & PyBUF_FORMAT) ? (char *)self->format : 0;
+	view->ndim = 3;
+	view->shape = (flags & PyBUF_ND) == PyBUF_ND ? self->shape : 0;
+	view->strides = (flags & PyBUF_STRIDES) == PyBUF_STRIDES ? self->strides : 0;
+	view->suboffsets = 0;
+	view->internal = 0;
+
+	Py_INCREF(self);
+	view->obj = (PyObject *)self;
+	return 0;
+}
+
+PyBufferProcs MGLPixels_tp_as_buffer = {
+	(getbufferproc)MGLPixels_tp_as_buffer_get_view,                 // getbufferproc bf_getbuffer
+	0,                                                              // releasebufferproc bf_releasebuffer
+};
+
+PyTypeObject MGLPixels_Type = {
+	PyVarObject_HEAD_INIT(0, 0)
+	"mgl.Pixels",                                           // tp_name
+	sizeof(MGLPixels),                                      // tp_basicsize
+	0,                                                      // tp_itemsize
+	(destructor)MGLPixels_tp_dealloc,                       // tp_dealloc
+	0,                                                      // tp_print
+	0,                                                      // tp_getattr
+	0,                                                      // tp_setattr
+	0,                                                      // tp_reserved
+	0,                                                      // tp_repr
+	0,                                                      // tp_as_number
+	0,                                                      // tp_as_sequence
+	0,                                                      // tp_as_mapping
+	0,                                                      // tp_hash
+	0,                                                      // tp_call
+	0,                                                      // tp_str
+	0,                                                      // tp_getattro
+	0,                                                      // tp_setattro
+	&MGLPixels_tp_as_buffer,                                // tp_as_buffer
+	Py_TPFLAGS_DEFAULT,                                     // tp_flags
+	0,                                                      // tp_doc
+	0,                                                      // tp_traverse
+	0,                                                      // tp_clear
+	0,                                                      // tp_richcompare
+	0,                                                      // tp_weaklistoffset
+	0,                                                      // tp_iter
+	0,                                                      // tp_iternext
+	0,                                                      // tp_methods
+	0,                                                      // tp_members
+	0,                                                      // tp_getset
+	0,                                                      // tp_base
+	0,                                                      // tp_dict
+	0,                                                      // tp_descr_get
+	0,                                                      // tp_descr_set
+	0,                                                      // tp_dictoffset
+	0,                                                      // tp_init
+	0,                                                      // tp_alloc
+	MGLPixels_tp_new,                                       // tp_new
+};
@@ -2,25 +2,201 @@
 
 #include "InlineMethods.hpp"
 
+const char * SHADER_NAME[] = {
+	"vertex_shader",
+	"fragment_shader",
+	"geometry_shader",
+	"tess_control_shader",
+	"tess_evaluation_shader",
+};
+
+const char * SHADER_NAME_UNDERLINE[] = {
+	"=============",
+	"===============",
+	"===============",
+	"===================",
+	"======================",
+};
+
+// Checks the compile status of a shader and sets the error with the compiler log.
+
+bool MGLProgram_check_shader(const GLMethods & gl, int shader_obj, int slot) {
+	int compiled = GL_FALSE;
+	gl.GetShaderiv(shader_obj, GL_COMPILE_STATUS, &compiled);
+
+	if (!compiled) {
+		const char * message = "GLSL Compiler failed";
+		const char * title = SHADER_NAME[slot];
+		const char * underline = SHADER_NAME_UNDERLINE[slot];
+
+		int log_len = 0;
+		gl.GetShaderiv(shader_obj, GL_INFO_LOG_LENGTH, &log_len);
+
+		char * log = new char[log_len];
+		gl.GetShaderInfoLog(shader_obj, log_len, &log_len, log);
+
+		MGLError_Set("%s\n\n%s\n%s\n%s\n", message, title, underline, log);
+
+		delete[] log;
+		return false;
+	}
+
+	return true;
+}
+
+// Checks the link status of a program and sets the error with the linker log.
+
+bool MGLProgram_check_link(const GLMethods & gl, int program_obj) {
+	int linked = GL_FALSE;
+	gl.GetProgramiv(program_obj, GL_LINK_STATUS, &linked);
+
+	if (!linked) {
+		const char * message = "GLSL Linker failed";
+		const char * title = "Program";
+		const char * underline = "=======";
+
+		int log_len = 0;
+		gl.GetProgramiv(program_obj, GL_INFO_LOG_LENGTH, &log_len);
+
+		char * log = new char[log_len];
+		gl.GetProgramInfoLog(program_obj, log_len, &log_len, log);
+
+		MGLError_Set("%s\n\n%s\n%s\n%s\n", message, title, underline, log);
+
+		delete[] log;
+		return false;
+	}
+
+	return true;
+}
+
+void MGLProgram_set_varyings(const GLMethods & gl, int program_obj, PyObject * outputs) {
+	int num_outputs = (int)PyTuple_GET_SIZE(outputs);
+
+	if (num_outputs) {
+		const char ** varyings_array = new const char * [num_outputs];
+
+		for (int i = 0; i < num_outputs; ++i) {
+			varyings_array[i] = PyUnicode_AsUTF8(PyTuple_GET_ITEM(outputs, i));
+		}
+
+		gl.TransformFeedbackVaryings(program_obj, num_outputs, varyings_array, GL_INTERLEAVED_ATTRIBS);
+
+		delete[] varyings_array;
+	}
+}
+
+// Compiles the shaders and links the program without querying any status.
+// With GL_KHR_parallel_shader_compile the driver does the work in the background.
+// The shader objects are returned in shader_objs, they are deleted once the program is resolved.
+
+bool MGLProgram_submit(const GLMethods & gl, int program_obj, PyObject ** shaders, PyObject * outputs, int * shader_objs) {
+	for (int i = 0; i < NUM_SHADER_SLOTS; ++i) {
+		shader_objs[i] = 0;
+	}
+
+	for (int i = 0; i < NUM_SHADER_SLOTS; ++i) {
+		if (shaders[i] == Py_None) {
+			continue;
+		}
+
+		const char * source_str = PyUnicode_AsUTF8(shaders[i]);
+
+		int shader_obj = gl.CreateShader(SHADER_TYPE[i]);
+
+		if (!shader_obj) {
+			MGLError_Set("cannot create shader");
+			return false;
+		}
+
+		gl.ShaderSource(shader_obj, 1, &source_str, 0);
+		gl.CompileShader(shader_obj);
+
+		shader_objs[i] = shader_obj;
+		gl.AttachShader(program_obj, shader_obj);
+	}
+
+	MGLProgram_set_varyings(gl, program_obj, outputs);
+
+	gl.LinkProgram(program_obj);
+	return true;
+}
+
+// Checks the shaders submitted with MGLProgram_submit and deletes them.
+
+bool MGLProgram_finish(const GLMethods & gl, int program_obj, int * shader_objs) {
+	bool compiled = true;
+
+	for (int i = 0; i < NUM_SHADER_SLOTS; ++i) {
+		if (shader_objs[i]) {
+			compiled = compiled && MGLProgram_check_shader(gl, shader_objs[i], i);
+			gl.DeleteShader(shader_objs[i]);
+			shader_objs[i] = 0;
+		}
+	}
+
+	return compiled && MGLProgram_check_link(gl, program_obj);
+}
+
+// Compiles the shaders from source and links them into program_obj.
+// On failure the error is set and the caller deletes the program.
+
+bool MGLProgram_compile(const GLMethods & gl, int program_obj, PyObject ** shaders, PyObject * outputs) {
+	int shader_objs[NUM_SHADER_SLOTS];
+
+	if (!MGLProgram_submit(gl, program_obj, shaders, outputs, shader_objs)) {
+		return false;
+	}
+
+	return MGLProgram_finish(gl, program_obj, shader_objs);
+}
+
+PyObject * MGLProgram_get_binary(const GLMethods & gl, int program_obj) {
+	int binary_length = 0;
+	gl.GetProgramiv(program_obj, GL_PROGRAM_BINARY_LENGTH, &binary_length);
+
+	if (binary_length <= 0) {
+		Py_RETURN_NONE;
+	}
+
+	PyObject * binary = PyBytes_FromStringAndSize(0, binary_length + 4);
+	char * data = PyBytes_AS_STRING(binary);
+	int binary_format = 0;
+	gl.GetProgramBinary(program_obj, binary_length, &binary_length, (GLenum *)&binary_format, data + 4);
+	memcpy(data, &binary_format, 4);
+	return binary;
+}
+
+PyObject * MGLProgram_reflect(MGLProgram * program, const bool * stages);
+
 PyObject * MGLContext_program(MGLContext * self, PyObject * args) {
 	PyObject * shaders[5];
 	PyObject * outputs;
+	PyObject * binary;
+	int retrievable;
 
 	int args_ok = PyArg_ParseTuple(
 		args,
-		"OOOOOO",
+		"OOOOOOOp",
 		&shaders[0],
 		&shaders[1],
 		&shaders[2],
 		&shaders[3],
 		&shaders[4],
-		&outputs
+		&outputs,
+		&binary,
+		&retrievable
 	);
 
 	if (!args_ok) {
 		return 0;
 	}
 
+	if (binary != Py_None && (!PyBytes_Check(binary) || PyBytes_GET_SIZE(binary) < 4)) {
+		MGLError_Set("invalid program binary");
+		return 0;
+	}
+
 	int num_outputs = (int)PyTuple_GET_SIZE(outputs);
 
 	for (int i = 0; i < num_outputs; ++i) {
@@ -45,111 +221,74 @@ PyObject * MGLContext_program(MGLContext * self, PyObject * args) {
 		return 0;
 	}
 
-	int shader_objs[] = {0, 0, 0, 0, 0};
+	// A binary rejected by the driver (driver update, different gpu) is not an error.
+	// The program is compiled from source and a new binary is returned instead.
 
-	for (int i = 0; i < NUM_SHADER_SLOTS; ++i) {
-		if (shaders[i] == Py_None) {
-			continue;
-		}
+	bool loaded = false;
 
-		const char * source_str = PyUnicode_AsUTF8(shaders[i]);
+	if (binary != Py_None && gl.ProgramBinary) {
+		int binary_format = 0;
+		memcpy(&binary_format, PyBytes_AS_STRING(binary), 4);
+		gl.ProgramBinary(program_obj, binary_format, PyBytes_AS_STRING(binary) + 4, (int)PyBytes_GET_SIZE(binary) - 4);
 
-		int shader_obj = gl.CreateShader(SHADER_TYPE[i]);
+		int linked = GL_FALSE;
+		gl.GetProgramiv(program_obj, GL_LINK_STATUS, &linked);
 
-		if (!shader_obj) {
-			MGLError_Set("cannot create shader");
-			return 0;
+		if (linked) {
+			loaded = true;
+		} else {
+			gl.DeleteProgram(program_obj);
+			program_obj = gl.CreateProgram();
 		}
+	}
 
-		gl.ShaderSource(shader_obj, 1, &source_str, 0);
-		gl.CompileShader(shader_obj);
-
-		int compiled = GL_FALSE;
-		gl.GetShaderiv(shader_obj, GL_COMPILE_STATUS, &compiled);
-
-		if (!compiled) {
-			const char * SHADER_NAME[] = {
-				"vertex_shader",
-				"fragment_shader",
-				"geometry_shader",
-				"tess_control_shader",
-				"tess_evaluation_shader",
-			};
-
-			const char * SHADER_NAME_UNDERLINE[] = {
-				"=============",
-				"===============",
-				"===============",
-				"===================",
-				"======================",
-			};
-
-			const char * message = "GLSL Compiler failed";
-			const char * title = SHADER_NAME[i];
-			const char * underline = SHADER_NAME_UNDERLINE[i];
-
-			int log_len = 0;
-			gl.GetShaderiv(shader_obj, GL_INFO_LOG_LENGTH, &log_len);
-
-			char * log = new char[log_len];
-			gl.GetShaderInfoLog(shader_obj, log_len, &log_len, log);
-
-			gl.DeleteShader(shader_obj);
+	retrievable = retrievable && !loaded && gl.GetProgramBinary;
 
-			MGLError_Set("%s\n\n%s\n%s\n%s\n", message, title, underline, log);
+	if (!loaded) {
+		if (retrievable) {
+			gl.ProgramParameteri(program_obj, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+		}
 
-			delete[] log;
+		if (!MGLProgram_compile(gl, program_obj, shaders, outputs)) {
+			gl.DeleteProgram(program_obj);
+			Py_DECREF(program);
+			Py_DECREF(self);
 			return 0;
 		}
-
-		shader_objs[i] = shader_obj;
-		gl.AttachShader(program_obj, shader_obj);
 	}
 
-	if (num_outputs) {
-		const char ** varyings_array = new const char * [num_outputs];
-
-		for (int i = 0; i < num_outputs; ++i) {
-			varyings_array[i] = PyUnicode_AsUTF8(PyTuple_GET_ITEM(outputs, i));
-		}
-
-		gl.TransformFeedbackVaryings(program_obj, num_outputs, varyings_array, GL_INTERLEAVED_ATTRIBS);
-
-		delete[] varyings_array;
-	}
+	program->program_obj = program_obj;
+	program->pending = false;
+	program->retrievable = false;
 
-	gl.LinkProgram(program_obj);
+	bool stages[NUM_SHADER_SLOTS];
 
-	// Delete the shader objects after the program is linked
 	for (int i = 0; i < NUM_SHADER_SLOTS; ++i) {
-		if (shader_objs[i]) {
-			gl.DeleteShader(shader_objs[i]);
-		}
+		stages[i] = shaders[i] != Py_None;
 	}
 
-	int linked = GL_FALSE;
-	gl.GetProgramiv(program_obj, GL_LINK_STATUS, &linked);
-
-	if (!linked) {
-		const char * message = "GLSL Linker failed";
-		const char * title = "Program";
-		const char * underline = "=======";
-
-		int log_len = 0;
-		gl.GetProgramiv(program_obj, GL_INFO_LOG_LENGTH, &log_len);
+	PyObject * reflection = MGLProgram_reflect(program, stages);
 
-		char * log = new char[log_len];
-		gl.GetProgramInfoLog(program_obj, log_len, &log_len, log);
+	if (!reflection) {
+		Py_DECREF(program);
+		return 0;
+	}
 
-		gl.DeleteProgram(program_obj);
+	PyObject * binary_out = retrievable ? MGLProgram_get_binary(gl, program_obj) : Py_BuildValue("");
 
-		MGLError_Set("%s\n\n%s\n%s\n%s\n", message, title, underline, log);
+	Py_INCREF(program);
 
-		delete[] log;
-		return 0;
-	}
+	PyObject * result = PyTuple_New(4);
+	PyTuple_SET_ITEM(result, 0, (PyObject *)program);
+	PyTuple_SET_ITEM(result, 1, reflection);
+	PyTuple_SET_ITEM(result, 2, PyBool_FromLong(loaded));
+	PyTuple_SET_ITEM(result, 3, binary_out);
+	return result;
+}
 
-	program->program_obj = program_obj;
+PyObject * MGLProgram_reflect(MGLProgram * program, const bool * stages) {
+	const GLMethods & gl = program->context->gl;
+	int program_obj = program->program_obj;
 
 	// int num_vertex_shader_subroutine_locations = 0;
 	// int num_fragment_shader_subroutine_locations = 0;
@@ -170,7 +309,7 @@ PyObject * MGLContext_program(MGLContext * self, PyObject * args) {
 	int num_tess_control_shader_subroutine_uniforms = 0;
 
 	if (program->context->version_code >= 400) {
-		if (shaders[VERTEX_SHADER_SLOT] != Py_None) {
+		if (stages[VERTEX_SHADER_SLOT]) {
 			// gl.GetProgramStageiv(
 			// 	program_obj,
 			// 	GL_VERTEX_SHADER,
@@ -191,7 +330,7 @@ PyObject * MGLContext_program(MGLContext * self, PyObject * args) {
 			);
 		}
 
-		if (shaders[FRAGMENT_SHADER_SLOT] != Py_None) {
+		if (stages[FRAGMENT_SHADER_SLOT]) {
 			// gl.GetProgramStageiv(
 			// 	program_obj,
 			// 	GL_FRAGMENT_SHADER,
@@ -212,7 +351,7 @@ PyObject * MGLContext_program(MGLContext * self, PyObject * args) {
 			);
 		}
 
-		if (shaders[GEOMETRY_SHADER_SLOT] != Py_None) {
+		if (stages[GEOMETRY_SHADER_SLOT]) {
 			// gl.GetProgramStageiv(
 			// 	program_obj,
 			// 	GL_GEOMETRY_SHADER,
@@ -233,7 +372,7 @@ PyObject * MGLContext_program(MGLContext * self, PyObject * args) {
 			);
 		}
 
-		if (shaders[TESS_EVALUATION_SHADER_SLOT] != Py_None) {
+		if (stages[TESS_EVALUATION_SHADER_SLOT]) {
 			// gl.GetProgramStageiv(
 			// 	program_obj,
 			// 	GL_TESS_EVALUATION_SHADER,
@@ -254,7 +393,7 @@ PyObject * MGLContext_program(MGLContext * self, PyObject * args) {
 			);
 		}
 
-		if (shaders[TESS_CONTROL_SHADER_SLOT] != Py_None) {
+		if (stages[TESS_CONTROL_SHADER_SLOT]) {
 			// gl.GetProgramStageiv(
 			// 	program_obj,
 			// 	GL_TESS_CONTROL_SHADER,
@@ -276,7 +415,7 @@ PyObject * MGLContext_program(MGLContext * self, PyObject * args) {
 		}
 	}
 
-	if (shaders[GEOMETRY_SHADER_SLOT] != Py_None) {
+	if (stages[GEOMETRY_SHADER_SLOT]) {
 
 		int geometry_in = 0;
 		int geometry_out = 0;
@@ -393,12 +532,9 @@ PyObject * MGLContext_program(MGLContext * self, PyObject * args) {
 	}
 
 	if (PyErr_Occurred()) {
-		Py_DECREF(program);
 		return 0;
 	}
 
-	Py_INCREF(program);
-
 	int num_attributes = 0;
 	int num_varyings = 0;
 	int num_uniforms = 0;
@@ -495,6 +631,7 @@ PyObject * MGLContext_program(MGLContext * self, PyObject * args) {
 		mglo->location = location;
 		mglo->array_length = array_length;
 		mglo->program_obj = program->program_obj;
+		mglo->context = program->context;
 		MGLUniform_Complete(mglo, gl);
 
 		PyObject * item = PyTuple_New(5);
@@ -600,19 +737,130 @@ PyObject * MGLContext_program(MGLContext * self, PyObject * args) {
 	}
 	PyTuple_SET_ITEM(geom_info, 2, PyLong_FromLong(program->geometry_vertices));
 
-	PyObject * result = PyTuple_New(9);
+	PyObject * result = PyTuple_New(8);
+	PyTuple_SET_ITEM(result, 0, attributes_lst);
+	PyTuple_SET_ITEM(result, 1, varyings_lst);
+	PyTuple_SET_ITEM(result, 2, uniforms_lst);
+	PyTuple_SET_ITEM(result, 3, uniform_blocks_lst);
+	PyTuple_SET_ITEM(result, 4, subroutines_lst);
+	PyTuple_SET_ITEM(result, 5, subroutine_uniforms_lst);
+	PyTuple_SET_ITEM(result, 6, geom_info);
+	PyTuple_SET_ITEM(result, 7, PyLong_FromLong(program->program_obj));
+	return result;
+}
+
+PyObject * MGLContext_program_submit(MGLContext * self, PyObject * args) {
+	PyObject * shaders[5];
+	PyObject * outputs;
+	int retrievable;
+
+	int args_ok = PyArg_ParseTuple(
+		args,
+		"OOOOOOp",
+		&shaders[0],
+		&shaders[1],
+		&shaders[2],
+		&shaders[3],
+		&shaders[4],
+		&outputs,
+		&retrievable
+	);
+
+	if (!args_ok) {
+		return 0;
+	}
+
+	int num_outputs = (int)PyTuple_GET_SIZE(outputs);
+
+	for (int i = 0; i < num_outputs; ++i) {
+		PyObject * item = PyTuple_GET_ITEM(outputs, i);
+		if (Py_TYPE(item) != &PyUnicode_Type) {
+			MGLError_Set("varyings[%d] must be a string not %s", i, Py_TYPE(item)->tp_name);
+			return 0;
+		}
+	}
+
+	const GLMethods & gl = self->gl;
+
+	int program_obj = gl.CreateProgram();
+
+	if (!program_obj) {
+		MGLError_Set("cannot create program");
+		return 0;
+	}
+
+	retrievable = retrievable && gl.GetProgramBinary;
+
+	if (retrievable) {
+		gl.ProgramParameteri(program_obj, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+	}
+
+	MGLProgram * program = (MGLProgram *)MGLProgram_Type.tp_alloc(&MGLProgram_Type, 0);
+
+	if (!MGLProgram_submit(gl, program_obj, shaders, outputs, program->shader_objs)) {
+		gl.DeleteProgram(program_obj);
+		Py_DECREF(program);
+		return 0;
+	}
+
+	Py_INCREF(self);
+	program->context = self;
+	program->program_obj = program_obj;
+	program->pending = true;
+	program->retrievable = retrievable;
+
+	Py_INCREF(program);
+
+	PyObject * result = PyTuple_New(2);
 	PyTuple_SET_ITEM(result, 0, (PyObject *)program);
-	PyTuple_SET_ITEM(result, 1, attributes_lst);
-	PyTuple_SET_ITEM(result, 2, varyings_lst);
-	PyTuple_SET_ITEM(result, 3, uniforms_lst);
-	PyTuple_SET_ITEM(result, 4, uniform_blocks_lst);
-	PyTuple_SET_ITEM(result, 5, subroutines_lst);
-	PyTuple_SET_ITEM(result, 6, subroutine_uniforms_lst);
-	PyTuple_SET_ITEM(result, 7, geom_info);
-	PyTuple_SET_ITEM(result, 8, PyLong_FromLong(program->program_obj));
+	PyTuple_SET_ITEM(result, 1, PyLong_FromLong(program_obj));
 	return result;
 }
 
+PyObject * MGLProgram_resolve(MGLProgram * self) {
+	if (!self->pending) {
+		MGLError_Set("the program is already resolved");
+		return 0;
+	}
+
+	const GLMethods & gl = self->context->gl;
+
+	bool stages[NUM_SHADER_SLOTS];
+
+	for (int i = 0; i < NUM_SHADER_SLOTS; ++i) {
+		stages[i] = self->shader_objs[i] != 0;
+	}
+
+	self->pending = false;
+
+	if (!MGLProgram_finish(gl, self->program_obj, self->shader_objs)) {
+		return 0;
+	}
+
+	PyObject * reflection = MGLProgram_reflect(self, stages);
+
+	if (!reflection) {
+		return 0;
+	}
+
+	PyObject * binary = self->retrievable ? MGLProgram_get_binary(gl, self->program_obj) : Py_BuildValue("");
+
+	PyObject * result = PyTuple_New(2);
+	PyTuple_SET_ITEM(result, 0, reflection);
+	PyTuple_SET_ITEM(result, 1, binary);
+	return result;
+}
+
+PyObject * MGLProgram_get_ready(MGLProgram * self) {
+	if (!self->pending || !self->context->parallel_shader_compile) {
+		Py_RETURN_TRUE;
+	}
+
+	int completed = GL_TRUE;
+	self->context->gl.GetProgramiv(self->program_obj, GL_COMPLETION_STATUS_KHR, &completed);
+	return PyBool_FromLong(completed);
+}
+
 PyObject * MGLProgram_tp_new(PyTypeObject * type, PyObject * args, PyObject * kwargs) {
 	MGLProgram * self = (MGLProgram *)type->tp_alloc(type, 0);
 
@@ -632,10 +880,16 @@ PyObject * MGLProgram_release(MGLProgram * self) {
 }
 
 PyMethodDef MGLProgram_tp_methods[] = {
+	{"resolve", (PyCFunction)MGLProgram_resolve, METH_NOARGS, 0},
 	{"release", (PyCFunction)MGLProgram_release, METH_NOARGS, 0},
 	{0},
 };
 
+PyGetSetDef MGLProgram_tp_getseters[] = {
+	{(char *)"ready", (getter)MGLProgram_get_ready, 0, 0, 0},
+	{0},
+};
+
 PyTypeObject MGLProgram_Type = {
 	PyVarObject_HEAD_INIT(0, 0)
 	"mgl.Program",                                          // tp_name
@@ -666,7 +920,7 @@ PyTypeObject MGLProgram_Type = {
 	0,                                                      // tp_iternext
 	MGLProgram_tp_methods,                                  // tp_methods
 	0,                                                      // tp_members
-	0,                                                      // tp_getset
+	MGLProgram_tp_getseters,                                // tp_getset
 	0,                                                      // tp_base
 	0,                                                      // tp_dict
 	0,                                                      // tp_descr_get
@@ -683,7 +937,17 @@ void MGLProgram_Invalidate(MGLProgram * program) {
 	}
 
 	const GLMethods & gl = program->context->gl;
+
+	if (program->pending) {
+		for (int i = 0; i < NUM_SHADER_SLOTS; ++i) {
+			if (program->shader_objs[i]) {
+				gl.DeleteShader(program->shader_objs[i]);
+			}
+		}
+	}
+
 	gl.DeleteProgram(program->program_obj);
+	MGLContext_forget_program(program->context, program->program_obj);
 
 	Py_TYPE(program) = &MGLInvalidObject_Type;
 	Py_DECREF(program);
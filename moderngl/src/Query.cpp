@@ -201,10 +201,12 @@ PyObject * MGLQuery_get_primitives(MGLQuery * self) {
 PyObject * MGLQuery_get_elapsed(MGLQuery * self) {
 	const GLMethods & gl = self->context->gl;
 
-	int elapsed = 0;
-	gl.GetQueryObjectiv(self->query_obj[TIME_ELAPSED], GL_QUERY_RESULT, &elapsed);
+	// Nanoseconds overflow a 32-bit result after about two seconds.
 
-	return PyLong_FromLong(elapsed);
+	GLuint64 elapsed = 0;
+	gl.GetQueryObjectui64v(self->query_obj[TIME_ELAPSED], GL_QUERY_RESULT, &elapsed);
+
+	return PyLong_FromUnsignedLongLong(elapsed);
 }
 
 PyGetSetDef MGLQuery_tp_getseters[] = {
@@ -0,0 +1,356 @@
+#include "Types.hpp"
+
+PyObject * MGLContext_query_pool(MGLContext * self, PyObject * args) {
+	int size;
+
+	int args_ok = PyArg_ParseTuple(
+		args,
+		"I",
+		&size
+	);
+
+	if (!args_ok) {
+		return 0;
+	}
+
+	if (size < 1) {
+		MGLError_Set("invalid size = %d", size);
+		return 0;
+	}
+
+	MGLQueryPool * pool = (MGLQueryPool *)MGLQueryPool_Type.tp_alloc(&MGLQueryPool_Type, 0);
+
+	pool->query_obj = new int[size];
+	pool->targets = new int[size];
+	pool->free_list = new int[size];
+	pool->size = size;
+	pool->free = size;
+
+	const GLMethods & gl = self->gl;
+	gl.GenQueries(size, (GLuint *)pool->query_obj);
+
+	// The free list is a stack, the most recently returned query is reused first.
+
+	for (int i = 0; i < size; ++i) {
+		pool->targets[i] = 0;
+		pool->free_list[i] = size - i - 1;
+	}
+
+	Py_INCREF(self);
+	pool->context = self;
+
+	Py_INCREF(pool);
+
+	return (PyObject *)pool;
+}
+
+PyObject * MGLQueryPool_tp_new(PyTypeObject * type, PyObject * args, PyObject * kwargs) {
+	MGLQueryPool * self = (MGLQueryPool *)type->tp_alloc(type, 0);
+
+	if (self) {
+	}
+
+	return (PyObject *)self;
+}
+
+void MGLQueryPool_tp_dealloc(MGLQueryPool * self) {
+	MGLQueryPool_Type.tp_free((PyObject *)self);
+}
+
+// Takes a query from the free list, the pool doubles its size when every query is in use.
+
+int MGLQueryPool_acquire(MGLQueryPool * self, int target) {
+	if (!self->free) {
+		int size = self->size * 2;
+
+		int * query_obj = new int[size];
+		int * targets = new int[size];
+		int * free_list = new int[size];
+
+		memcpy(query_obj, self->query_obj, sizeof(int) * self->size);
+		memcpy(targets, self->targets, sizeof(int) * self->size);
+
+		const GLMethods & gl = self->context->gl;
+		gl.GenQueries(size - self->size, (GLuint *)query_obj + self->size);
+
+		for (int i = self->size; i < size; ++i) {
+			targets[i] = 0;
+			free_list[self->free++] = size - i + self->size - 1;
+		}
+
+		delete[] self->query_obj;
+		delete[] self->targets;
+		delete[] self->free_list;
+
+		self->query_obj = query_obj;
+		self->targets = targets;
+		self->free_list = free_list;
+		self->size = size;
+	}
+
+	int index = self->free_list[--self->free];
+	self->targets[index] = target;
+	return index;
+}
+
+bool MGLQueryPool_valid(MGLQueryPool * self, int index) {
+	if (index < 0 || index >= self->size || !self->targets[index]) {
+		MGLError_Set("invalid query %d", index);
+		return false;
+	}
+
+	return true;
+}
+
+void MGLQueryPool_recycle(MGLQueryPool * self, int index) {
+	self->targets[index] = 0;
+	self->free_list[self->free++] = index;
+}
+
+PyObject * MGLQueryPool_begin(MGLQueryPool * self, PyObject * args) {
+	const char * kind;
+
+	int args_ok = PyArg_ParseTuple(
+		args,
+		"s",
+		&kind
+	);
+
+	if (!args_ok) {
+		return 0;
+	}
+
+	int target = 0;
+
+	if (!strcmp(kind, "elapsed")) {
+		target = GL_TIME_ELAPSED;
+	} else if (!strcmp(kind, "samples")) {
+		target = GL_SAMPLES_PASSED;
+	} else if (!strcmp(kind, "any_samples")) {
+		target = GL_ANY_SAMPLES_PASSED;
+	} else if (!strcmp(kind, "primitives")) {
+		target = GL_PRIMITIVES_GENERATED;
+	} else {
+		MGLError_Set("invalid kind: %s", kind);
+		return 0;
+	}
+
+	int index = MGLQueryPool_acquire(self, target);
+
+	const GLMethods & gl = self->context->gl;
+	gl.BeginQuery(target, self->query_obj[index]);
+
+	return PyLong_FromLong(index);
+}
+
+PyObject * MGLQueryPool_end(MGLQueryPool * self, PyObject * args) {
+	int index;
+
+	int args_ok = PyArg_ParseTuple(
+		args,
+		"i",
+		&index
+	);
+
+	if (!args_ok) {
+		return 0;
+	}
+
+	if (!MGLQueryPool_valid(self, index)) {
+		return 0;
+	}
+
+	if (self->targets[index] == GL_TIMESTAMP) {
+		MGLError_Set("timestamp queries cannot be ended");
+		return 0;
+	}
+
+	const GLMethods & gl = self->context->gl;
+	gl.EndQuery(self->targets[index]);
+
+	Py_RETURN_NONE;
+}
+
+PyObject * MGLQueryPool_timestamp(MGLQueryPool * self) {
+	int index = MGLQueryPool_acquire(self, GL_TIMESTAMP);
+
+	const GLMethods & gl = self->context->gl;
+	gl.QueryCounter(self->query_obj[index], GL_TIMESTAMP);
+
+	return PyLong_FromLong(index);
+}
+
+PyObject * MGLQueryPool_available(MGLQueryPool * self, PyObject * args) {
+	int index;
+
+	int args_ok = PyArg_ParseTuple(
+		args,
+		"i",
+		&index
+	);
+
+	if (!args_ok) {
+		return 0;
+	}
+
+	if (!MGLQueryPool_valid(self, index)) {
+		return 0;
+	}
+
+	const GLMethods & gl = self->context->gl;
+
+	unsigned available = 0;
+	gl.GetQueryObjectuiv(self->query_obj[index], GL_QUERY_RESULT_AVAILABLE, &available);
+
+	return PyBool_FromLong(available);
+}
+
+// Returns the 64-bit result and puts the query back to the free list.
+// Without waiting None is returned while the result is not available and the query is kept.
+
+PyObject * MGLQueryPool_result(MGLQueryPool * self, PyObject * args) {
+	int index;
+	int wait;
+
+	int args_ok = PyArg_ParseTuple(
+		args,
+		"ip",
+		&index,
+		&wait
+	);
+
+	if (!args_ok) {
+		return 0;
+	}
+
+	if (!MGLQueryPool_valid(self, index)) {
+		return 0;
+	}
+
+	const GLMethods & gl = self->context->gl;
+
+	if (!wait) {
+		unsigned available = 0;
+		gl.GetQueryObjectuiv(self->query_obj[index], GL_QUERY_RESULT_AVAILABLE, &available);
+
+		if (!available) {
+			Py_RETURN_NONE;
+		}
+	}
+
+	GLuint64 result = 0;
+	gl.GetQueryObjectui64v(self->query_obj[index], GL_QUERY_RESULT, &result);
+
+	MGLQueryPool_recycle(self, index);
+	return PyLong_FromUnsignedLongLong(result);
+}
+
+PyObject * MGLQueryPool_discard(MGLQueryPool * self, PyObject * args) {
+	int index;
+
+	int args_ok = PyArg_ParseTuple(
+		args,
+		"i",
+		&index
+	);
+
+	if (!args_ok) {
+		return 0;
+	}
+
+	if (!MGLQueryPool_valid(self, index)) {
+		return 0;
+	}
+
+	MGLQueryPool_recycle(self, index);
+	Py_RETURN_NONE;
+}
+
+PyObject * MGLQueryPool_release(MGLQueryPool * self) {
+	MGLQueryPool_Invalidate(self);
+	Py_RETURN_NONE;
+}
+
+PyMethodDef MGLQueryPool_tp_methods[] = {
+	{"begin", (PyCFunction)MGLQueryPool_begin, METH_VARARGS, 0},
+	{"end", (PyCFunction)MGLQueryPool_end, METH_VARARGS, 0},
+	{"timestamp", (PyCFunction)MGLQueryPool_timestamp, METH_NOARGS, 0},
+	{"available", (PyCFunction)MGLQueryPool_available, METH_VARARGS, 0},
+	{"result", (PyCFunction)MGLQueryPool_result, METH_VARARGS, 0},
+	{"discard", (PyCFunction)MGLQueryPool_discard, METH_VARARGS, 0},
+	{"release", (PyCFunction)MGLQueryPool_release, METH_NOARGS, 0},
+	{0},
+};
+
+PyObject * MGLQueryPool_get_size(MGLQueryPool * self) {
+	return PyLong_FromLong(self->size);
+}
+
+PyObject * MGLQueryPool_get_free(MGLQueryPool * self) {
+	return PyLong_FromLong(self->free);
+}
+
+PyGetSetDef MGLQueryPool_tp_getseters[] = {
+	{(char *)"size", (getter)MGLQueryPool_get_size, 0, 0, 0},
+	{(char *)"free", (getter)MGLQueryPool_get_free, 0, 0, 0},
+	{0},
+};
+
+PyTypeObject MGLQueryPool_Type = {
+	PyVarObject_HEAD_INIT(0, 0)
+	"mgl.QueryPool",                                        // tp_name
+	sizeof(MGLQueryPool),                                   // tp_basicsize
+	0,                                                      // tp_itemsize
+	(destructor)MGLQueryPool_tp_dealloc,                    // tp_dealloc
+	0,                                                      // tp_print
+	0,                                                      // tp_getattr
+	0,                                                      // tp_setattr
+	0,                                                      // tp_reserved
+	0,                                                      // tp_repr
+	0,                                                      // tp_as_number
+	0,                                                      // tp_as_sequence
+	0,                                                      // tp_as_mapping
+	0,                                                      // tp_hash
+	0,                                                      // tp_call
+	0,                                                      // tp_str
+	0,                                                      // tp_getattro
+	0,                                                      // tp_setattro
+	0,                                                      // tp_as_buffer
+	Py_TPFLAGS_DEFAULT,                                     // tp_flags
+	0,                                                      // tp_doc
+	0,                                                      // tp_traverse
+	0,                                                      // tp_clear
+	0,                                                      // tp_richcompare
+	0,                                                      // tp_weaklistoffset
+	0,                                                      // tp_iter
+	0,                                                      // tp_iternext
+	MGLQueryPool_tp_methods,                                // tp_methods
+	0,                                                      // tp_members
+	MGLQueryPool_tp_getseters,                              // tp_getset
+	0,                                                      // tp_base
+	0,                                                      // tp_dict
+	0,                                                      // tp_descr_get
+	0,                                                      // tp_descr_set
+	0,                                                      // tp_dictoffset
+	0,                                                      // tp_init
+	0,                                                      // tp_alloc
+	MGLQueryPool_tp_new,                                    // tp_new
+};
+
+void MGLQueryPool_Invalidate(MGLQueryPool * pool) {
+	if (Py_TYPE(pool) == &MGLInvalidObject_Type) {
+		return;
+	}
+
+	const GLMethods & gl = pool->context->gl;
+	gl.DeleteQueries(pool->size, (GLuint *)pool->query_obj);
+
+	delete[] pool->query_obj;
+	delete[] pool->targets;
+	delete[] pool->free_list;
+
+	Py_DECREF(pool->context);
+
+	Py_TYPE(pool) = &MGLInvalidObject_Type;
+	Py_DECREF(pool);
+}
@@ -0,0 +1,374 @@
+#include "Types.hpp"
+
+PyObject * MGLContext_readback(MGLContext * self, PyObject * args) {
+	int args_ok = PyArg_ParseTuple(
+		args,
+		""
+	);
+
+	if (!args_ok) {
+		return 0;
+	}
+
+	MGLReadback * readback = (MGLReadback *)MGLReadback_Type.tp_alloc(&MGLReadback_Type, 0);
+
+	const GLMethods & gl = self->gl;
+
+	readback->buffer_obj = 0;
+	gl.GenBuffers(1, (GLuint *)&readback->buffer_obj);
+
+	if (!readback->buffer_obj) {
+		MGLError_Set("cannot create buffer");
+		Py_DECREF(readback);
+		return 0;
+	}
+
+	readback->capacity = 0;
+	readback->size = 0;
+	readback->fence = 0;
+	readback->mapping = 0;
+	readback->exports = 0;
+
+	Py_INCREF(self);
+	readback->context = self;
+
+	Py_INCREF(readback);
+
+	return (PyObject *)readback;
+}
+
+PyObject * MGLReadback_tp_new(PyTypeObject * type, PyObject * args, PyObject * kwargs) {
+	MGLReadback * self = (MGLReadback *)type->tp_alloc(type, 0);
+
+	if (self) {
+	}
+
+	return (PyObject *)self;
+}
+
+void MGLReadback_tp_dealloc(MGLReadback * self) {
+	MGLReadback_Type.tp_free((PyObject *)self);
+}
+
+void MGLReadback_unmap(MGLReadback * self) {
+	if (!self->mapping) {
+		return;
+	}
+
+	const GLMethods & gl = self->context->gl;
+	gl.BindBuffer(GL_PIXEL_PACK_BUFFER, self->buffer_obj);
+	gl.UnmapBuffer(GL_PIXEL_PACK_BUFFER);
+	gl.BindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+	self->mapping = 0;
+}
+
+bool MGLReadback_wait_fence(MGLReadback * self) {
+	if (!self->fence) {
+		return true;
+	}
+
+	const GLMethods & gl = self->context->gl;
+
+	GLenum status = gl.ClientWaitSync(self->fence, GL_SYNC_FLUSH_COMMANDS_BIT, 1000000000);
+	while (status == GL_TIMEOUT_EXPIRED) {
+		status = gl.ClientWaitSync(self->fence, 0, 1000000000);
+	}
+
+	gl.DeleteSync(self->fence);
+	self->fence = 0;
+
+	return status != GL_WAIT_FAILED;
+}
+
+PyObject * MGLReadback_read(MGLReadback * self, PyObject * args) {
+	MGLFramebuffer * framebuffer;
+	PyObject * viewport;
+	int components;
+	int attachment;
+	int alignment;
+	const char * dtype;
+	Py_ssize_t dtype_size;
+
+	int args_ok = PyArg_ParseTuple(
+		args,
+		"O!OIIIs#",
+		&MGLFramebuffer_Type,
+		&framebuffer,
+		&viewport,
+		&components,
+		&attachment,
+		&alignment,
+		&dtype,
+		&dtype_size
+	);
+
+	if (!args_ok) {
+		return 0;
+	}
+
+	if (self->exports) {
+		PyErr_Format(PyExc_BufferError, "Cannot read while the pixels are in use by memoryviews");
+		return 0;
+	}
+
+	if (alignment != 1 && alignment != 2 && alignment != 4 && alignment != 8) {
+		MGLError_Set("the alignment must be 1, 2, 4 or 8");
+		return 0;
+	}
+
+	if (dtype_size != 2) {
+		MGLError_Set("invalid dtype");
+		return 0;
+	}
+
+	MGLDataType * data_type = from_dtype(dtype);
+
+	if (!data_type) {
+		MGLError_Set("invalid dtype");
+		return 0;
+	}
+
+	int x = 0;
+	int y = 0;
+	int width = framebuffer->width;
+	int height = framebuffer->height;
+
+	if (viewport != Py_None) {
+		if (Py_TYPE(viewport) != &PyTuple_Type) {
+			MGLError_Set("the viewport must be a tuple not %s", Py_TYPE(viewport)->tp_name);
+			return 0;
+		}
+
+		if (PyTuple_GET_SIZE(viewport) == 4) {
+
+			x = PyLong_AsLong(PyTuple_GET_ITEM(viewport, 0));
+			y = PyLong_AsLong(PyTuple_GET_ITEM(viewport, 1));
+			width = PyLong_AsLong(PyTuple_GET_ITEM(viewport, 2));
+			height = PyLong_AsLong(PyTuple_GET_ITEM(viewport, 3));
+
+		} else if (PyTuple_GET_SIZE(viewport) == 2) {
+
+			width = PyLong_AsLong(PyTuple_GET_ITEM(viewport, 0));
+			height = PyLong_AsLong(PyTuple_GET_ITEM(viewport, 1));
+
+		} else {
+
+			MGLError_Set("the viewport size %d is invalid", PyTuple_GET_SIZE(viewport));
+			return 0;
+
+		}
+
+		if (PyErr_Occurred()) {
+			MGLError_Set("wrong values in the viewport");
+			return 0;
+		}
+
+	}
+
+	bool read_depth = false;
+
+	if (attachment == -1) {
+		components = 1;
+		read_depth = true;
+	}
+
+	int expected_size = width * components * data_type->size;
+	expected_size = (expected_size + alignment - 1) / alignment * alignment;
+	expected_size = expected_size * height;
+
+	int pixel_type = data_type->gl_type;
+	int base_format = read_depth ? GL_DEPTH_COMPONENT : data_type->base_format[components];
+
+	const GLMethods & gl = self->context->gl;
+
+	// The previous content is discarded, no views of it exist.
+
+	MGLReadback_unmap(self);
+
+	if (self->fence) {
+		gl.DeleteSync(self->fence);
+		self->fence = 0;
+	}
+
+	gl.BindBuffer(GL_PIXEL_PACK_BUFFER, self->buffer_obj);
+
+	if (self->capacity < expected_size) {
+		gl.BufferData(GL_PIXEL_PACK_BUFFER, expected_size, 0, GL_STREAM_READ);
+		self->capacity = expected_size;
+	}
+
+	self->size = expected_size;
+
+	gl.BindFramebuffer(GL_FRAMEBUFFER, framebuffer->framebuffer_obj);
+	gl.ReadBuffer(read_depth ? GL_NONE : (GL_COLOR_ATTACHMENT0 + attachment));
+	gl.PixelStorei(GL_PACK_ALIGNMENT, alignment);
+	gl.PixelStorei(GL_UNPACK_ALIGNMENT, alignment);
+	gl.ReadPixels(x, y, width, height, base_format, pixel_type, 0);
+	self->context->stats.bytes_read += expected_size;
+	gl.BindFramebuffer(GL_FRAMEBUFFER, self->context->bound_framebuffer->framebuffer_obj);
+	gl.BindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+
+	self->fence = gl.FenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+	gl.Flush();
+
+	return PyLong_FromLong(expected_size);
+}
+
+PyObject * MGLReadback_ready(MGLReadback * self) {
+	if (!self->fence) {
+		Py_RETURN_TRUE;
+	}
+
+	const GLMethods & gl = self->context->gl;
+
+	GLenum status = gl.ClientWaitSync(self->fence, 0, 0);
+
+	if (status == GL_ALREADY_SIGNALED || status == GL_CONDITION_SATISFIED) {
+		Py_RETURN_TRUE;
+	}
+
+	Py_RETURN_FALSE;
+}
+
+PyObject * MGLReadback_wait(MGLReadback * self) {
+	if (!MGLReadback_wait_fence(self)) {
+		MGLError_Set("cannot wait for the pixels");
+		return 0;
+	}
+
+	Py_RETURN_NONE;
+}
+
+PyObject * MGLReadback_release(MGLReadback * self) {
+	if (self->exports) {
+		PyErr_Format(PyExc_BufferError, "Cannot release while the pixels are in use by memoryviews");
+		return 0;
+	}
+
+	MGLReadback_Invalidate(self);
+	Py_RETURN_NONE;
+}
+
+PyMethodDef MGLReadback_tp_methods[] = {
+	{"read", (PyCFunction)MGLReadback_read, METH_VARARGS, 0},
+	{"ready", (PyCFunction)MGLReadback_ready, METH_NOARGS, 0},
+	{"wait", (PyCFunction)MGLReadback_wait, METH_NOARGS, 0},
+	{"release", (PyCFunction)MGLReadback_release, METH_NOARGS, 0},
+	{0},
+};
+
+PyObject * MGLReadback_get_size(MGLReadback * self) {
+	return PyLong_FromSsize_t(self->size);
+}
+
+PyGetSetDef MGLReadback_tp_getseters[] = {
+	{(char *)"size", (getter)MGLReadback_get_size, 0, 0, 0},
+	{0},
+};
+
+// The pixels are exposed directly from the mapped pixel pack buffer.
+// The mapping is kept until the next read or release, both fail while views of it exist.
+
+int MGLReadback_tp_as_buffer_get_view(MGLReadback * self, Py_buffer * view, int flags) {
+	if (!self->size) {
+		PyErr_Format(PyExc_BufferError, "Nothing was read");
+		view->obj = 0;
+		return -1;
+	}
+
+	if (!MGLReadback_wait_fence(self)) {
+		PyErr_Format(PyExc_BufferError, "Cannot wait for the pixels");
+		view->obj = 0;
+		return -1;
+	}
+
+	if (!self->mapping) {
+		const GLMethods & gl = self->context->gl;
+		gl.BindBuffer(GL_PIXEL_PACK_BUFFER, self->buffer_obj);
+		self->mapping = (char *)gl.MapBufferRange(GL_PIXEL_PACK_BUFFER, 0, self->size, GL_MAP_READ_BIT);
+		gl.BindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+	}
+
+	if (!self->mapping) {
+		PyErr_Format(PyExc_BufferError, "Cannot map buffer");
+		view->obj = 0;
+		return -1;
+	}
+
+	if (PyBuffer_FillInfo(view, (PyObject *)self, self->mapping, self->size, 1, flags) < 0) {
+		return -1;
+	}
+
+	self->exports += 1;
+	return 0;
+}
+
+void MGLReadback_tp_as_buffer_release_view(MGLReadback * self, Py_buffer * view) {
+	self->exports -= 1;
+}
+
+PyBufferProcs MGLReadback_tp_as_buffer = {
+	(getbufferproc)MGLReadback_tp_as_buffer_get_view,                // getbufferproc bf_getbuffer
+	(releasebufferproc)MGLReadback_tp_as_buffer_release_view,        // releasebufferproc bf_releasebuffer
+};
+
+PyTypeObject MGLReadback_Type = {
+	PyVarObject_HEAD_INIT(0, 0)
+	"mgl.Readback",                                         // tp_name
+	sizeof(MGLReadback),                                    // tp_basicsize
+	0,                                                      // tp_itemsize
+	(destructor)MGLReadback_tp_dealloc,                     // tp_dealloc
+	0,                                                      // tp_print
+	0,                                                      // tp_getattr
+	0,                                                      // tp_setattr
+	0,                                                      // tp_reserved
+	0,                                                      // tp_repr
+	0,                                                      // tp_as_number
+	0,                                                      // tp_as_sequence
+	0,                                                      // tp_as_mapping
+	0,                                                      // tp_hash
+	0,                                                      // tp_call
+	0,                                                      // tp_str
+	0,                                                      // tp_getattro
+	0,                                                      // tp_setattro
+	&MGLReadback_tp_as_buffer,                              // tp_as_buffer
+	Py_TPFLAGS_DEFAULT,                                     // tp_flags
+	0,                                                      // tp_doc
+	0,                                                      // tp_traverse
+	0,                                                      // tp_clear
+	0,                                                      // tp_richcompare
+	0,                                                      // tp_weaklistoffset
+	0,                                                      // tp_iter
+	0,                                                      // tp_iternext
+	MGLReadback_tp_methods,                                 // tp_methods
+	0,                                                      // tp_members
+	MGLReadback_tp_getseters,                               // tp_getset
+	0,                                                      // tp_base
+	0,                                                      // tp_dict
+	0,                                                      // tp_descr_get
+	0,                                                      // tp_descr_set
+	0,                                                      // tp_dictoffset
+	0,                                                      // tp_init
+	0,                                                      // tp_alloc
+	MGLReadback_tp_new,                                     // tp_new
+};
+
+void MGLReadback_Invalidate(MGLReadback * readback) {
+	if (Py_TYPE(readback) == &MGLInvalidObject_Type) {
+		return;
+	}
+
+	const GLMethods & gl = readback->context->gl;
+
+	MGLReadback_unmap(readback);
+
+	if (readback->fence) {
+		gl.DeleteSync(readback->fence);
+	}
+
+	gl.DeleteBuffers(1, (GLuint *)&readback->buffer_obj);
+
+	Py_TYPE(readback) = &MGLInvalidObject_Type;
+	Py_DECREF(readback->context);
+	Py_DECREF(readback);
+}
@@ -51,13 +51,14 @@ PyObject * MGLContext_scope(MGLContext * self, PyObject * args) {
 	int num_textures = (int)PyTuple_Size(textures);
 	int num_uniform_buffers = (int)PyTuple_Size(uniform_buffers);
 	int num_shader_storage_buffers = (int)PyTuple_Size(shader_storage_buffers);
+	int num_samplers = (int)PyTuple_Size(samplers);
 
-	scope->num_textures = num_textures;
-	scope->textures = new int[scope->num_textures * 3];
-	scope->num_buffers = num_uniform_buffers + num_shader_storage_buffers;
-	scope->buffers = new int[scope->num_buffers * 3];
+	// Everything is resolved into a single table, entering the scope does not touch python objects.
 
-	scope->samplers = PySequence_Fast(samplers, "not iterable");
+	scope->num_bindings = num_textures + num_uniform_buffers + num_shader_storage_buffers + num_samplers;
+	scope->bindings = new MGLScopeBinding[scope->num_bindings];
+
+	MGLScopeBinding * binding = scope->bindings;
 
 	for (int i = 0; i < num_textures; ++i) {
 		PyObject * tup = PyTuple_GET_ITEM(textures, i);
@@ -74,6 +75,10 @@ PyObject * MGLContext_scope(MGLContext * self, PyObject * args) {
 			MGLTexture3D * texture = (MGLTexture3D *)item;
 			texture_type = GL_TEXTURE_3D;
 			texture_obj = texture->texture_obj;
+		} else if (Py_TYPE(item) == &MGLTextureArray_Type) {
+			MGLTextureArray * texture = (MGLTextureArray *)item;
+			texture_type = GL_TEXTURE_2D_ARRAY;
+			texture_obj = texture->texture_obj;
 		} else if (Py_TYPE(item) == &MGLTextureCube_Type) {
 			MGLTextureCube * texture = (MGLTextureCube *)item;
 			texture_type = GL_TEXTURE_CUBE_MAP;
@@ -83,43 +88,48 @@ PyObject * MGLContext_scope(MGLContext * self, PyObject * args) {
 			return 0;
 		}
 
-		int binding = PyLong_AsLong(PyTuple_GET_ITEM(tup, 1));
-		scope->textures[i * 3 + 0] = GL_TEXTURE0 + binding;
-		scope->textures[i * 3 + 1] = texture_type;
-		scope->textures[i * 3 + 2] = texture_obj;
+		binding->target = texture_type;
+		binding->unit = PyLong_AsLong(PyTuple_GET_ITEM(tup, 1));
+		binding->name = texture_obj;
+		++binding;
 	}
 
-	for (int i = 0; i < num_uniform_buffers; ++i) {
-		PyObject * tup = PyTuple_GET_ITEM(uniform_buffers, i);
+	for (int i = 0; i < num_uniform_buffers + num_shader_storage_buffers; ++i) {
+		bool uniform = i < num_uniform_buffers;
+		PyObject * tup = uniform ? PyTuple_GET_ITEM(uniform_buffers, i) : PyTuple_GET_ITEM(shader_storage_buffers, i - num_uniform_buffers);
 		MGLBuffer * buffer = (MGLBuffer *)PyTuple_GET_ITEM(tup, 0);
 
-		if (Py_TYPE(buffer) == &MGLBuffer_Type) {
-			int binding = PyLong_AsLong(PyTuple_GET_ITEM(tup, 1));
-			scope->buffers[i * 3 + 0] = GL_UNIFORM_BUFFER;
-			scope->buffers[i * 3 + 1] = buffer->buffer_obj;
-			scope->buffers[i * 3 + 2] = binding;
-		} else {
+		if (Py_TYPE(buffer) != &MGLBuffer_Type) {
 			MGLError_Set("invalid buffer");
 			return 0;
 		}
-	}
 
-	int base = num_uniform_buffers * 3;
+		binding->target = uniform ? GL_UNIFORM_BUFFER : GL_SHADER_STORAGE_BUFFER;
+		binding->unit = PyLong_AsLong(PyTuple_GET_ITEM(tup, 1));
+		binding->name = buffer->buffer_obj;
+		++binding;
+	}
 
-	for (int i = 0; i < num_shader_storage_buffers; ++i) {
-		PyObject * tup = PyTuple_GET_ITEM(shader_storage_buffers, i);
-		MGLBuffer * buffer = (MGLBuffer *)PyTuple_GET_ITEM(tup, 0);
+	for (int i = 0; i < num_samplers; ++i) {
+		PyObject * tup = PyTuple_GET_ITEM(samplers, i);
+		MGLSampler * sampler = (MGLSampler *)PyTuple_GET_ITEM(tup, 0);
 
-		if (Py_TYPE(buffer) == &MGLBuffer_Type) {
-			int binding = PyLong_AsLong(PyTuple_GET_ITEM(tup, 1));
-			scope->buffers[base + i * 3 + 0] = GL_SHADER_STORAGE_BUFFER;
-			scope->buffers[base + i * 3 + 1] = buffer->buffer_obj;
-			scope->buffers[base + i * 3 + 2] = binding;
-		} else {
-			MGLError_Set("invalid buffer");
+		if (Py_TYPE(sampler) != &MGLSampler_Type) {
+			MGLError_Set("invalid sampler");
 			return 0;
 		}
+
+		binding->target = GL_SAMPLER_BINDING;
+		binding->unit = PyLong_AsLong(PyTuple_GET_ITEM(tup, 1));
+		binding->name = sampler->sampler_obj;
+		++binding;
 	}
+
+	if (PyErr_Occurred()) {
+		MGLError_Set("invalid binding");
+		return 0;
+	}
+
 	Py_INCREF(scope);
 
 	return (PyObject *)scope;
@@ -129,8 +139,8 @@ PyObject * MGLScope_tp_new(PyTypeObject * type, PyObject * args, PyObject * kwar
 	MGLScope * self = (MGLScope *)type->tp_alloc(type, 0);
 
 	if (self) {
-		self->textures = 0;
-		self->buffers = 0;
+		self->bindings = 0;
+		self->num_bindings = 0;
 	}
 
 	return (PyObject *)self;
@@ -142,125 +152,44 @@ void MGLScope_tp_dealloc(MGLScope * self) {
 
 extern PyObject * MGLFramebuffer_use(MGLFramebuffer * self);
 
-PyObject * MGLScope_begin(MGLScope * self, PyObject * args) {
-	int args_ok = PyArg_ParseTuple(
-		args,
-		""
-	);
+PyObject * MGLScope_begin(MGLScope * self) {
+	MGLContext * context = self->context;
 
-	if (!args_ok) {
-		return 0;
-	}
+	self->old_enable_flags = context->enable_flags;
 
-	const GLMethods & gl = self->context->gl;
-	const int & flags = self->enable_flags;
+	PyObject * result = MGLFramebuffer_use(self->framebuffer);
+	Py_XDECREF(result);
 
-	self->old_enable_flags = self->context->enable_flags;
-	self->context->enable_flags = self->enable_flags;
+	for (int i = 0; i < self->num_bindings; ++i) {
+		MGLScopeBinding & binding = self->bindings[i];
 
-	MGLFramebuffer_use(self->framebuffer);
+		switch (binding.target) {
+			case GL_UNIFORM_BUFFER:
+			case GL_SHADER_STORAGE_BUFFER:
+				MGLContext_bind_buffer_range(context, binding.target, binding.unit, binding.name, 0, -1);
+				break;
 
-	for (int i = 0; i < self->num_textures; ++i) {
-		gl.ActiveTexture(self->textures[i * 3]);
-		gl.BindTexture(self->textures[i * 3 + 1], self->textures[i * 3 + 2]);
-	}
+			case GL_SAMPLER_BINDING:
+				MGLContext_bind_sampler(context, binding.unit, binding.name);
+				break;
 
-	for (int i = 0; i < self->num_buffers; ++i) {
-		gl.BindBufferBase(self->buffers[i * 3], self->buffers[i * 3 + 2], self->buffers[i * 3 + 1]);
-	}
-
-	int num_samplers = (int)PySequence_Fast_GET_SIZE(self->samplers);
-	for (int i = 0; i < num_samplers; ++i) {
-		PyObject * pair = PySequence_Fast(PySequence_Fast_GET_ITEM(self->samplers, i), "not iterable");
-		if (PySequence_Fast_GET_SIZE(pair) != 2) {
-			return NULL;
+			default:
+				MGLContext_bind_texture(context, binding.unit, binding.target, binding.name);
+				break;
 		}
-		PyObject * call = PyObject_CallMethod(PySequence_Fast_GET_ITEM(pair, 0), "use", "O", PySequence_Fast_GET_ITEM(pair, 1));
-		Py_XDECREF(call);
-		if (!call) {
-			return NULL;
-		}
-	}
-
-	if (flags & MGL_BLEND) {
-		gl.Enable(GL_BLEND);
-	} else {
-		gl.Disable(GL_BLEND);
 	}
 
-	if (flags & MGL_DEPTH_TEST) {
-		gl.Enable(GL_DEPTH_TEST);
-	} else {
-		gl.Disable(GL_DEPTH_TEST);
-	}
-
-	if (flags & MGL_CULL_FACE) {
-		gl.Enable(GL_CULL_FACE);
-	} else {
-		gl.Disable(GL_CULL_FACE);
-	}
-
-	if (flags & MGL_RASTERIZER_DISCARD) {
-		gl.Enable(GL_RASTERIZER_DISCARD);
-	} else {
-		gl.Disable(GL_RASTERIZER_DISCARD);
-	}
-
-	if (flags & MGL_PROGRAM_POINT_SIZE) {
-		gl.Enable(GL_PROGRAM_POINT_SIZE);
-	} else {
-		gl.Disable(GL_PROGRAM_POINT_SIZE);
-	}
+	// Only the flags different from the current ones are changed.
+	MGLContext_set_enable_flags(context, self->enable_flags);
 
 	Py_RETURN_NONE;
 }
 
-PyObject * MGLScope_end(MGLScope * self, PyObject * args) {
-	int args_ok = PyArg_ParseTuple(
-		args,
-		""
-	);
-
-	if (!args_ok) {
-		return 0;
-	}
+PyObject * MGLScope_end(MGLScope * self) {
+	PyObject * result = MGLFramebuffer_use(self->old_framebuffer);
+	Py_XDECREF(result);
 
-	const GLMethods & gl = self->context->gl;
-	const int & flags = self->old_enable_flags;
-
-	self->context->enable_flags = self->old_enable_flags;
-
-	MGLFramebuffer_use(self->old_framebuffer);
-
-	if (flags & MGL_BLEND) {
-		gl.Enable(GL_BLEND);
-	} else {
-		gl.Disable(GL_BLEND);
-	}
-
-	if (flags & MGL_DEPTH_TEST) {
-		gl.Enable(GL_DEPTH_TEST);
-	} else {
-		gl.Disable(GL_DEPTH_TEST);
-	}
-
-	if (flags & MGL_CULL_FACE) {
-		gl.Enable(GL_CULL_FACE);
-	} else {
-		gl.Disable(GL_CULL_FACE);
-	}
-
-	if (flags & MGL_RASTERIZER_DISCARD) {
-		gl.Enable(GL_RASTERIZER_DISCARD);
-	} else {
-		gl.Disable(GL_RASTERIZER_DISCARD);
-	}
-
-	if (flags & MGL_PROGRAM_POINT_SIZE) {
-		gl.Enable(GL_PROGRAM_POINT_SIZE);
-	} else {
-		gl.Disable(GL_PROGRAM_POINT_SIZE);
-	}
+	MGLContext_set_enable_flags(self->context, self->old_enable_flags);
 
 	Py_RETURN_NONE;
 }
@@ -271,8 +200,8 @@ PyObject * MGLScope_release(MGLScope * self) {
 }
 
 PyMethodDef MGLScope_tp_methods[] = {
-	{"begin", (PyCFunction)MGLScope_begin, METH_VARARGS, 0},
-	{"end", (PyCFunction)MGLScope_end, METH_VARARGS, 0},
+	{"begin", (PyCFunction)MGLScope_begin, METH_NOARGS, 0},
+	{"end", (PyCFunction)MGLScope_end, METH_NOARGS, 0},
 	{"release", (PyCFunction)MGLScope_release, METH_NOARGS, 0},
 	{0},
 };
@@ -330,6 +259,8 @@ void MGLScope_Invalidate(MGLScope * scope) {
 	Py_DECREF(scope->framebuffer);
 	Py_DECREF(scope->old_framebuffer);
 
+	delete[] scope->bindings;
+
 	Py_DECREF(scope->context);
 	Py_TYPE(scope) = &MGLInvalidObject_Type;
 	Py_DECREF(scope);
@@ -0,0 +1,303 @@
+#include "Types.hpp"
+
+PyObject * MGLContext_stream_buffer(MGLContext * self, PyObject * args) {
+	MGLBuffer * buffer;
+	int regions;
+
+	int args_ok = PyArg_ParseTuple(
+		args,
+		"O!I",
+		&MGLBuffer_Type,
+		&buffer,
+		&regions
+	);
+
+	if (!args_ok) {
+		return 0;
+	}
+
+	if (regions < 1 || buffer->size / regions < 1) {
+		MGLError_Set("invalid number of regions = %d", regions);
+		return 0;
+	}
+
+	MGLStreamBuffer * stream = (MGLStreamBuffer *)MGLStreamBuffer_Type.tp_alloc(&MGLStreamBuffer_Type, 0);
+
+	stream->regions = regions;
+	stream->region_size = buffer->size / regions;
+	stream->region = 0;
+	stream->cursor = 0;
+
+	stream->fences = new GLsync[regions];
+	for (int i = 0; i < regions; ++i) {
+		stream->fences[i] = 0;
+	}
+
+	Py_INCREF(buffer);
+	stream->buffer = buffer;
+
+	Py_INCREF(self);
+	stream->context = self;
+
+	Py_INCREF(stream);
+
+	return (PyObject *)stream;
+}
+
+PyObject * MGLStreamBuffer_tp_new(PyTypeObject * type, PyObject * args, PyObject * kwargs) {
+	MGLStreamBuffer * self = (MGLStreamBuffer *)type->tp_alloc(type, 0);
+
+	if (self) {
+	}
+
+	return (PyObject *)self;
+}
+
+void MGLStreamBuffer_tp_dealloc(MGLStreamBuffer * self) {
+	MGLStreamBuffer_Type.tp_free((PyObject *)self);
+}
+
+// Bump allocation inside the current region.
+// The alignment applies to the absolute offset in the underlying buffer.
+// Returns the absolute offset in the underlying buffer or -1 when the region is full.
+
+inline Py_ssize_t MGLStreamBuffer_alloc(MGLStreamBuffer * self, Py_ssize_t size, Py_ssize_t alignment) {
+	Py_ssize_t base = self->region * self->region_size;
+	Py_ssize_t offset = (base + self->cursor + alignment - 1) / alignment * alignment;
+	Py_ssize_t cursor = offset - base;
+
+	if (cursor + size > self->region_size) {
+		return -1;
+	}
+
+	self->cursor = cursor + size;
+	return offset;
+}
+
+PyObject * MGLStreamBuffer_allocate(MGLStreamBuffer * self, PyObject * args) {
+	Py_ssize_t size;
+	Py_ssize_t alignment;
+
+	int args_ok = PyArg_ParseTuple(
+		args,
+		"nn",
+		&size,
+		&alignment
+	);
+
+	if (!args_ok) {
+		return 0;
+	}
+
+	if (size < 0 || alignment < 1) {
+		MGLError_Set("invalid size = %d or alignment = %d", size, alignment);
+		return 0;
+	}
+
+	Py_ssize_t offset = MGLStreamBuffer_alloc(self, size, alignment);
+
+	if (offset < 0) {
+		MGLError_Set("the region is full (%d bytes requested, %d bytes free)", size, self->region_size - self->cursor);
+		return 0;
+	}
+
+	return PyLong_FromSsize_t(offset);
+}
+
+PyObject * MGLStreamBuffer_write(MGLStreamBuffer * self, PyObject * args) {
+	PyObject * data;
+	Py_ssize_t alignment;
+
+	int args_ok = PyArg_ParseTuple(
+		args,
+		"On",
+		&data,
+		&alignment
+	);
+
+	if (!args_ok) {
+		return 0;
+	}
+
+	if (alignment < 1) {
+		MGLError_Set("invalid alignment = %d", alignment);
+		return 0;
+	}
+
+	Py_buffer buffer_view;
+
+	int get_buffer = PyObject_GetBuffer(data, &buffer_view, PyBUF_SIMPLE);
+	if (get_buffer < 0) {
+		// Propagate the default error
+		return 0;
+	}
+
+	Py_ssize_t offset = MGLStreamBuffer_alloc(self, buffer_view.len, alignment);
+
+	if (offset < 0) {
+		MGLError_Set("the region is full (%d bytes requested, %d bytes free)", buffer_view.len, self->region_size - self->cursor);
+		PyBuffer_Release(&buffer_view);
+		return 0;
+	}
+
+	if (!buffer_view.len) {
+		PyBuffer_Release(&buffer_view);
+		return PyLong_FromSsize_t(offset);
+	}
+
+	MGLBuffer * buffer = self->buffer;
+
+	// The fences guarantee the GPU is no longer reading the current region.
+
+	if (buffer->persistent) {
+		memcpy(buffer->mapping + offset, buffer_view.buf, buffer_view.len);
+	} else {
+		const GLMethods & gl = self->context->gl;
+		const int access = GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_RANGE_BIT | GL_MAP_UNSYNCHRONIZED_BIT;
+
+		gl.BindBuffer(GL_ARRAY_BUFFER, buffer->buffer_obj);
+		void * map = gl.MapBufferRange(GL_ARRAY_BUFFER, offset, buffer_view.len, access);
+
+		if (!map) {
+			MGLError_Set("cannot map the buffer");
+			PyBuffer_Release(&buffer_view);
+			return 0;
+		}
+
+		memcpy(map, buffer_view.buf, buffer_view.len);
+		gl.UnmapBuffer(GL_ARRAY_BUFFER);
+	}
+
+	self->context->stats.bytes_written += buffer_view.len;
+	PyBuffer_Release(&buffer_view);
+	return PyLong_FromSsize_t(offset);
+}
+
+PyObject * MGLStreamBuffer_next_frame(MGLStreamBuffer * self) {
+	const GLMethods & gl = self->context->gl;
+
+	if (self->fences[self->region]) {
+		gl.DeleteSync(self->fences[self->region]);
+	}
+
+	self->fences[self->region] = gl.FenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+
+	self->region = (self->region + 1) % self->regions;
+	self->cursor = 0;
+
+	GLsync fence = self->fences[self->region];
+
+	if (!fence) {
+		Py_RETURN_NONE;
+	}
+
+	GLenum status = gl.ClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, 1000000000);
+	while (status == GL_TIMEOUT_EXPIRED) {
+		status = gl.ClientWaitSync(fence, 0, 1000000000);
+	}
+
+	gl.DeleteSync(fence);
+	self->fences[self->region] = 0;
+
+	if (status == GL_WAIT_FAILED) {
+		MGLError_Set("cannot wait for the region");
+		return 0;
+	}
+
+	Py_RETURN_NONE;
+}
+
+PyObject * MGLStreamBuffer_release(MGLStreamBuffer * self) {
+	MGLStreamBuffer_Invalidate(self);
+	Py_RETURN_NONE;
+}
+
+PyMethodDef MGLStreamBuffer_tp_methods[] = {
+	{"allocate", (PyCFunction)MGLStreamBuffer_allocate, METH_VARARGS, 0},
+	{"write", (PyCFunction)MGLStreamBuffer_write, METH_VARARGS, 0},
+	{"next_frame", (PyCFunction)MGLStreamBuffer_next_frame, METH_NOARGS, 0},
+	{"release", (PyCFunction)MGLStreamBuffer_release, METH_NOARGS, 0},
+	{0},
+};
+
+PyObject * MGLStreamBuffer_get_region(MGLStreamBuffer * self) {
+	return PyLong_FromLong(self->region);
+}
+
+PyObject * MGLStreamBuffer_get_region_size(MGLStreamBuffer * self) {
+	return PyLong_FromSsize_t(self->region_size);
+}
+
+PyObject * MGLStreamBuffer_get_free(MGLStreamBuffer * self) {
+	return PyLong_FromSsize_t(self->region_size - self->cursor);
+}
+
+PyGetSetDef MGLStreamBuffer_tp_getseters[] = {
+	{(char *)"region", (getter)MGLStreamBuffer_get_region, 0, 0, 0},
+	{(char *)"region_size", (getter)MGLStreamBuffer_get_region_size, 0, 0, 0},
+	{(char *)"free", (getter)MGLStreamBuffer_get_free, 0, 0, 0},
+	{0},
+};
+
+PyTypeObject MGLStreamBuffer_Type = {
+	PyVarObject_HEAD_INIT(0, 0)
+	"mgl.StreamBuffer",                                     // tp_name
+	sizeof(MGLStreamBuffer),                                // tp_basicsize
+	0,                                                      // tp_itemsize
+	(destructor)MGLStreamBuffer_tp_dealloc,                 // tp_dealloc
+	0,                                                      // tp_print
+	0,                                                      // tp_getattr
+	0,                                                      // tp_setattr
+	0,                                                      // tp_reserved
+	0,                                                      // tp_repr
+	0,                                                      // tp_as_number
+	0,                                                      // tp_as_sequence
+	0,                                                      // tp_as_mapping
+	0,                                                      // tp_hash
+	0,                                                      // tp_call
+	0,                                                      // tp_str
+	0,                                                      // tp_getattro
+	0,                                                      // tp_setattro
+	0,                                                      // tp_as_buffer
+	Py_TPFLAGS_DEFAULT,                                     // tp_flags
+	0,                                                      // tp_doc
+	0,                                                      // tp_traverse
+	0,                                                      // tp_clear
+	0,                                                      // tp_richcompare
+	0,                                                      // tp_weaklistoffset
+	0,                                                      // tp_iter
+	0,                                                      // tp_iternext
+	MGLStreamBuffer_tp_methods,                             // tp_methods
+	0,                                                      // tp_members
+	MGLStreamBuffer_tp_getseters,                           // tp_getset
+	0,                                                      // tp_base
+	0,                                                      // tp_dict
+	0,                                                      // tp_descr_get
+	0,                                                      // tp_descr_set
+	0,                                                      // tp_dictoffset
+	0,                                                      // tp_init
+	0,                                                      // tp_alloc
+	MGLStreamBuffer_tp_new,                                 // tp_new
+};
+
+void MGLStreamBuffer_Invalidate(MGLStreamBuffer * stream) {
+	if (Py_TYPE(stream) == &MGLInvalidObject_Type) {
+		return;
+	}
+
+	const GLMethods & gl = stream->context->gl;
+
+	for (int i = 0; i < stream->regions; ++i) {
+		if (stream->fences[i]) {
+			gl.DeleteSync(stream->fences[i]);
+		}
+	}
+
+	delete[] stream->fences;
+
+	Py_DECREF(stream->buffer);
+	Py_DECREF(stream->context);
+
+	Py_TYPE(stream) = &MGLInvalidObject_Type;
+	Py_DECREF(stream);
+}
@@ -16,10 +16,11 @@ PyObject * MGLContext_texture(MGLContext * self, PyObject * args) {
 	const char * dtype;
 	Py_ssize_t dtype_size;
 	int internal_format_override;
+	int levels;
 
 	int args_ok = PyArg_ParseTuple(
 		args,
-		"(II)IOIIs#I",
+		"(II)IOIIs#Ii",
 		&width,
 		&height,
 		&components,
@@ -28,7 +29,8 @@ PyObject * MGLContext_texture(MGLContext * self, PyObject * args) {
 		&alignment,
 		&dtype,
 		&dtype_size,
-		&internal_format_override
+		&internal_format_override,
+		&levels
 	);
 
 	if (!args_ok) {
@@ -55,8 +57,8 @@ PyObject * MGLContext_texture(MGLContext * self, PyObject * args) {
 		return 0;
 	}
 
-	if (dtype_size != 2) {
-		MGLError_Set("invalid dtype");
+	if (samples && levels > 1) {
+		MGLError_Set("multisample textures have a single level");
 		return 0;
 	}
 
@@ -67,10 +69,35 @@ PyObject * MGLContext_texture(MGLContext * self, PyObject * args) {
 		return 0;
 	}
 
+	if (samples && data_type->block_size) {
+		MGLError_Set("multisample textures cannot be compressed");
+		return 0;
+	}
+
+	int max_levels = mipmap_levels(width, height, 1);
+
+	if (levels < 0) {
+		levels = samples ? 1 : max_levels;
+	}
+
+	if (levels > max_levels) {
+		MGLError_Set("the number of levels must be at most %d", max_levels);
+		return 0;
+	}
+
+	if (levels && !self->texture_storage) {
+		MGLError_Set("immutable textures require OpenGL 4.2 or GL_ARB_texture_storage");
+		return 0;
+	}
+
 	int expected_size = width * components * data_type->size;
 	expected_size = (expected_size + alignment - 1) / alignment * alignment;
 	expected_size = expected_size * height;
 
+	if (data_type->block_size) {
+		expected_size = (int)compressed_size(data_type, width, height, 1);
+	}
+
 	Py_buffer buffer_view;
 
 	if (data != Py_None) {
@@ -114,12 +141,29 @@ PyObject * MGLContext_texture(MGLContext * self, PyObject * args) {
 
 	gl.BindTexture(texture_target, texture->texture_obj);
 
-	if (samples) {
+	if (samples && levels && gl.TexStorage2DMultisample) {
+		gl.TexStorage2DMultisample(texture_target, samples, internal_format, width, height, true);
+	} else if (samples) {
 		gl.TexImage2DMultisample(texture_target, samples, internal_format, width, height, true);
 	} else {
 		gl.PixelStorei(GL_PACK_ALIGNMENT, alignment);
 		gl.PixelStorei(GL_UNPACK_ALIGNMENT, alignment);
-		gl.TexImage2D(texture_target, 0, internal_format, width, height, 0, base_format, pixel_type, buffer_view.buf);
+		if (levels) {
+			gl.TexStorage2D(texture_target, levels, internal_format, width, height);
+			if (data != Py_None) {
+				if (data_type->block_size) {
+					gl.CompressedTexSubImage2D(texture_target, 0, 0, 0, width, height, internal_format, expected_size, buffer_view.buf);
+				} else {
+					gl.TexSubImage2D(texture_target, 0, 0, 0, width, height, base_format, pixel_type, buffer_view.buf);
+				}
+			}
+		} else {
+			if (data_type->block_size) {
+				gl.CompressedTexImage2D(texture_target, 0, internal_format, width, height, 0, expected_size, buffer_view.buf);
+			} else {
+				gl.TexImage2D(texture_target, 0, internal_format, width, height, 0, base_format, pixel_type, buffer_view.buf);
+			}
+		}
 		if (data_type->float_type) {
 			gl.TexParameteri(texture_target, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
 			gl.TexParameteri(texture_target, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
@@ -139,7 +183,8 @@ PyObject * MGLContext_texture(MGLContext * self, PyObject * args) {
 	texture->samples = samples;
 	texture->data_type = data_type;
 
-	texture->max_level = 0;
+	texture->immutable = levels != 0;
+	texture->max_level = levels ? levels - 1 : 0;
 	texture->compare_func = 0;
 	texture->anisotropy = 1.0f;
 	texture->depth = false;
@@ -370,10 +415,95 @@ PyObject * MGLTexture_read(MGLTexture * self, PyObject * args) {
 	// printf("level_height: %d\n", level_height);
 
 	gl.GetTexImage(GL_TEXTURE_2D, level, base_format, pixel_type, data);
+	self->context->stats.bytes_read += expected_size;
 
 	return result;
 }
 
+PyObject * MGLTexture_read_array(MGLTexture * self, PyObject * args) {
+	int level;
+	int channels;
+	int flip;
+
+	int args_ok = PyArg_ParseTuple(
+		args,
+		"IIp",
+		&level,
+		&channels,
+		&flip
+	);
+
+	if (!args_ok) {
+		return 0;
+	}
+
+	if (level > self->max_level) {
+		MGLError_Set("invalid level");
+		return 0;
+	}
+
+	if (self->samples) {
+		MGLError_Set("multisample textures cannot be read directly");
+		return 0;
+	}
+
+	if (channels < 1 || channels > self->components) {
+		MGLError_Set("the channels must be between 1 and %d", self->components);
+		return 0;
+	}
+
+	int width = self->width / (1 << level);
+	int height = self->height / (1 << level);
+
+	width = width > 1 ? width : 1;
+	height = height > 1 ? height : 1;
+
+	MGLPixels * pixels = MGLPixels_New(self->data_type, width, height, channels);
+
+	if (!pixels) {
+		return 0;
+	}
+
+	bool convert = flip || channels != self->components;
+	char * data = pixels->data;
+
+	if (convert) {
+		data = (char *)PyMem_Malloc((Py_ssize_t)width * height * self->components * self->data_type->size);
+
+		if (!data) {
+			Py_DECREF(pixels);
+			return PyErr_NoMemory();
+		}
+	}
+
+	int pixel_type = self->data_type->gl_type;
+	int base_format = self->depth ? GL_DEPTH_COMPONENT : self->data_type->base_format[self->components];
+
+	const GLMethods & gl = self->context->gl;
+
+	gl.ActiveTexture(GL_TEXTURE0 + self->context->default_texture_unit);
+	gl.BindTexture(GL_TEXTURE_2D, self->texture_obj);
+
+	gl.PixelStorei(GL_PACK_ALIGNMENT, 1);
+	gl.PixelStorei(GL_UNPACK_ALIGNMENT, 1);
+
+	gl.GetTexImage(GL_TEXTURE_2D, level, base_format, pixel_type, data);
+	self->context->stats.bytes_read += (long long)width * height * self->components * self->data_type->size;
+
+	if (convert) {
+		int src_pixel = self->components * self->data_type->size;
+		int dst_pixel = channels * self->data_type->size;
+
+		Py_BEGIN_ALLOW_THREADS
+		MGLPixels_copy(pixels->data, data, width, height, src_pixel, dst_pixel, flip);
+		Py_END_ALLOW_THREADS
+
+		PyMem_Free(data);
+	}
+
+	return (PyObject *)pixels;
+}
+
 PyObject * MGLTexture_read_into(MGLTexture * self, PyObject * args) {
 	PyObject * data;
 	int level;
@@ -460,6 +590,7 @@ PyObject * MGLTexture_read_into(MGLTexture * self, PyObject * args) {
 		gl.PixelStorei(GL_PACK_ALIGNMENT, alignment);
 		gl.PixelStorei(GL_UNPACK_ALIGNMENT, alignment);
 		gl.GetTexImage(GL_TEXTURE_2D, level, base_format, pixel_type, ptr);
+		self->context->stats.bytes_read += expected_size;
 
 		PyBuffer_Release(&buffer_view);
 
@@ -548,6 +679,15 @@ PyObject * MGLTexture_write(MGLTexture * self, PyObject * args) {
 	expected_size = (expected_size + alignment - 1) / alignment * alignment;
 	expected_size = expected_size * height;
 
+	if (self->data_type->block_size) {
+		if (!compressed_region(self->data_type, x, y, width, height, self->width / (1 << level), self->height / (1 << level))) {
+			MGLError_Set("the viewport must be aligned to %dx%d blocks", self->data_type->block_width, self->data_type->block_height);
+			return 0;
+		}
+
+		expected_size = (int)compressed_size(self->data_type, width, height, 1);
+	}
+
 	int texture_target = self->samples ? GL_TEXTURE_2D_MULTISAMPLE : GL_TEXTURE_2D;
 	int pixel_type = self->data_type->gl_type;
 	int format = self->data_type->base_format[self->components];
@@ -563,7 +703,11 @@ PyObject * MGLTexture_write(MGLTexture * self, PyObject * args) {
 		gl.BindTexture(texture_target, self->texture_obj);
 		gl.PixelStorei(GL_PACK_ALIGNMENT, alignment);
 		gl.PixelStorei(GL_UNPACK_ALIGNMENT, alignment);
-		gl.TexSubImage2D(texture_target, level, x, y, width, height, format, pixel_type, 0);
+		if (self->data_type->block_size) {
+			gl.CompressedTexSubImage2D(texture_target, level, x, y, width, height, self->data_type->internal_format[self->components], expected_size, 0);
+		} else {
+			gl.TexSubImage2D(texture_target, level, x, y, width, height, format, pixel_type, 0);
+		}
 		gl.BindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
 
 	} else {
@@ -588,7 +732,12 @@ PyObject * MGLTexture_write(MGLTexture * self, PyObject * args) {
 		gl.BindTexture(texture_target, self->texture_obj);
 		gl.PixelStorei(GL_PACK_ALIGNMENT, alignment);
 		gl.PixelStorei(GL_UNPACK_ALIGNMENT, alignment);
-		gl.TexSubImage2D(texture_target, level, x, y, width, height, format, pixel_type, buffer_view.buf);
+		if (self->data_type->block_size) {
+			gl.CompressedTexSubImage2D(texture_target, level, x, y, width, height, self->data_type->internal_format[self->components], expected_size, buffer_view.buf);
+		} else {
+			gl.TexSubImage2D(texture_target, level, x, y, width, height, format, pixel_type, buffer_view.buf);
+		}
+		self->context->stats.bytes_written += expected_size;
 
 		PyBuffer_Release(&buffer_view);
 
@@ -648,9 +797,7 @@ PyObject * MGLTexture_use(MGLTexture * self, PyObject * args) {
 
 	int texture_target = self->samples ? GL_TEXTURE_2D_MULTISAMPLE : GL_TEXTURE_2D;
 
-	const GLMethods & gl = self->context->gl;
-	gl.ActiveTexture(GL_TEXTURE0 + index);
-	gl.BindTexture(texture_target, self->texture_obj);
+	MGLContext_bind_texture(self->context, index, texture_target, self->texture_obj);
 
 	Py_RETURN_NONE;
 }
@@ -675,6 +822,12 @@ PyObject * MGLTexture_build_mipmaps(MGLTexture * self, PyObject * args) {
 		return 0;
 	}
 
+	// The levels of immutable textures are allocated up front.
+
+	if (self->immutable && max > self->max_level) {
+		max = self->max_level;
+	}
+
 	int texture_target = self->samples ? GL_TEXTURE_2D_MULTISAMPLE : GL_TEXTURE_2D;
 
 	const GLMethods & gl = self->context->gl;
@@ -692,7 +845,10 @@ PyObject * MGLTexture_build_mipmaps(MGLTexture * self, PyObject * args) {
 
 	self->min_filter = GL_LINEAR_MIPMAP_LINEAR;
 	self->mag_filter = GL_LINEAR;
-	self->max_level = max;
+
+	if (!self->immutable) {
+		self->max_level = max;
+	}
 
 	Py_RETURN_NONE;
 }
@@ -709,6 +865,7 @@ PyMethodDef MGLTexture_tp_methods[] = {
 	{"build_mipmaps", (PyCFunction)MGLTexture_build_mipmaps, METH_VARARGS, 0},
 	{"read", (PyCFunction)MGLTexture_read, METH_VARARGS, 0},
 	{"read_into", (PyCFunction)MGLTexture_read_into, METH_VARARGS, 0},
+	{"read_array", (PyCFunction)MGLTexture_read_array, METH_VARARGS, 0},
 	{"release", (PyCFunction)MGLTexture_release, METH_NOARGS, 0},
 	{0},
 };
@@ -990,6 +1147,7 @@ void MGLTexture_Invalidate(MGLTexture * texture) {
 
 	const GLMethods & gl = texture->context->gl;
 	gl.DeleteTextures(1, (GLuint *)&texture->texture_obj);
+	MGLContext_forget_texture(texture->context, texture->texture_obj);
 
 	Py_DECREF(texture->context);
 	Py_TYPE(texture) = &MGLInvalidObject_Type;
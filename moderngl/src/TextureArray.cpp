@@ -15,10 +15,11 @@ PyObject * MGLContext_texture_array(MGLContext * self, PyObject * args) {
 
 	const char * dtype;
 	Py_ssize_t dtype_size;
+	int levels;
 
 	int args_ok = PyArg_ParseTuple(
 		args,
-		"(III)IOIs#",
+		"(III)IOIs#i",
 		&width,
 		&height,
 		&layers,
@@ -26,7 +27,8 @@ PyObject * MGLContext_texture_array(MGLContext * self, PyObject * args) {
 		&data,
 		&alignment,
 		&dtype,
-		&dtype_size
+		&dtype_size,
+		&levels
 	);
 
 	if (!args_ok) {
@@ -43,15 +45,26 @@ PyObject * MGLContext_texture_array(MGLContext * self, PyObject * args) {
 		return 0;
 	}
 
-	if (dtype_size != 2) {
+	MGLDataType * data_type = from_dtype(dtype);
+
+	if (!data_type) {
 		MGLError_Set("invalid dtype");
 		return 0;
 	}
 
-	MGLDataType * data_type = from_dtype(dtype);
+	int max_levels = mipmap_levels(width, height, 1);
 
-	if (!data_type) {
-		MGLError_Set("invalid dtype");
+	if (levels < 0) {
+		levels = max_levels;
+	}
+
+	if (levels > max_levels) {
+		MGLError_Set("the number of levels must be at most %d", max_levels);
+		return 0;
+	}
+
+	if (levels && !self->texture_storage) {
+		MGLError_Set("immutable textures require OpenGL 4.2 or GL_ARB_texture_storage");
 		return 0;
 	}
 
@@ -59,6 +72,10 @@ PyObject * MGLContext_texture_array(MGLContext * self, PyObject * args) {
 	expected_size = (expected_size + alignment - 1) / alignment * alignment;
 	expected_size = expected_size * height * layers;
 
+	if (data_type->block_size) {
+		expected_size = (int)compressed_size(data_type, width, height, layers);
+	}
+
 	Py_buffer buffer_view;
 
 	if (data != Py_None) {
@@ -103,7 +120,22 @@ PyObject * MGLContext_texture_array(MGLContext * self, PyObject * args) {
 
     gl.PixelStorei(GL_PACK_ALIGNMENT, alignment);
     gl.PixelStorei(GL_UNPACK_ALIGNMENT, alignment);
-    gl.TexImage3D(GL_TEXTURE_2D_ARRAY, 0, internal_format, width, height, layers, 0, base_format, pixel_type, buffer_view.buf);
+	if (levels) {
+		gl.TexStorage3D(GL_TEXTURE_2D_ARRAY, levels, internal_format, width, height, layers);
+		if (data != Py_None) {
+			if (data_type->block_size) {
+				gl.CompressedTexSubImage3D(GL_TEXTURE_2D_ARRAY, 0, 0, 0, 0, width, height, layers, internal_format, expected_size, buffer_view.buf);
+			} else {
+				gl.TexSubImage3D(GL_TEXTURE_2D_ARRAY, 0, 0, 0, 0, width, height, layers, base_format, pixel_type, buffer_view.buf);
+			}
+		}
+	} else {
+		if (data_type->block_size) {
+			gl.CompressedTexImage3D(GL_TEXTURE_2D_ARRAY, 0, internal_format, width, height, layers, 0, expected_size, buffer_view.buf);
+		} else {
+			gl.TexImage3D(GL_TEXTURE_2D_ARRAY, 0, internal_format, width, height, layers, 0, base_format, pixel_type, buffer_view.buf);
+		}
+	}
 	if (data_type->float_type) {
 		gl.TexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
 		gl.TexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
@@ -124,6 +156,8 @@ PyObject * MGLContext_texture_array(MGLContext * self, PyObject * args) {
 
 	texture->min_filter = data_type->float_type ? GL_LINEAR : GL_NEAREST;
 	texture->mag_filter = data_type->float_type ? GL_LINEAR : GL_NEAREST;
+	texture->immutable = levels != 0;
+	texture->max_level = levels ? levels - 1 : 0;
 
 	texture->repeat_x = true;
 	texture->repeat_y = true;
@@ -210,6 +244,7 @@ PyObject * MGLTextureArray_read(MGLTextureArray * self, PyObject * args) {
 	// printf("level_height: %d\n", level_height);
 
 	gl.GetTexImage(GL_TEXTURE_2D_ARRAY, 0, base_format, pixel_type, data);
+	self->context->stats.bytes_read += expected_size;
 
 	return result;
 }
@@ -282,6 +317,7 @@ PyObject * MGLTextureArray_read_into(MGLTextureArray * self, PyObject * args) {
 		gl.PixelStorei(GL_PACK_ALIGNMENT, alignment);
 		gl.PixelStorei(GL_UNPACK_ALIGNMENT, alignment);
 		gl.GetTexImage(GL_TEXTURE_2D_ARRAY, 0, format, pixel_type, ptr);
+		self->context->stats.bytes_read += expected_size;
 
 		PyBuffer_Release(&buffer_view);
 
@@ -293,13 +329,15 @@ PyObject * MGLTextureArray_read_into(MGLTextureArray * self, PyObject * args) {
 PyObject * MGLTextureArray_write(MGLTextureArray * self, PyObject * args) {
 	PyObject * data;
 	PyObject * viewport;
+	int level;
 	int alignment;
 
 	int args_ok = PyArg_ParseTuple(
 		args,
-		"OOI",
+		"OOII",
 		&data,
 		&viewport,
+		&level,
 		&alignment
 	);
 
@@ -312,13 +350,21 @@ PyObject * MGLTextureArray_write(MGLTextureArray * self, PyObject * args) {
 		return 0;
 	}
 
+	if (level > self->max_level) {
+		MGLError_Set("invalid level");
+		return 0;
+	}
+
 	int x = 0;
 	int y = 0;
 	int z = 0;
-	int width = self->width;
-	int height = self->height;
+	int width = self->width / (1 << level);
+	int height = self->height / (1 << level);
 	int layers = self->layers;
 
+	width = width > 1 ? width : 1;
+	height = height > 1 ? height : 1;
+
 	Py_buffer buffer_view;
 
 	if (viewport != Py_None) {
@@ -360,6 +406,15 @@ PyObject * MGLTextureArray_write(MGLTextureArray * self, PyObject * args) {
 	expected_size = (expected_size + alignment - 1) / alignment * alignment;
 	expected_size = expected_size * height * layers;
 
+	if (self->data_type->block_size) {
+		if (!compressed_region(self->data_type, x, y, width, height, self->width / (1 << level), self->height / (1 << level))) {
+			MGLError_Set("the viewport must be aligned to %dx%d blocks", self->data_type->block_width, self->data_type->block_height);
+			return 0;
+		}
+
+		expected_size = (int)compressed_size(self->data_type, width, height, layers);
+	}
+
 	int pixel_type = self->data_type->gl_type;
 	int format = self->data_type->base_format[self->components];
 
@@ -374,7 +429,11 @@ PyObject * MGLTextureArray_write(MGLTextureArray * self, PyObject * args) {
 		gl.BindTexture(GL_TEXTURE_2D_ARRAY, self->texture_obj);
 		gl.PixelStorei(GL_PACK_ALIGNMENT, alignment);
 		gl.PixelStorei(GL_UNPACK_ALIGNMENT, alignment);
-		gl.TexSubImage3D(GL_TEXTURE_2D_ARRAY, 0, x, y, z, width, height, layers, format, pixel_type, 0);
+		if (self->data_type->block_size) {
+			gl.CompressedTexSubImage3D(GL_TEXTURE_2D_ARRAY, level, x, y, z, width, height, layers, self->data_type->internal_format[self->components], expected_size, 0);
+		} else {
+			gl.TexSubImage3D(GL_TEXTURE_2D_ARRAY, level, x, y, z, width, height, layers, format, pixel_type, 0);
+		}
 		gl.BindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
 
 	} else {
@@ -399,7 +458,12 @@ PyObject * MGLTextureArray_write(MGLTextureArray * self, PyObject * args) {
 		gl.BindTexture(GL_TEXTURE_2D_ARRAY, self->texture_obj);
 		gl.PixelStorei(GL_PACK_ALIGNMENT, alignment);
 		gl.PixelStorei(GL_UNPACK_ALIGNMENT, alignment);
-		gl.TexSubImage3D(GL_TEXTURE_2D_ARRAY, 0, x, y, z, width, height, layers, format, pixel_type, buffer_view.buf);
+		if (self->data_type->block_size) {
+			gl.CompressedTexSubImage3D(GL_TEXTURE_2D_ARRAY, level, x, y, z, width, height, layers, self->data_type->internal_format[self->components], expected_size, buffer_view.buf);
+		} else {
+			gl.TexSubImage3D(GL_TEXTURE_2D_ARRAY, level, x, y, z, width, height, layers, format, pixel_type, buffer_view.buf);
+		}
+		self->context->stats.bytes_written += expected_size;
 
 		PyBuffer_Release(&buffer_view);
 
@@ -422,9 +486,7 @@ PyObject * MGLTextureArray_use(MGLTextureArray * self, PyObject * args) {
 	}
 
 
-	const GLMethods & gl = self->context->gl;
-	gl.ActiveTexture(GL_TEXTURE0 + index);
-	gl.BindTexture(GL_TEXTURE_2D_ARRAY, self->texture_obj);
+	MGLContext_bind_texture(self->context, index, GL_TEXTURE_2D_ARRAY, self->texture_obj);
 
 	Py_RETURN_NONE;
 }
@@ -449,6 +511,12 @@ PyObject * MGLTextureArray_build_mipmaps(MGLTextureArray * self, PyObject * args
 		return 0;
 	}
 
+	// The levels of immutable textures are allocated up front.
+
+	if (self->immutable && max > self->max_level) {
+		max = self->max_level;
+	}
+
 	const GLMethods & gl = self->context->gl;
 
 	gl.ActiveTexture(GL_TEXTURE0 + self->context->default_texture_unit);
@@ -464,7 +532,9 @@ PyObject * MGLTextureArray_build_mipmaps(MGLTextureArray * self, PyObject * args
 
 	self->min_filter = GL_LINEAR_MIPMAP_LINEAR;
 	self->mag_filter = GL_LINEAR;
-	self->max_level = max;
+	if (!self->immutable) {
+		self->max_level = max;
+	}
 
 	Py_RETURN_NONE;
 }
@@ -708,6 +778,7 @@ void MGLTextureArray_Invalidate(MGLTextureArray * texture) {
 
 	const GLMethods & gl = texture->context->gl;
 	gl.DeleteTextures(1, (GLuint *)&texture->texture_obj);
+	MGLContext_forget_texture(texture->context, texture->texture_obj);
 
 	Py_DECREF(texture->context);
 	Py_TYPE(texture) = &MGLInvalidObject_Type;
@@ -14,17 +14,19 @@ PyObject * MGLContext_texture_cube(MGLContext * self, PyObject * args) {
 
 	const char * dtype;
 	Py_ssize_t dtype_size;
+	int levels;
 
 	int args_ok = PyArg_ParseTuple(
 		args,
-		"(II)IOIs#",
+		"(II)IOIs#i",
 		&width,
 		&height,
 		&components,
 		&data,
 		&alignment,
 		&dtype,
-		&dtype_size
+		&dtype_size,
+		&levels
 	);
 
 	if (!args_ok) {
@@ -41,15 +43,26 @@ PyObject * MGLContext_texture_cube(MGLContext * self, PyObject * args) {
 		return 0;
 	}
 
-	if (dtype_size != 2) {
+	MGLDataType * data_type = from_dtype(dtype);
+
+	if (!data_type) {
 		MGLError_Set("invalid dtype");
 		return 0;
 	}
 
-	MGLDataType * data_type = from_dtype(dtype);
+	int max_levels = mipmap_levels(width, height, 1);
 
-	if (!data_type) {
-		MGLError_Set("invalid dtype");
+	if (levels < 0) {
+		levels = max_levels;
+	}
+
+	if (levels > max_levels) {
+		MGLError_Set("the number of levels must be at most %d", max_levels);
+		return 0;
+	}
+
+	if (levels && !self->texture_storage) {
+		MGLError_Set("immutable textures require OpenGL 4.2 or GL_ARB_texture_storage");
 		return 0;
 	}
 
@@ -57,6 +70,10 @@ PyObject * MGLContext_texture_cube(MGLContext * self, PyObject * args) {
 	expected_size = (expected_size + alignment - 1) / alignment * alignment;
 	expected_size = expected_size * height * 6;
 
+	if (data_type->block_size) {
+		expected_size = (int)compressed_size(data_type, width, height, 6);
+	}
+
 	Py_buffer buffer_view;
 
 	if (data != Py_None) {
@@ -98,6 +115,8 @@ PyObject * MGLContext_texture_cube(MGLContext * self, PyObject * args) {
 	gl.ActiveTexture(GL_TEXTURE0 + self->default_texture_unit);
 	gl.BindTexture(GL_TEXTURE_CUBE_MAP, texture->texture_obj);
 
+	int face_size = expected_size / 6;
+
 	if (data == Py_None) {
 		expected_size = 0;
 	}
@@ -113,12 +132,26 @@ PyObject * MGLContext_texture_cube(MGLContext * self, PyObject * args) {
 
 	gl.PixelStorei(GL_PACK_ALIGNMENT, alignment);
 	gl.PixelStorei(GL_UNPACK_ALIGNMENT, alignment);
-	gl.TexImage2D(GL_TEXTURE_CUBE_MAP_POSITIVE_X, 0, internal_format, width, height, 0, base_format, pixel_type, ptr[0]);
-	gl.TexImage2D(GL_TEXTURE_CUBE_MAP_NEGATIVE_X, 0, internal_format, width, height, 0, base_format, pixel_type, ptr[1]);
-	gl.TexImage2D(GL_TEXTURE_CUBE_MAP_POSITIVE_Y, 0, internal_format, width, height, 0, base_format, pixel_type, ptr[2]);
-	gl.TexImage2D(GL_TEXTURE_CUBE_MAP_NEGATIVE_Y, 0, internal_format, width, height, 0, base_format, pixel_type, ptr[3]);
-	gl.TexImage2D(GL_TEXTURE_CUBE_MAP_POSITIVE_Z, 0, internal_format, width, height, 0, base_format, pixel_type, ptr[4]);
-	gl.TexImage2D(GL_TEXTURE_CUBE_MAP_NEGATIVE_Z, 0, internal_format, width, height, 0, base_format, pixel_type, ptr[5]);
+	if (levels) {
+		gl.TexStorage2D(GL_TEXTURE_CUBE_MAP, levels, internal_format, width, height);
+		if (data != Py_None) {
+			for (int i = 0; i < 6; ++i) {
+				if (data_type->block_size) {
+					gl.CompressedTexSubImage2D(GL_TEXTURE_CUBE_MAP_POSITIVE_X + i, 0, 0, 0, width, height, internal_format, face_size, ptr[i]);
+				} else {
+					gl.TexSubImage2D(GL_TEXTURE_CUBE_MAP_POSITIVE_X + i, 0, 0, 0, width, height, base_format, pixel_type, ptr[i]);
+				}
+			}
+		}
+	} else {
+		for (int i = 0; i < 6; ++i) {
+			if (data_type->block_size) {
+				gl.CompressedTexImage2D(GL_TEXTURE_CUBE_MAP_POSITIVE_X + i, 0, internal_format, width, height, 0, face_size, ptr[i]);
+			} else {
+				gl.TexImage2D(GL_TEXTURE_CUBE_MAP_POSITIVE_X + i, 0, internal_format, width, height, 0, base_format, pixel_type, ptr[i]);
+			}
+		}
+	}
 	if (data_type->float_type) {
 		gl.TexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
 		gl.TexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
@@ -138,7 +171,8 @@ PyObject * MGLContext_texture_cube(MGLContext * self, PyObject * args) {
 
 	texture->min_filter = data_type->float_type ? GL_LINEAR : GL_NEAREST;
 	texture->mag_filter = data_type->float_type ? GL_LINEAR : GL_NEAREST;
-	texture->max_level = 0;
+	texture->immutable = levels != 0;
+	texture->max_level = levels ? levels - 1 : 0;
 	texture->anisotropy = 1.0;
 
 	Py_INCREF(self);
@@ -208,6 +242,7 @@ PyObject * MGLTextureCube_read(MGLTextureCube * self, PyObject * args) {
 	gl.PixelStorei(GL_PACK_ALIGNMENT, alignment);
 	gl.PixelStorei(GL_UNPACK_ALIGNMENT, alignment);
 	gl.GetTexImage(GL_TEXTURE_CUBE_MAP_POSITIVE_X + face, 0, format, pixel_type, data);
+	self->context->stats.bytes_read += expected_size;
 
 	return result;
 }
@@ -286,6 +321,7 @@ PyObject * MGLTextureCube_read_into(MGLTextureCube * self, PyObject * args) {
 		gl.PixelStorei(GL_PACK_ALIGNMENT, alignment);
 		gl.PixelStorei(GL_UNPACK_ALIGNMENT, alignment);
 		gl.GetTexImage(GL_TEXTURE_CUBE_MAP_POSITIVE_X + face, 0, format, pixel_type, ptr);
+		self->context->stats.bytes_read += expected_size;
 
 		PyBuffer_Release(&buffer_view);
 
@@ -298,14 +334,16 @@ PyObject * MGLTextureCube_write(MGLTextureCube * self, PyObject * args) {
 	int face;
 	PyObject * data;
 	PyObject * viewport;
+	int level;
 	int alignment;
 
 	int args_ok = PyArg_ParseTuple(
 		args,
-		"iOOI",
+		"iOOII",
 		&face,
 		&data,
 		&viewport,
+		&level,
 		&alignment
 	);
 
@@ -323,10 +361,18 @@ PyObject * MGLTextureCube_write(MGLTextureCube * self, PyObject * args) {
 		return 0;
 	}
 
+	if (level > self->max_level) {
+		MGLError_Set("invalid level");
+		return 0;
+	}
+
 	int x = 0;
 	int y = 0;
-	int width = self->width;
-	int height = self->height;
+	int width = self->width / (1 << level);
+	int height = self->height / (1 << level);
+
+	width = width > 1 ? width : 1;
+	height = height > 1 ? height : 1;
 
 	Py_buffer buffer_view;
 
@@ -366,6 +412,15 @@ PyObject * MGLTextureCube_write(MGLTextureCube * self, PyObject * args) {
 	expected_size = (expected_size + alignment - 1) / alignment * alignment;
 	expected_size = expected_size * height;
 
+	if (self->data_type->block_size) {
+		if (!compressed_region(self->data_type, x, y, width, height, self->width / (1 << level), self->height / (1 << level))) {
+			MGLError_Set("the viewport must be aligned to %dx%d blocks", self->data_type->block_width, self->data_type->block_height);
+			return 0;
+		}
+
+		expected_size = (int)compressed_size(self->data_type, width, height, 1);
+	}
+
 	// GL_TEXTURE_CUBE_MAP_POSITIVE_X = GL_TEXTURE_CUBE_MAP_POSITIVE_X + 0
 	// GL_TEXTURE_CUBE_MAP_NEGATIVE_X = GL_TEXTURE_CUBE_MAP_POSITIVE_X + 1
 	// GL_TEXTURE_CUBE_MAP_POSITIVE_Y = GL_TEXTURE_CUBE_MAP_POSITIVE_X + 2
@@ -387,7 +442,11 @@ PyObject * MGLTextureCube_write(MGLTextureCube * self, PyObject * args) {
 		gl.BindTexture(GL_TEXTURE_CUBE_MAP, self->texture_obj);
 		gl.PixelStorei(GL_PACK_ALIGNMENT, alignment);
 		gl.PixelStorei(GL_UNPACK_ALIGNMENT, alignment);
-		gl.TexSubImage2D(GL_TEXTURE_CUBE_MAP_POSITIVE_X + face, 0, x, y, width, height, format, pixel_type, 0);
+		if (self->data_type->block_size) {
+			gl.CompressedTexSubImage2D(GL_TEXTURE_CUBE_MAP_POSITIVE_X + face, level, x, y, width, height, self->data_type->internal_format[self->components], expected_size, 0);
+		} else {
+			gl.TexSubImage2D(GL_TEXTURE_CUBE_MAP_POSITIVE_X + face, level, x, y, width, height, format, pixel_type, 0);
+		}
 		gl.BindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
 
 	} else {
@@ -411,7 +470,12 @@ PyObject * MGLTextureCube_write(MGLTextureCube * self, PyObject * args) {
 
 		gl.PixelStorei(GL_PACK_ALIGNMENT, alignment);
 		gl.PixelStorei(GL_UNPACK_ALIGNMENT, alignment);
-		gl.TexSubImage2D(GL_TEXTURE_CUBE_MAP_POSITIVE_X + face, 0, x, y, width, height, format, pixel_type, buffer_view.buf);
+		if (self->data_type->block_size) {
+			gl.CompressedTexSubImage2D(GL_TEXTURE_CUBE_MAP_POSITIVE_X + face, level, x, y, width, height, self->data_type->internal_format[self->components], expected_size, buffer_view.buf);
+		} else {
+			gl.TexSubImage2D(GL_TEXTURE_CUBE_MAP_POSITIVE_X + face, level, x, y, width, height, format, pixel_type, buffer_view.buf);
+		}
+		self->context->stats.bytes_written += expected_size;
 
 		PyBuffer_Release(&buffer_view);
 	}
@@ -432,9 +496,7 @@ PyObject * MGLTextureCube_use(MGLTextureCube * self, PyObject * args) {
 		return 0;
 	}
 
-	const GLMethods & gl = self->context->gl;
-	gl.ActiveTexture(GL_TEXTURE0 + index);
-	gl.BindTexture(GL_TEXTURE_CUBE_MAP, self->texture_obj);
+	MGLContext_bind_texture(self->context, index, GL_TEXTURE_CUBE_MAP, self->texture_obj);
 
 	Py_RETURN_NONE;
 }
@@ -625,6 +687,7 @@ void MGLTextureCube_Invalidate(MGLTextureCube * texture) {
 
 	const GLMethods & gl = texture->context->gl;
 	gl.DeleteTextures(1, (GLuint *)&texture->texture_obj);
+	MGLContext_forget_texture(texture->context, texture->texture_obj);
 
 	Py_TYPE(texture) = &MGLInvalidObject_Type;
 	Py_DECREF(texture);
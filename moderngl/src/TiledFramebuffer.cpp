@@ -0,0 +1,355 @@
+#include "Types.hpp"
+
+PyObject * MGLContext_tiled_framebuffer(MGLContext * self, PyObject * args) {
+	MGLFramebuffer * framebuffer;
+	int width;
+	int height;
+	int components;
+
+	const char * dtype;
+	Py_ssize_t dtype_size;
+
+	int args_ok = PyArg_ParseTuple(
+		args,
+		"O!IIIs#",
+		&MGLFramebuffer_Type,
+		&framebuffer,
+		&width,
+		&height,
+		&components,
+		&dtype,
+		&dtype_size
+	);
+
+	if (!args_ok) {
+		return 0;
+	}
+
+	if (components < 1 || components > 4) {
+		MGLError_Set("the components must be 1, 2, 3 or 4");
+		return 0;
+	}
+
+	if (width < 1 || height < 1) {
+		MGLError_Set("invalid size = (%d, %d)", width, height);
+		return 0;
+	}
+
+	if (dtype_size != 2) {
+		MGLError_Set("invalid dtype");
+		return 0;
+	}
+
+	MGLDataType * data_type = from_dtype(dtype);
+
+	if (!data_type) {
+		MGLError_Set("invalid dtype");
+		return 0;
+	}
+
+	MGLTiledFramebuffer * tiled = (MGLTiledFramebuffer *)MGLTiledFramebuffer_Type.tp_alloc(&MGLTiledFramebuffer_Type, 0);
+
+	const GLMethods & gl = self->gl;
+
+	Py_ssize_t tile_size = (Py_ssize_t)framebuffer->width * framebuffer->height * components * data_type->size;
+
+	tiled->buffer_obj[0] = 0;
+	tiled->buffer_obj[1] = 0;
+	gl.GenBuffers(2, (GLuint *)tiled->buffer_obj);
+
+	if (!tiled->buffer_obj[0] || !tiled->buffer_obj[1]) {
+		MGLError_Set("cannot create buffer");
+		Py_DECREF(tiled);
+		return 0;
+	}
+
+	for (int i = 0; i < 2; ++i) {
+		gl.BindBuffer(GL_PIXEL_PACK_BUFFER, tiled->buffer_obj[i]);
+		gl.BufferData(GL_PIXEL_PACK_BUFFER, tile_size, 0, GL_STREAM_READ);
+		tiled->fences[i] = 0;
+		tiled->pending[i][2] = 0;
+	}
+
+	gl.BindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+
+	tiled->data_type = data_type;
+	tiled->width = width;
+	tiled->height = height;
+	tiled->components = components;
+	tiled->current = 0;
+	tiled->output.buf = 0;
+	tiled->flip = false;
+
+	Py_INCREF(framebuffer);
+	tiled->framebuffer = framebuffer;
+
+	Py_INCREF(self);
+	tiled->context = self;
+
+	Py_INCREF(tiled);
+
+	return (PyObject *)tiled;
+}
+
+PyObject * MGLTiledFramebuffer_tp_new(PyTypeObject * type, PyObject * args, PyObject * kwargs) {
+	MGLTiledFramebuffer * self = (MGLTiledFramebuffer *)type->tp_alloc(type, 0);
+
+	if (self) {
+	}
+
+	return (PyObject *)self;
+}
+
+void MGLTiledFramebuffer_tp_dealloc(MGLTiledFramebuffer * self) {
+	MGLTiledFramebuffer_Type.tp_free((PyObject *)self);
+}
+
+// Reads the tile rendered last into the current pixel pack buffer without waiting for it.
+
+void MGLTiledFramebuffer_read_tile(MGLTiledFramebuffer * self, int x, int y, int width, int height) {
+	const GLMethods & gl = self->context->gl;
+
+	int index = self->current;
+	int pixel_type = self->data_type->gl_type;
+	int base_format = self->data_type->base_format[self->components];
+
+	gl.BindBuffer(GL_PIXEL_PACK_BUFFER, self->buffer_obj[index]);
+	gl.BindFramebuffer(GL_FRAMEBUFFER, self->framebuffer->framebuffer_obj);
+	gl.ReadBuffer(GL_COLOR_ATTACHMENT0);
+	gl.PixelStorei(GL_PACK_ALIGNMENT, 1);
+	gl.ReadPixels(0, 0, width, height, base_format, pixel_type, 0);
+	self->context->stats.bytes_read += (long long)width * height * self->components * self->data_type->size;
+	gl.BindFramebuffer(GL_FRAMEBUFFER, self->context->bound_framebuffer->framebuffer_obj);
+	gl.BindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+
+	self->fences[index] = gl.FenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+	gl.Flush();
+
+	self->pending[index][0] = x;
+	self->pending[index][1] = y;
+	self->pending[index][2] = width;
+	self->pending[index][3] = height;
+}
+
+// Waits for a pending tile and copies its rows to the output. The copy runs without the GIL.
+
+bool MGLTiledFramebuffer_copy_tile(MGLTiledFramebuffer * self, int index) {
+	int * tile = self->pending[index];
+
+	if (!tile[2]) {
+		return true;
+	}
+
+	int width = tile[2];
+	int height = tile[3];
+
+	tile[2] = 0;
+
+	const GLMethods & gl = self->context->gl;
+
+	GLenum status = gl.ClientWaitSync(self->fences[index], GL_SYNC_FLUSH_COMMANDS_BIT, 1000000000);
+	while (status == GL_TIMEOUT_EXPIRED) {
+		status = gl.ClientWaitSync(self->fences[index], 0, 1000000000);
+	}
+
+	gl.DeleteSync(self->fences[index]);
+	self->fences[index] = 0;
+
+	if (status == GL_WAIT_FAILED) {
+		MGLError_Set("cannot wait for the tile");
+		return false;
+	}
+
+	Py_ssize_t pixel_size = self->components * self->data_type->size;
+	Py_ssize_t tile_stride = width * pixel_size;
+	Py_ssize_t output_stride = self->width * pixel_size;
+
+	gl.BindBuffer(GL_PIXEL_PACK_BUFFER, self->buffer_obj[index]);
+	const char * map = (const char *)gl.MapBufferRange(GL_PIXEL_PACK_BUFFER, 0, tile_stride * height, GL_MAP_READ_BIT);
+
+	if (!map) {
+		gl.BindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+		MGLError_Set("cannot map buffer");
+		return false;
+	}
+
+	char * output = (char *)self->output.buf + tile[0] * pixel_size;
+
+	Py_BEGIN_ALLOW_THREADS
+	for (int row = 0; row < height; ++row) {
+		Py_ssize_t y = self->flip ? self->height - tile[1] - row - 1 : tile[1] + row;
+		memcpy(output + y * output_stride, map + row * tile_stride, tile_stride);
+	}
+	Py_END_ALLOW_THREADS
+
+	gl.UnmapBuffer(GL_PIXEL_PACK_BUFFER);
+	gl.BindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+	return true;
+}
+
+void MGLTiledFramebuffer_discard(MGLTiledFramebuffer * self) {
+	const GLMethods & gl = self->context->gl;
+
+	for (int i = 0; i < 2; ++i) {
+		if (self->fences[i]) {
+			gl.DeleteSync(self->fences[i]);
+			self->fences[i] = 0;
+		}
+		self->pending[i][2] = 0;
+	}
+
+	if (self->output.buf) {
+		PyBuffer_Release(&self->output);
+		self->output.buf = 0;
+	}
+}
+
+// The callback renders a single tile, the tiles are visited row by row from the bottom.
+// The readback of a tile is copied out after the next tile was rendered and its readback was issued.
+
+PyObject * MGLTiledFramebuffer_render(MGLTiledFramebuffer * self, PyObject * args) {
+	PyObject * callback;
+	PyObject * output;
+	int flip;
+
+	int args_ok = PyArg_ParseTuple(
+		args,
+		"OOp",
+		&callback,
+		&output,
+		&flip
+	);
+
+	if (!args_ok) {
+		return 0;
+	}
+
+	if (self->output.buf) {
+		MGLError_Set("the tiled framebuffer is already rendering");
+		return 0;
+	}
+
+	int get_buffer = PyObject_GetBuffer(output, &self->output, PyBUF_WRITABLE | PyBUF_C_CONTIGUOUS);
+	if (get_buffer < 0) {
+		// Propagate the default error
+		self->output.buf = 0;
+		return 0;
+	}
+
+	Py_ssize_t expected_size = (Py_ssize_t)self->width * self->height * self->components * self->data_type->size;
+
+	if (self->output.len != expected_size) {
+		MGLError_Set("the output size %d does not match the image size %d", self->output.len, expected_size);
+		PyBuffer_Release(&self->output);
+		self->output.buf = 0;
+		return 0;
+	}
+
+	self->flip = flip ? true : false;
+	self->current = 0;
+
+	int tile_width = self->framebuffer->width;
+	int tile_height = self->framebuffer->height;
+
+	for (int y = 0; y < self->height; y += tile_height) {
+		for (int x = 0; x < self->width; x += tile_width) {
+			int width = self->width - x < tile_width ? self->width - x : tile_width;
+			int height = self->height - y < tile_height ? self->height - y : tile_height;
+
+			PyObject * result = PyObject_CallFunction(callback, "((iiii))", x, y, width, height);
+
+			if (!result) {
+				MGLTiledFramebuffer_discard(self);
+				return 0;
+			}
+
+			Py_DECREF(result);
+
+			MGLTiledFramebuffer_read_tile(self, x, y, width, height);
+			self->current ^= 1;
+
+			if (!MGLTiledFramebuffer_copy_tile(self, self->current)) {
+				MGLTiledFramebuffer_discard(self);
+				return 0;
+			}
+		}
+	}
+
+	bool copied = MGLTiledFramebuffer_copy_tile(self, self->current ^ 1);
+	MGLTiledFramebuffer_discard(self);
+
+	if (!copied) {
+		return 0;
+	}
+
+	Py_RETURN_NONE;
+}
+
+PyObject * MGLTiledFramebuffer_release(MGLTiledFramebuffer * self) {
+	MGLTiledFramebuffer_Invalidate(self);
+	Py_RETURN_NONE;
+}
+
+PyMethodDef MGLTiledFramebuffer_tp_methods[] = {
+	{"render", (PyCFunction)MGLTiledFramebuffer_render, METH_VARARGS, 0},
+	{"release", (PyCFunction)MGLTiledFramebuffer_release, METH_NOARGS, 0},
+	{0},
+};
+
+PyTypeObject MGLTiledFramebuffer_Type = {
+	PyVarObject_HEAD_INIT(0, 0)
+	"mgl.TiledFramebuffer",                                 // tp_name
+	sizeof(MGLTiledFramebuffer),                            // tp_basicsize
+	0,                                                      // tp_itemsize
+	(destructor)MGLTiledFramebuffer_tp_dealloc,             // tp_dealloc
+	0,                                                      // tp_print
+	0,                                                      // tp_getattr
+	0,                                                      // tp_setattr
+	0,                                                      // tp_reserved
+	0,                                                      // tp_repr
+	0,                                                      // tp_as_number
+	0,                                                      // tp_as_sequence
+	0,                                                      // tp_as_mapping
+	0,                                                      // tp_hash
+	0,                                                      // tp_call
+	0,                                                      // tp_str
+	0,                                                      // tp_getattro
+	0,                                                      // tp_setattro
+	0,                                                      // tp_as_buffer
+	Py_TPFLAGS_DEFAULT,                                     // tp_flags
+	0,                                                      // tp_doc
+	0,                                                      // tp_traverse
+	0,                                                      // tp_clear
+	0,                                                      // tp_richcompare
+	0,                                                      // tp_weaklistoffset
+	0,                                                      // tp_iter
+	0,                                                      // tp_iternext
+	MGLTiledFramebuffer_tp_methods,                         // tp_methods
+	0,                                                      // tp_members
+	0,                                                      // tp_getset
+	0,                                                      // tp_base
+	0,                                                      // tp_dict
+	0,                                                      // tp_descr_get
+	0,                                                      // tp_descr_set
+	0,                                                      // tp_dictoffset
+	0,                                                      // tp_init
+	0,                                                      // tp_alloc
+	MGLTiledFramebuffer_tp_new,                             // tp_new
+};
+
+void MGLTiledFramebuffer_Invalidate(MGLTiledFramebuffer * tiled) {
+	if (Py_TYPE(tiled) == &MGLInvalidObject_Type) {
+		return;
+	}
+
+	MGLTiledFramebuffer_discard(tiled);
+
+	const GLMethods & gl = tiled->context->gl;
+	gl.DeleteBuffers(2, (GLuint *)tiled->buffer_obj);
+
+	Py_DECREF(tiled->framebuffer);
+	Py_DECREF(tiled->context);
+
+	Py_TYPE(tiled) = &MGLInvalidObject_Type;
+	Py_DECREF(tiled);
+}
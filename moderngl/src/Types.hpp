@@ -49,6 +49,39 @@ struct MGLUniform;
 struct MGLUniformBlock;
 struct MGLVertexArray;
 struct MGLSampler;
+struct MGLQueryPool;
+struct MGLTiledFramebuffer;
+struct MGLUploadQueue;
+struct MGLUploadWorker;
+struct MGLBufferView;
+struct MGLPixels;
+struct MGLCommandList;
+struct MGLReadback;
+struct MGLStreamBuffer;
+
+struct MGLBufferBinding {
+	int buffer_obj;
+	Py_ssize_t offset;
+	Py_ssize_t size;
+};
+
+// Counters of the work issued by a context, see MGLContext_get_stats.
+// The binds are counted after the state cache, only the binds reaching OpenGL are counted.
+
+struct MGLStats {
+	long long draw_calls;
+	long long vertices;
+	long long instances;
+	long long dispatches;
+	long long program_binds;
+	long long vertex_array_binds;
+	long long framebuffer_binds;
+	long long texture_binds;
+	long long uniform_uploads;
+	long long uniform_uploads_skipped;
+	long long bytes_written;
+	long long bytes_read;
+};
 
 struct MGLDataType {
 	int * base_format;
@@ -56,6 +89,11 @@ struct MGLDataType {
 	int gl_type;
 	int size;
 	bool float_type;
+
+	// Compressed formats, the size is the decompressed size of a component.
+	int block_width;
+	int block_height;
+	int block_size;
 };
 
 struct MGLAttribute {
@@ -90,6 +128,90 @@ struct MGLBuffer {
 
 	Py_ssize_t size;
 	bool dynamic;
+
+	bool persistent;
+	char * mapping;
+
+	// The memoryviews of the persistent mapping, the buffer cannot be released while they exist.
+	int exports;
+
+	// The active mapping shared by overlapping views, see MGLBuffer_map.
+	char * map_ptr;
+	Py_ssize_t map_offset;
+	Py_ssize_t map_size;
+	int map_access;
+	int map_count;
+};
+
+struct MGLBufferView {
+	PyObject_HEAD
+
+	MGLBuffer * buffer;
+
+	Py_ssize_t offset;
+	Py_ssize_t size;
+	int access;
+
+	const char * format;
+	Py_ssize_t itemsize;
+
+	int ndim;
+	Py_ssize_t * shape;
+	Py_ssize_t * strides;
+};
+
+struct MGLPixels {
+	PyObject_HEAD
+
+	char * data;
+	Py_ssize_t size;
+
+	const char * format;
+	Py_ssize_t itemsize;
+
+	Py_ssize_t shape[3];
+	Py_ssize_t strides[3];
+};
+
+enum MGLCommandType {
+	MGL_COMMAND_SCOPE_BEGIN,
+	MGL_COMMAND_SCOPE_END,
+	MGL_COMMAND_FRAMEBUFFER,
+	MGL_COMMAND_TEXTURE,
+	MGL_COMMAND_SAMPLER,
+	MGL_COMMAND_BUFFER,
+	MGL_COMMAND_UNIFORM,
+	MGL_COMMAND_ENABLE,
+	MGL_COMMAND_RENDER,
+	MGL_COMMAND_RENDER_INDIRECT,
+};
+
+struct MGLCommand {
+	int type;
+
+	// The referenced objects are kept alive by the command list.
+	PyObject * object;
+	MGLBuffer * indirect_buffer;
+
+	int params[4];
+
+	// Buffer range for buffer bindings or the location of the uniform data in the blob.
+	Py_ssize_t offset;
+	Py_ssize_t size;
+};
+
+struct MGLCommandList {
+	PyObject_HEAD
+
+	MGLContext * context;
+
+	MGLCommand * commands;
+	int num_commands;
+	int commands_capacity;
+
+	char * blob;
+	Py_ssize_t blob_size;
+	Py_ssize_t blob_capacity;
 };
 
 struct MGLComputeShader {
@@ -133,9 +255,38 @@ struct MGLContext {
 
 	bool wireframe;
 	bool multisample;
+	bool parallel_shader_compile;
+	bool clear_buffer_object;
+	bool texture_storage;
+	bool native_loader;
 
 	int provoking_vertex;
 
+	// Shadow of the OpenGL state used to skip redundant calls.
+	// A value of -1 means unknown, see MGLContext_reset_state_cache.
+	bool state_cache;
+	int bound_program;
+	int bound_vertex_array;
+	int applied_enable_flags;
+	MGLFramebuffer * used_framebuffer;
+	int * bound_textures;
+	int * bound_samplers;
+	int max_uniform_buffer_bindings;
+	int max_storage_buffer_bindings;
+	MGLBufferBinding * uniform_buffer_bindings;
+	MGLBufferBinding * storage_buffer_bindings;
+
+	// Uniform values are shadowed to skip redundant uploads, see MGLUniform_write.
+	bool uniform_shadowing;
+	int uniform_epoch;
+
+	MGLStats stats;
+
+	// Reusable memory for converting uniform values, see MGLContext_scratch.
+	char * scratch;
+	Py_ssize_t scratch_size;
+	bool scratch_busy;
+
 	GLMethods gl;
 };
 
@@ -193,6 +344,11 @@ struct MGLProgram {
 
 	int geometry_vertices;
 	int num_varyings;
+
+	// Submitted with program_submit and not yet checked.
+	int shader_objs[5];
+	bool pending;
+	bool retrievable;
 };
 
 enum MGLQueryKeys {
@@ -210,6 +366,34 @@ struct MGLQuery {
 	int query_obj[4];
 };
 
+struct MGLQueryPool {
+	PyObject_HEAD
+
+	MGLContext * context;
+
+	// The target of the last use of every query, zero for the queries in the free list.
+	int * query_obj;
+	int * targets;
+	int * free_list;
+
+	int size;
+	int free;
+};
+
+struct MGLReadback {
+	PyObject_HEAD
+
+	MGLContext * context;
+
+	int buffer_obj;
+	GLsync fence;
+	char * mapping;
+	int exports;
+
+	Py_ssize_t capacity;
+	Py_ssize_t size;
+};
+
 struct MGLRenderbuffer {
 	PyObject_HEAD
 
@@ -229,6 +413,14 @@ struct MGLRenderbuffer {
 	bool depth;
 };
 
+// The target is a texture target, GL_UNIFORM_BUFFER, GL_SHADER_STORAGE_BUFFER or GL_SAMPLER_BINDING.
+
+struct MGLScopeBinding {
+	int target;
+	int unit;
+	int name;
+};
+
 struct MGLScope {
 	PyObject_HEAD
 
@@ -236,17 +428,67 @@ struct MGLScope {
 	MGLFramebuffer * framebuffer;
 	MGLFramebuffer * old_framebuffer;
 
-	int * textures;
-	int * buffers;
-	PyObject * samplers;
-
-	int num_textures;
-	int num_buffers;
+	MGLScopeBinding * bindings;
+	int num_bindings;
 
 	int enable_flags;
 	int old_enable_flags;
 };
 
+struct MGLStreamBuffer {
+	PyObject_HEAD
+
+	MGLContext * context;
+	MGLBuffer * buffer;
+
+	GLsync * fences;
+
+	int regions;
+	int region;
+
+	Py_ssize_t region_size;
+	Py_ssize_t cursor;
+};
+
+struct MGLTiledFramebuffer {
+	PyObject_HEAD
+
+	MGLContext * context;
+	MGLFramebuffer * framebuffer;
+	MGLDataType * data_type;
+
+	int width;
+	int height;
+	int components;
+
+	// Two pixel pack buffers, a tile is copied out while the next one is rendered.
+	int buffer_obj[2];
+	GLsync fences[2];
+	int pending[2][4];
+	int current;
+
+	Py_buffer output;
+	bool flip;
+};
+
+struct MGLUploadQueue {
+	PyObject_HEAD
+
+	MGLContext * context;
+	MGLBuffer * buffer;
+
+	// The staging copies and the pending uploads, see UploadQueue.cpp
+	MGLUploadWorker * worker;
+
+	GLsync * fences;
+
+	int slots;
+	int slot;
+
+	Py_ssize_t slot_size;
+	Py_ssize_t cursor;
+};
+
 struct MGLTexture {
 	PyObject_HEAD
 
@@ -267,6 +509,7 @@ struct MGLTexture {
 	int min_filter;
 	int mag_filter;
 	int max_level;
+	bool immutable;
 
 	int compare_func;
 	float anisotropy;
@@ -294,6 +537,7 @@ struct MGLTexture3D {
 	int min_filter;
 	int mag_filter;
 	int max_level;
+	bool immutable;
 
 	bool repeat_x;
 	bool repeat_y;
@@ -319,6 +563,7 @@ struct MGLTextureArray {
 	int min_filter;
 	int mag_filter;
 	int max_level;
+	bool immutable;
 
 	bool repeat_x;
 	bool repeat_y;
@@ -342,12 +587,15 @@ struct MGLTextureCube {
 	int min_filter;
 	int mag_filter;
 	int max_level;
+	bool immutable;
 	float anisotropy;
 };
 
 struct MGLUniform {
 	PyObject_HEAD
 
+	MGLContext * context;
+
 	MGLProc value_getter;
 	MGLProc value_setter;
 	MGLProc gl_value_reader_proc;
@@ -364,6 +612,10 @@ struct MGLUniform {
 	int array_length;
 
 	bool matrix;
+	char format;
+
+	char * shadow;
+	int shadow_epoch;
 };
 
 struct MGLUniformBlock {
@@ -387,6 +639,9 @@ struct MGLVertexArray {
 	int index_element_size;
 	int index_element_type;
 
+	// The vertex buffers, a draw is refused while one of them is mapped.
+	PyObject * buffers;
+
 	unsigned * subroutines;
 	int num_subroutines;
 
@@ -418,6 +673,8 @@ struct MGLSampler {
 };
 
 MGLDataType * from_dtype(const char * dtype);
+Py_ssize_t compressed_size(MGLDataType * data_type, int width, int height, int depth);
+bool compressed_region(MGLDataType * data_type, int x, int y, int width, int height, int level_width, int level_height);
 
 void MGLAttribute_Invalidate(MGLAttribute * attribute);
 void MGLBuffer_Invalidate(MGLBuffer * buffer);
@@ -434,6 +691,12 @@ void MGLUniform_Invalidate(MGLUniform * uniform);
 void MGLVertexArray_Invalidate(MGLVertexArray * vertex_array);
 void MGLSampler_Invalidate(MGLSampler * sampler);
 void MGLScope_Invalidate(MGLScope * scope);
+void MGLQueryPool_Invalidate(MGLQueryPool * pool);
+void MGLTiledFramebuffer_Invalidate(MGLTiledFramebuffer * tiled);
+void MGLUploadQueue_Invalidate(MGLUploadQueue * queue);
+void MGLCommandList_Invalidate(MGLCommandList * command_list);
+void MGLReadback_Invalidate(MGLReadback * readback);
+void MGLStreamBuffer_Invalidate(MGLStreamBuffer * stream);
 
 void MGLAttribute_Complete(MGLAttribute * attribute, const GLMethods & gl);
 void MGLUniform_Complete(MGLUniform * self, const GLMethods & gl);
@@ -442,6 +705,33 @@ void MGLVertexArray_Complete(MGLVertexArray * vertex_array);
 
 void MGLContext_Initialize(MGLContext * self);
 
+void MGLContext_reset_state_cache(MGLContext * self);
+void MGLContext_use_program(MGLContext * self, int program_obj);
+void MGLContext_bind_vertex_array(MGLContext * self, int vertex_array_obj);
+void MGLContext_bind_texture(MGLContext * self, int unit, int target, int texture_obj);
+void MGLContext_bind_sampler(MGLContext * self, int unit, int sampler_obj);
+void MGLContext_bind_buffer_range(MGLContext * self, int target, int binding, int buffer_obj, Py_ssize_t offset, Py_ssize_t size);
+void MGLContext_set_enable_flags(MGLContext * self, int flags);
+void MGLContext_forget_program(MGLContext * self, int program_obj);
+void MGLContext_forget_vertex_array(MGLContext * self, int vertex_array_obj);
+void MGLContext_forget_texture(MGLContext * self, int texture_obj);
+void MGLContext_forget_sampler(MGLContext * self, int sampler_obj);
+void MGLContext_forget_buffer(MGLContext * self, int buffer_obj);
+void * MGLContext_scratch(MGLContext * self, Py_ssize_t size);
+void MGLContext_release_scratch(MGLContext * self, void * scratch);
+
+char * MGLBuffer_map(MGLBuffer * self, Py_ssize_t offset, Py_ssize_t size, int access);
+void MGLBuffer_unmap(MGLBuffer * self);
+void MGLBuffer_count_export(MGLContext * context, Py_ssize_t size, int flags);
+bool MGLBuffer_check_unmapped(MGLBuffer * self);
+
+MGLPixels * MGLPixels_New(MGLDataType * data_type, int width, int height, int channels);
+void MGLPixels_copy(char * dst, const char * src, int width, int height, int src_pixel, int dst_pixel, bool flip);
+
+void MGLVertexArray_draw(MGLVertexArray * self, int mode, int vertices, int first, int instances);
+void MGLVertexArray_draw_indirect(MGLVertexArray * self, int buffer_obj, int mode, int count, int first);
+bool MGLVertexArray_check_unmapped(MGLVertexArray * self);
+
 extern PyTypeObject MGLAttribute_Type;
 extern PyTypeObject MGLBuffer_Type;
 extern PyTypeObject MGLComputeShader_Type;
@@ -460,3 +750,11 @@ extern PyTypeObject MGLUniformBlock_Type;
 extern PyTypeObject MGLUniform_Type;
 extern PyTypeObject MGLVertexArray_Type;
 extern PyTypeObject MGLSampler_Type;
+extern PyTypeObject MGLQueryPool_Type;
+extern PyTypeObject MGLTiledFramebuffer_Type;
+extern PyTypeObject MGLUploadQueue_Type;
+extern PyTypeObject MGLBufferView_Type;
+extern PyTypeObject MGLPixels_Type;
+extern PyTypeObject MGLCommandList_Type;
+extern PyTypeObject MGLReadback_Type;
+extern PyTypeObject MGLStreamBuffer_Type;
@@ -12,14 +12,92 @@ PyObject * MGLUniform_tp_new(PyTypeObject * type, PyObject * args, PyObject * kw
 }
 
 void MGLUniform_tp_dealloc(MGLUniform * self) {
+	PyMem_Free(self->shadow);
 	MGLUniform_Type.tp_free((PyObject *)self);
 }
 
+// The last written value is kept to skip uploading the same bytes again.
+// The shadow is valid while its epoch matches the context, see MGLContext_reset_state_cache.
+
+void MGLUniform_write(MGLUniform * self, const void * data) {
+	MGLContext * context = self->context;
+
+	if (context->uniform_shadowing) {
+		int size = self->array_length * self->element_size;
+
+		if (self->shadow_epoch == context->uniform_epoch && !memcmp(self->shadow, data, size)) {
+			context->stats.uniform_uploads_skipped += 1;
+			return;
+		}
+
+		memcpy(self->shadow, data, size);
+		self->shadow_epoch = context->uniform_epoch;
+	}
+
+	context->stats.uniform_uploads += 1;
+
+	if (self->matrix) {
+		((gl_uniform_matrix_writer_proc)self->gl_value_writer_proc)(self->program_obj, self->location, self->array_length, false, data);
+	} else {
+		((gl_uniform_vector_writer_proc)self->gl_value_writer_proc)(self->program_obj, self->location, self->array_length, data);
+	}
+}
+
 PyObject * MGLUniform_get_value(MGLUniform * self, void * closure) {
 	return ((MGLUniform_Getter)self->value_getter)(self);
 }
 
+// Contiguous buffers of the matching scalar type are passed to OpenGL without conversion.
+// Returns 1 when the value was written and 0 when the value must be converted by the value setter.
+
+int MGLUniform_write_buffer(MGLUniform * self, PyObject * value) {
+	Py_buffer buffer_view;
+
+	if (PyObject_GetBuffer(value, &buffer_view, PyBUF_RECORDS_RO) < 0) {
+		PyErr_Clear();
+		return 0;
+	}
+
+	const char * item_format = buffer_view.format ? buffer_view.format : "B";
+	char format = item_format[strlen(item_format) - 1];
+
+	if (item_format[0] == '>' || item_format[0] == '!') {
+		format = 0;
+	}
+	Py_ssize_t itemsize = self->format == 'd' ? 8 : 4;
+	bool compatible = false;
+
+	switch (self->format) {
+		case 'f':
+			compatible = format == 'f';
+			break;
+
+		case 'd':
+			compatible = format == 'd';
+			break;
+
+		case 'i':
+		case 'I':
+			compatible = format == 'i' || format == 'I' || format == 'l' || format == 'L';
+			break;
+	}
+
+	bool written = false;
+
+	if (compatible && buffer_view.itemsize == itemsize && PyBuffer_IsContiguous(&buffer_view, 'C') && buffer_view.len == self->array_length * self->element_size) {
+		MGLUniform_write(self, buffer_view.buf);
+		written = true;
+	}
+
+	PyBuffer_Release(&buffer_view);
+	return written;
+}
+
 int MGLUniform_set_value(MGLUniform * self, PyObject * value, void * closure) {
+	if (self->format && PyObject_CheckBuffer(value) && MGLUniform_write_buffer(self, value)) {
+		return 0;
+	}
+
 	return ((MGLUniform_Setter)self->value_setter)(self, value);
 }
 
@@ -45,11 +123,7 @@ int MGLUniform_set_data(MGLUniform * self, PyObject * value, void * closure) {
 		return -1;
 	}
 
-	if (self->matrix) {
-		((gl_uniform_matrix_writer_proc)self->gl_value_writer_proc)(self->program_obj, self->location, self->array_length, false, buffer_view.buf);
-	} else {
-		((gl_uniform_vector_writer_proc)self->gl_value_writer_proc)(self->program_obj, self->location, self->array_length, buffer_view.buf);
-	}
+	MGLUniform_write(self, buffer_view.buf);
 
 	PyBuffer_Release(&buffer_view);
 	return 0;
@@ -120,6 +194,7 @@ void MGLUniform_Complete(MGLUniform * self, const GLMethods & gl) {
 			self->dimension = 1;
 			self->element_size = 4;
 			self->gl_value_reader_proc = (MGLProc)gl.GetUniformiv;
+			self->format = 'i';
 			self->gl_value_writer_proc = (MGLProc)gl.ProgramUniform1iv;
 			if (self->array_length > 1) {
 				self->value_getter = (MGLProc)MGLUniform_bool_array_value_getter;
@@ -135,6 +210,7 @@ void MGLUniform_Complete(MGLUniform * self, const GLMethods & gl) {
 			self->dimension = 2;
 			self->element_size = 8;
 			self->gl_value_reader_proc = (MGLProc)gl.GetUniformiv;
+			self->format = 'i';
 			self->gl_value_writer_proc = (MGLProc)gl.ProgramUniform2iv;
 			if (self->array_length > 1) {
 				self->value_getter = (MGLProc)MGLUniform_bvec_array_value_getter<2>;
@@ -150,6 +226,7 @@ void MGLUniform_Complete(MGLUniform * self, const GLMethods & gl) {
 			self->dimension = 3;
 			self->element_size = 12;
 			self->gl_value_reader_proc = (MGLProc)gl.GetUniformiv;
+			self->format = 'i';
 			self->gl_value_writer_proc = (MGLProc)gl.ProgramUniform3iv;
 			if (self->array_length > 1) {
 				self->value_getter = (MGLProc)MGLUniform_bvec_array_value_getter<3>;
@@ -165,6 +242,7 @@ void MGLUniform_Complete(MGLUniform * self, const GLMethods & gl) {
 			self->dimension = 4;
 			self->element_size = 16;
 			self->gl_value_reader_proc = (MGLProc)gl.GetUniformiv;
+			self->format = 'i';
 			self->gl_value_writer_proc = (MGLProc)gl.ProgramUniform4iv;
 			if (self->array_length > 1) {
 				self->value_getter = (MGLProc)MGLUniform_bvec_array_value_getter<4>;
@@ -180,6 +258,7 @@ void MGLUniform_Complete(MGLUniform * self, const GLMethods & gl) {
 			self->dimension = 1;
 			self->element_size = 4;
 			self->gl_value_reader_proc = (MGLProc)gl.GetUniformiv;
+			self->format = 'i';
 			self->gl_value_writer_proc = (MGLProc)gl.ProgramUniform1iv;
 			if (self->array_length > 1) {
 				self->value_getter = (MGLProc)MGLUniform_int_array_value_getter;
@@ -195,6 +274,7 @@ void MGLUniform_Complete(MGLUniform * self, const GLMethods & gl) {
 			self->dimension = 2;
 			self->element_size = 8;
 			self->gl_value_reader_proc = (MGLProc)gl.GetUniformiv;
+			self->format = 'i';
 			self->gl_value_writer_proc = (MGLProc)gl.ProgramUniform2iv;
 			if (self->array_length > 1) {
 				self->value_getter = (MGLProc)MGLUniform_ivec_array_value_getter<2>;
@@ -210,6 +290,7 @@ void MGLUniform_Complete(MGLUniform * self, const GLMethods & gl) {
 			self->dimension = 3;
 			self->element_size = 12;
 			self->gl_value_reader_proc = (MGLProc)gl.GetUniformiv;
+			self->format = 'i';
 			self->gl_value_writer_proc = (MGLProc)gl.ProgramUniform3iv;
 			if (self->array_length > 1) {
 				self->value_getter = (MGLProc)MGLUniform_ivec_array_value_getter<3>;
@@ -225,6 +306,7 @@ void MGLUniform_Complete(MGLUniform * self, const GLMethods & gl) {
 			self->dimension = 4;
 			self->element_size = 16;
 			self->gl_value_reader_proc = (MGLProc)gl.GetUniformiv;
+			self->format = 'i';
 			self->gl_value_writer_proc = (MGLProc)gl.ProgramUniform4iv;
 			if (self->array_length > 1) {
 				self->value_getter = (MGLProc)MGLUniform_ivec_array_value_getter<4>;
@@ -240,6 +322,7 @@ void MGLUniform_Complete(MGLUniform * self, const GLMethods & gl) {
 			self->dimension = 1;
 			self->element_size = 4;
 			self->gl_value_reader_proc = (MGLProc)gl.GetUniformuiv;
+			self->format = 'I';
 			self->gl_value_writer_proc = (MGLProc)gl.ProgramUniform1uiv;
 			if (self->array_length > 1) {
 				self->value_getter = (MGLProc)MGLUniform_uint_array_value_getter;
@@ -255,6 +338,7 @@ void MGLUniform_Complete(MGLUniform * self, const GLMethods & gl) {
 			self->dimension = 2;
 			self->element_size = 8;
 			self->gl_value_reader_proc = (MGLProc)gl.GetUniformuiv;
+			self->format = 'I';
 			self->gl_value_writer_proc = (MGLProc)gl.ProgramUniform2uiv;
 			if (self->array_length > 1) {
 				self->value_getter = (MGLProc)MGLUniform_uvec_array_value_getter<2>;
@@ -270,6 +354,7 @@ void MGLUniform_Complete(MGLUniform * self, const GLMethods & gl) {
 			self->dimension = 3;
 			self->element_size = 12;
 			self->gl_value_reader_proc = (MGLProc)gl.GetUniformuiv;
+			self->format = 'I';
 			self->gl_value_writer_proc = (MGLProc)gl.ProgramUniform3uiv;
 			if (self->array_length > 1) {
 				self->value_getter = (MGLProc)MGLUniform_uvec_array_value_getter<3>;
@@ -285,6 +370,7 @@ void MGLUniform_Complete(MGLUniform * self, const GLMethods & gl) {
 			self->dimension = 4;
 			self->element_size = 16;
 			self->gl_value_reader_proc = (MGLProc)gl.GetUniformuiv;
+			self->format = 'I';
 			self->gl_value_writer_proc = (MGLProc)gl.ProgramUniform4uiv;
 			if (self->array_length > 1) {
 				self->value_getter = (MGLProc)MGLUniform_uvec_array_value_getter<4>;
@@ -300,6 +386,7 @@ void MGLUniform_Complete(MGLUniform * self, const GLMethods & gl) {
 			self->dimension = 1;
 			self->element_size = 4;
 			self->gl_value_reader_proc = (MGLProc)gl.GetUniformfv;
+			self->format = 'f';
 			self->gl_value_writer_proc = (MGLProc)gl.ProgramUniform1fv;
 			if (self->array_length > 1) {
 				self->value_getter = (MGLProc)MGLUniform_float_array_value_getter;
@@ -315,6 +402,7 @@ void MGLUniform_Complete(MGLUniform * self, const GLMethods & gl) {
 			self->dimension = 2;
 			self->element_size = 8;
 			self->gl_value_reader_proc = (MGLProc)gl.GetUniformfv;
+			self->format = 'f';
 			self->gl_value_writer_proc = (MGLProc)gl.ProgramUniform2fv;
 			if (self->array_length > 1) {
 				self->value_getter = (MGLProc)MGLUniform_vec_array_value_getter<2>;
@@ -330,6 +418,7 @@ void MGLUniform_Complete(MGLUniform * self, const GLMethods & gl) {
 			self->dimension = 3;
 			self->element_size = 12;
 			self->gl_value_reader_proc = (MGLProc)gl.GetUniformfv;
+			self->format = 'f';
 			self->gl_value_writer_proc = (MGLProc)gl.ProgramUniform3fv;
 			if (self->array_length > 1) {
 				self->value_getter = (MGLProc)MGLUniform_vec_array_value_getter<3>;
@@ -345,6 +434,7 @@ void MGLUniform_Complete(MGLUniform * self, const GLMethods & gl) {
 			self->dimension = 4;
 			self->element_size = 16;
 			self->gl_value_reader_proc = (MGLProc)gl.GetUniformfv;
+			self->format = 'f';
 			self->gl_value_writer_proc = (MGLProc)gl.ProgramUniform4fv;
 			if (self->array_length > 1) {
 				self->value_getter = (MGLProc)MGLUniform_vec_array_value_getter<4>;
@@ -360,6 +450,7 @@ void MGLUniform_Complete(MGLUniform * self, const GLMethods & gl) {
 			self->dimension = 1;
 			self->element_size = 8;
 			self->gl_value_reader_proc = (MGLProc)gl.GetUniformdv;
+			self->format = 'd';
 			self->gl_value_writer_proc = (MGLProc)gl.ProgramUniform1dv;
 			if (self->array_length > 1) {
 				self->value_getter = (MGLProc)MGLUniform_double_array_value_getter;
@@ -375,6 +466,7 @@ void MGLUniform_Complete(MGLUniform * self, const GLMethods & gl) {
 			self->dimension = 2;
 			self->element_size = 16;
 			self->gl_value_reader_proc = (MGLProc)gl.GetUniformdv;
+			self->format = 'd';
 			self->gl_value_writer_proc = (MGLProc)gl.ProgramUniform2dv;
 			if (self->array_length > 1) {
 				self->value_getter = (MGLProc)MGLUniform_dvec_array_value_getter<2>;
@@ -390,6 +482,7 @@ void MGLUniform_Complete(MGLUniform * self, const GLMethods & gl) {
 			self->dimension = 3;
 			self->element_size = 24;
 			self->gl_value_reader_proc = (MGLProc)gl.GetUniformdv;
+			self->format = 'd';
 			self->gl_value_writer_proc = (MGLProc)gl.ProgramUniform3dv;
 			if (self->array_length > 1) {
 				self->value_getter = (MGLProc)MGLUniform_dvec_array_value_getter<3>;
@@ -405,6 +498,7 @@ void MGLUniform_Complete(MGLUniform * self, const GLMethods & gl) {
 			self->dimension = 4;
 			self->element_size = 32;
 			self->gl_value_reader_proc = (MGLProc)gl.GetUniformdv;
+			self->format = 'd';
 			self->gl_value_writer_proc = (MGLProc)gl.ProgramUniform4dv;
 			if (self->array_length > 1) {
 				self->value_getter = (MGLProc)MGLUniform_dvec_array_value_getter<4>;
@@ -423,6 +517,7 @@ void MGLUniform_Complete(MGLUniform * self, const GLMethods & gl) {
 			self->dimension = 1;
 			self->element_size = 4;
 			self->gl_value_reader_proc = (MGLProc)gl.GetUniformiv;
+			self->format = 'i';
 			self->gl_value_writer_proc = (MGLProc)gl.ProgramUniform1iv;
 			if (self->array_length > 1) {
 				self->value_getter = (MGLProc)MGLUniform_sampler_array_value_getter;
@@ -440,6 +535,7 @@ void MGLUniform_Complete(MGLUniform * self, const GLMethods & gl) {
 			self->dimension = 1;
 			self->element_size = 4;
 			self->gl_value_reader_proc = (MGLProc)gl.GetUniformiv;
+			self->format = 'i';
 			self->gl_value_writer_proc = (MGLProc)gl.ProgramUniform1iv;
 			if (self->array_length > 1) {
 				self->value_getter = (MGLProc)MGLUniform_sampler_array_value_getter;
@@ -457,6 +553,7 @@ void MGLUniform_Complete(MGLUniform * self, const GLMethods & gl) {
 			self->dimension = 1;
 			self->element_size = 4;
 			self->gl_value_reader_proc = (MGLProc)gl.GetUniformiv;
+			self->format = 'i';
 			self->gl_value_writer_proc = (MGLProc)gl.ProgramUniform1iv;
 			if (self->array_length > 1) {
 				self->value_getter = (MGLProc)MGLUniform_sampler_array_value_getter;
@@ -474,6 +571,7 @@ void MGLUniform_Complete(MGLUniform * self, const GLMethods & gl) {
 			self->dimension = 1;
 			self->element_size = 4;
 			self->gl_value_reader_proc = (MGLProc)gl.GetUniformiv;
+			self->format = 'i';
 			self->gl_value_writer_proc = (MGLProc)gl.ProgramUniform1iv;
 			if (self->array_length > 1) {
 				self->value_getter = (MGLProc)MGLUniform_sampler_array_value_getter;
@@ -489,6 +587,7 @@ void MGLUniform_Complete(MGLUniform * self, const GLMethods & gl) {
 			self->dimension = 1;
 			self->element_size = 4;
 			self->gl_value_reader_proc = (MGLProc)gl.GetUniformiv;
+			self->format = 'i';
 			self->gl_value_writer_proc = (MGLProc)gl.ProgramUniform1iv;
 			if (self->array_length > 1) {
 				self->value_getter = (MGLProc)MGLUniform_sampler_array_value_getter;
@@ -506,6 +605,7 @@ void MGLUniform_Complete(MGLUniform * self, const GLMethods & gl) {
 			self->dimension = 1;
 			self->element_size = 4;
 			self->gl_value_reader_proc = (MGLProc)gl.GetUniformiv;
+			self->format = 'i';
 			self->gl_value_writer_proc = (MGLProc)gl.ProgramUniform1iv;
 			if (self->array_length > 1) {
 				self->value_getter = (MGLProc)MGLUniform_sampler_array_value_getter;
@@ -523,6 +623,7 @@ void MGLUniform_Complete(MGLUniform * self, const GLMethods & gl) {
 			self->dimension = 1;
 			self->element_size = 4;
 			self->gl_value_reader_proc = (MGLProc)gl.GetUniformiv;
+			self->format = 'i';
 			self->gl_value_writer_proc = (MGLProc)gl.ProgramUniform1iv;
 			if (self->array_length > 1) {
 				self->value_getter = (MGLProc)MGLUniform_sampler_array_value_getter;
@@ -540,6 +641,7 @@ void MGLUniform_Complete(MGLUniform * self, const GLMethods & gl) {
 			self->dimension = 1;
 			self->element_size = 4;
 			self->gl_value_reader_proc = (MGLProc)gl.GetUniformiv;
+			self->format = 'i';
 			self->gl_value_writer_proc = (MGLProc)gl.ProgramUniform1iv;
 			if (self->array_length > 1) {
 				self->value_getter = (MGLProc)MGLUniform_sampler_array_value_getter;
@@ -555,6 +657,7 @@ void MGLUniform_Complete(MGLUniform * self, const GLMethods & gl) {
 			self->dimension = 1;
 			self->element_size = 4;
 			self->gl_value_reader_proc = (MGLProc)gl.GetUniformiv;
+			self->format = 'i';
 			self->gl_value_writer_proc = (MGLProc)gl.ProgramUniform1iv;
 			if (self->array_length > 1) {
 				self->value_getter = (MGLProc)MGLUniform_sampler_array_value_getter;
@@ -570,6 +673,7 @@ void MGLUniform_Complete(MGLUniform * self, const GLMethods & gl) {
 			self->dimension = 4;
 			self->element_size = 16;
 			self->gl_value_reader_proc = (MGLProc)gl.GetUniformfv;
+			self->format = 'f';
 			self->gl_value_writer_proc = (MGLProc)gl.ProgramUniformMatrix2fv;
 			if (self->array_length > 1) {
 				self->value_getter = (MGLProc)MGLUniform_matrix_array_value_getter<float, 2, 2>;
@@ -585,6 +689,7 @@ void MGLUniform_Complete(MGLUniform * self, const GLMethods & gl) {
 			self->dimension = 6;
 			self->element_size = 24;
 			self->gl_value_reader_proc = (MGLProc)gl.GetUniformfv;
+			self->format = 'f';
 			self->gl_value_writer_proc = (MGLProc)gl.ProgramUniformMatrix2x3fv;
 			if (self->array_length > 1) {
 				self->value_getter = (MGLProc)MGLUniform_matrix_array_value_getter<float, 2, 3>;
@@ -600,6 +705,7 @@ void MGLUniform_Complete(MGLUniform * self, const GLMethods & gl) {
 			self->dimension = 8;
 			self->element_size = 32;
 			self->gl_value_reader_proc = (MGLProc)gl.GetUniformfv;
+			self->format = 'f';
 			self->gl_value_writer_proc = (MGLProc)gl.ProgramUniformMatrix2x4fv;
 			if (self->array_length > 1) {
 				self->value_getter = (MGLProc)MGLUniform_matrix_array_value_getter<float, 2, 4>;
@@ -615,6 +721,7 @@ void MGLUniform_Complete(MGLUniform * self, const GLMethods & gl) {
 			self->dimension = 6;
 			self->element_size = 24;
 			self->gl_value_reader_proc = (MGLProc)gl.GetUniformfv;
+			self->format = 'f';
 			self->gl_value_writer_proc = (MGLProc)gl.ProgramUniformMatrix3x2fv;
 			if (self->array_length > 1) {
 				self->value_getter = (MGLProc)MGLUniform_matrix_array_value_getter<float, 3, 2>;
@@ -630,6 +737,7 @@ void MGLUniform_Complete(MGLUniform * self, const GLMethods & gl) {
 			self->dimension = 9;
 			self->element_size = 36;
 			self->gl_value_reader_proc = (MGLProc)gl.GetUniformfv;
+			self->format = 'f';
 			self->gl_value_writer_proc = (MGLProc)gl.ProgramUniformMatrix3fv;
 			if (self->array_length > 1) {
 				self->value_getter = (MGLProc)MGLUniform_matrix_array_value_getter<float, 3, 3>;
@@ -645,6 +753,7 @@ void MGLUniform_Complete(MGLUniform * self, const GLMethods & gl) {
 			self->dimension = 12;
 			self->element_size = 48;
 			self->gl_value_reader_proc = (MGLProc)gl.GetUniformfv;
+			self->format = 'f';
 			self->gl_value_writer_proc = (MGLProc)gl.ProgramUniformMatrix3x4fv;
 			if (self->array_length > 1) {
 				self->value_getter = (MGLProc)MGLUniform_matrix_array_value_getter<float, 3, 4>;
@@ -660,6 +769,7 @@ void MGLUniform_Complete(MGLUniform * self, const GLMethods & gl) {
 			self->dimension = 8;
 			self->element_size = 32;
 			self->gl_value_reader_proc = (MGLProc)gl.GetUniformfv;
+			self->format = 'f';
 			self->gl_value_writer_proc = (MGLProc)gl.ProgramUniformMatrix4x2fv;
 			if (self->array_length > 1) {
 				self->value_getter = (MGLProc)MGLUniform_matrix_array_value_getter<float, 4, 2>;
@@ -675,6 +785,7 @@ void MGLUniform_Complete(MGLUniform * self, const GLMethods & gl) {
 			self->dimension = 12;
 			self->element_size = 48;
 			self->gl_value_reader_proc = (MGLProc)gl.GetUniformfv;
+			self->format = 'f';
 			self->gl_value_writer_proc = (MGLProc)gl.ProgramUniformMatrix4x3fv;
 			if (self->array_length > 1) {
 				self->value_getter = (MGLProc)MGLUniform_matrix_array_value_getter<float, 4, 3>;
@@ -690,6 +801,7 @@ void MGLUniform_Complete(MGLUniform * self, const GLMethods & gl) {
 			self->dimension = 16;
 			self->element_size = 64;
 			self->gl_value_reader_proc = (MGLProc)gl.GetUniformfv;
+			self->format = 'f';
 			self->gl_value_writer_proc = (MGLProc)gl.ProgramUniformMatrix4fv;
 			if (self->array_length > 1) {
 				self->value_getter = (MGLProc)MGLUniform_matrix_array_value_getter<float, 4, 4>;
@@ -705,6 +817,7 @@ void MGLUniform_Complete(MGLUniform * self, const GLMethods & gl) {
 			self->dimension = 4;
 			self->element_size = 32;
 			self->gl_value_reader_proc = (MGLProc)gl.GetUniformdv;
+			self->format = 'd';
 			self->gl_value_writer_proc = (MGLProc)gl.ProgramUniformMatrix2dv;
 			if (self->array_length > 1) {
 				self->value_getter = (MGLProc)MGLUniform_matrix_array_value_getter<double, 2, 2>;
@@ -720,6 +833,7 @@ void MGLUniform_Complete(MGLUniform * self, const GLMethods & gl) {
 			self->dimension = 6;
 			self->element_size = 48;
 			self->gl_value_reader_proc = (MGLProc)gl.GetUniformdv;
+			self->format = 'd';
 			self->gl_value_writer_proc = (MGLProc)gl.ProgramUniformMatrix2x3dv;
 			if (self->array_length > 1) {
 				self->value_getter = (MGLProc)MGLUniform_matrix_array_value_getter<double, 2, 3>;
@@ -735,6 +849,7 @@ void MGLUniform_Complete(MGLUniform * self, const GLMethods & gl) {
 			self->dimension = 8;
 			self->element_size = 64;
 			self->gl_value_reader_proc = (MGLProc)gl.GetUniformdv;
+			self->format = 'd';
 			self->gl_value_writer_proc = (MGLProc)gl.ProgramUniformMatrix2x4dv;
 			if (self->array_length > 1) {
 				self->value_getter = (MGLProc)MGLUniform_matrix_array_value_getter<double, 2, 4>;
@@ -750,6 +865,7 @@ void MGLUniform_Complete(MGLUniform * self, const GLMethods & gl) {
 			self->dimension = 6;
 			self->element_size = 48;
 			self->gl_value_reader_proc = (MGLProc)gl.GetUniformdv;
+			self->format = 'd';
 			self->gl_value_writer_proc = (MGLProc)gl.ProgramUniformMatrix3x2dv;
 			if (self->array_length > 1) {
 				self->value_getter = (MGLProc)MGLUniform_matrix_array_value_getter<double, 3, 2>;
@@ -765,6 +881,7 @@ void MGLUniform_Complete(MGLUniform * self, const GLMethods & gl) {
 			self->dimension = 9;
 			self->element_size = 72;
 			self->gl_value_reader_proc = (MGLProc)gl.GetUniformdv;
+			self->format = 'd';
 			self->gl_value_writer_proc = (MGLProc)gl.ProgramUniformMatrix3dv;
 			if (self->array_length > 1) {
 				self->value_getter = (MGLProc)MGLUniform_matrix_array_value_getter<double, 3, 3>;
@@ -780,6 +897,7 @@ void MGLUniform_Complete(MGLUniform * self, const GLMethods & gl) {
 			self->dimension = 12;
 			self->element_size = 96;
 			self->gl_value_reader_proc = (MGLProc)gl.GetUniformdv;
+			self->format = 'd';
 			self->gl_value_writer_proc = (MGLProc)gl.ProgramUniformMatrix3x4dv;
 			if (self->array_length > 1) {
 				self->value_getter = (MGLProc)MGLUniform_matrix_array_value_getter<double, 3, 4>;
@@ -795,6 +913,7 @@ void MGLUniform_Complete(MGLUniform * self, const GLMethods & gl) {
 			self->dimension = 8;
 			self->element_size = 64;
 			self->gl_value_reader_proc = (MGLProc)gl.GetUniformdv;
+			self->format = 'd';
 			self->gl_value_writer_proc = (MGLProc)gl.ProgramUniformMatrix4x2dv;
 			if (self->array_length > 1) {
 				self->value_getter = (MGLProc)MGLUniform_matrix_array_value_getter<double, 4, 2>;
@@ -810,6 +929,7 @@ void MGLUniform_Complete(MGLUniform * self, const GLMethods & gl) {
 			self->dimension = 12;
 			self->element_size = 96;
 			self->gl_value_reader_proc = (MGLProc)gl.GetUniformdv;
+			self->format = 'd';
 			self->gl_value_writer_proc = (MGLProc)gl.ProgramUniformMatrix4x3dv;
 			if (self->array_length > 1) {
 				self->value_getter = (MGLProc)MGLUniform_matrix_array_value_getter<double, 4, 3>;
@@ -825,6 +945,7 @@ void MGLUniform_Complete(MGLUniform * self, const GLMethods & gl) {
 			self->dimension = 16;
 			self->element_size = 128;
 			self->gl_value_reader_proc = (MGLProc)gl.GetUniformdv;
+			self->format = 'd';
 			self->gl_value_writer_proc = (MGLProc)gl.ProgramUniformMatrix4dv;
 			if (self->array_length > 1) {
 				self->value_getter = (MGLProc)MGLUniform_matrix_array_value_getter<double, 4, 4>;
@@ -840,9 +961,13 @@ void MGLUniform_Complete(MGLUniform * self, const GLMethods & gl) {
 			self->dimension = 1;
 			self->element_size = 4;
 			self->gl_value_reader_proc = (MGLProc)gl.GetUniformfv;
+			self->format = 0;
 			self->gl_value_writer_proc = (MGLProc)gl.ProgramUniform1fv;
 			self->value_getter = (MGLProc)MGLUniform_invalid_getter;
 			self->value_setter = (MGLProc)MGLUniform_invalid_setter;
 			break;
 	}
+
+	self->shadow = (char *)PyMem_Malloc(self->array_length * self->element_size);
+	self->shadow_epoch = -1;
 }
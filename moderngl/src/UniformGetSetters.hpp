@@ -10,6 +10,8 @@ typedef void (GLAPI * gl_uniform_matrix_writer_proc)(GLuint program, GLint locat
 typedef PyObject * (* MGLUniform_Getter)(MGLUniform * self);
 typedef int (* MGLUniform_Setter)(MGLUniform * self, PyObject * value);
 
+void MGLUniform_write(MGLUniform * self, const void * data);
+
 PyObject * MGLUniform_invalid_getter(MGLUniform * self);
 
 PyObject * MGLUniform_bool_value_getter(MGLUniform * self);
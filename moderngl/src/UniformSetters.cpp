@@ -19,7 +19,7 @@ int MGLUniform_bool_value_setter(MGLUniform * self, PyObject * value) {
 		return -1;
 	}
 
-	((gl_uniform_vector_writer_proc)self->gl_value_writer_proc)(self->program_obj, self->location, 1, &c_value);
+	MGLUniform_write(self, &c_value);
 
 	return 0;
 }
@@ -32,7 +32,7 @@ int MGLUniform_int_value_setter(MGLUniform * self, PyObject * value) {
 		return -1;
 	}
 
-	((gl_uniform_vector_writer_proc)self->gl_value_writer_proc)(self->program_obj, self->location, 1, &c_value);
+	MGLUniform_write(self, &c_value);
 
 	return 0;
 }
@@ -45,7 +45,7 @@ int MGLUniform_uint_value_setter(MGLUniform * self, PyObject * value) {
 		return -1;
 	}
 
-	((gl_uniform_vector_writer_proc)self->gl_value_writer_proc)(self->program_obj, self->location, 1, &c_value);
+	MGLUniform_write(self, &c_value);
 
 	return 0;
 }
@@ -58,7 +58,7 @@ int MGLUniform_float_value_setter(MGLUniform * self, PyObject * value) {
 		return -1;
 	}
 
-	((gl_uniform_vector_writer_proc)self->gl_value_writer_proc)(self->program_obj, self->location, 1, &c_value);
+	MGLUniform_write(self, &c_value);
 
 	return 0;
 }
@@ -71,7 +71,7 @@ int MGLUniform_double_value_setter(MGLUniform * self, PyObject * value) {
 		return -1;
 	}
 
-	((gl_uniform_vector_writer_proc)self->gl_value_writer_proc)(self->program_obj, self->location, 1, &c_value);
+	MGLUniform_write(self, &c_value);
 
 	return 0;
 }
@@ -84,29 +84,33 @@ int MGLUniform_sampler_value_setter(MGLUniform * self, PyObject * value) {
 		return -1;
 	}
 
-	((gl_uniform_vector_writer_proc)self->gl_value_writer_proc)(self->program_obj, self->location, 1, &c_value);
+	MGLUniform_write(self, &c_value);
 
 	return 0;
 }
 
 int MGLUniform_bool_array_value_setter(MGLUniform * self, PyObject * value) {
 
-	if (Py_TYPE(value) != &PyList_Type) {
-		MGLError_Set("the value must be a list not %s", Py_TYPE(value)->tp_name);
+	if (Py_TYPE(value) != &PyList_Type && Py_TYPE(value) != &PyTuple_Type) {
+		MGLError_Set("the value must be a list or a tuple not %s", Py_TYPE(value)->tp_name);
 		return -1;
 	}
 
-	int size = (int)PyList_GET_SIZE(value);
+	int size = (int)PySequence_Fast_GET_SIZE(value);
 
 	if (size != self->array_length) {
 		MGLError_Set("the value must be a list of size %d not %d", self->array_length, size);
 		return -1;
 	}
 
-	int * c_values = new int[size];
+	int * c_values = (int *)MGLContext_scratch(self->context, sizeof(int) * size);
+
+	if (!c_values) {
+		return -1;
+	}
 
 	for (int k = 0; k < size; ++k) {
-		PyObject * v = PyList_GET_ITEM(value, k);
+		PyObject * v = PySequence_Fast_GET_ITEM(value, k);
 
 		if (v == Py_True) {
 			c_values[k] = 1;
@@ -114,174 +118,194 @@ int MGLUniform_bool_array_value_setter(MGLUniform * self, PyObject * value) {
 			c_values[k] = 0;
 		} else {
 			MGLError_Set("value[%d] must be a bool not %s", k, Py_TYPE(value)->tp_name);
-			delete[] c_values;
+			MGLContext_release_scratch(self->context, c_values);
 			return -1;
 		}
 	}
 
-	((gl_uniform_vector_writer_proc)self->gl_value_writer_proc)(self->program_obj, self->location, size, c_values);
+	MGLUniform_write(self, c_values);
 
-	delete[] c_values;
+	MGLContext_release_scratch(self->context, c_values);
 	return 0;
 }
 
 int MGLUniform_int_array_value_setter(MGLUniform * self, PyObject * value) {
 
-	if (Py_TYPE(value) != &PyList_Type) {
-		MGLError_Set("the value must be a list not %s", Py_TYPE(value)->tp_name);
+	if (Py_TYPE(value) != &PyList_Type && Py_TYPE(value) != &PyTuple_Type) {
+		MGLError_Set("the value must be a list or a tuple not %s", Py_TYPE(value)->tp_name);
 		return -1;
 	}
 
-	int size = (int)PyList_GET_SIZE(value);
+	int size = (int)PySequence_Fast_GET_SIZE(value);
 
 	if (size != self->array_length) {
 		MGLError_Set("the value must be a list of size %d not %d", self->array_length, size);
 		return -1;
 	}
 
-	int * c_values = new int[size];
+	int * c_values = (int *)MGLContext_scratch(self->context, sizeof(int) * size);
+
+	if (!c_values) {
+		return -1;
+	}
 
 	for (int k = 0; k < size; ++k) {
-		c_values[k] = PyLong_AsLong(PyList_GET_ITEM(value, k));
+		c_values[k] = PyLong_AsLong(PySequence_Fast_GET_ITEM(value, k));
 	}
 
 	if (PyErr_Occurred()) {
 		MGLError_Set("cannot convert value to int");
-		delete[] c_values;
+		MGLContext_release_scratch(self->context, c_values);
 		return -1;
 	}
 
-	((gl_uniform_vector_writer_proc)self->gl_value_writer_proc)(self->program_obj, self->location, size, c_values);
+	MGLUniform_write(self, c_values);
 
-	delete[] c_values;
+	MGLContext_release_scratch(self->context, c_values);
 	return 0;
 }
 
 int MGLUniform_uint_array_value_setter(MGLUniform * self, PyObject * value) {
 
-	if (Py_TYPE(value) != &PyList_Type) {
-		MGLError_Set("the value must be a list not %s", Py_TYPE(value)->tp_name);
+	if (Py_TYPE(value) != &PyList_Type && Py_TYPE(value) != &PyTuple_Type) {
+		MGLError_Set("the value must be a list or a tuple not %s", Py_TYPE(value)->tp_name);
 		return -1;
 	}
 
-	int size = (int)PyList_GET_SIZE(value);
+	int size = (int)PySequence_Fast_GET_SIZE(value);
 
 	if (size != self->array_length) {
 		MGLError_Set("the value must be a list of size %d not %d", self->array_length, size);
 		return -1;
 	}
 
-	unsigned * c_values = new unsigned[size];
+	unsigned * c_values = (unsigned *)MGLContext_scratch(self->context, sizeof(unsigned) * size);
+
+	if (!c_values) {
+		return -1;
+	}
 
 	for (int k = 0; k < size; ++k) {
-		c_values[k] = PyLong_AsUnsignedLong(PyList_GET_ITEM(value, k));
+		c_values[k] = PyLong_AsUnsignedLong(PySequence_Fast_GET_ITEM(value, k));
 	}
 
 	if (PyErr_Occurred()) {
 		MGLError_Set("cannot convert value to unsigned int");
-		delete[] c_values;
+		MGLContext_release_scratch(self->context, c_values);
 		return -1;
 	}
 
-	((gl_uniform_vector_writer_proc)self->gl_value_writer_proc)(self->program_obj, self->location, size, c_values);
+	MGLUniform_write(self, c_values);
 
-	delete[] c_values;
+	MGLContext_release_scratch(self->context, c_values);
 	return 0;
 }
 
 int MGLUniform_float_array_value_setter(MGLUniform * self, PyObject * value) {
 
-	if (Py_TYPE(value) != &PyList_Type) {
-		MGLError_Set("the value must be a list not %s", Py_TYPE(value)->tp_name);
+	if (Py_TYPE(value) != &PyList_Type && Py_TYPE(value) != &PyTuple_Type) {
+		MGLError_Set("the value must be a list or a tuple not %s", Py_TYPE(value)->tp_name);
 		return -1;
 	}
 
-	int size = (int)PyList_GET_SIZE(value);
+	int size = (int)PySequence_Fast_GET_SIZE(value);
 
 	if (size != self->array_length) {
 		MGLError_Set("the value must be a list of size %d not %d", self->array_length, size);
 		return -1;
 	}
 
-	float * c_values = new float[size];
+	float * c_values = (float *)MGLContext_scratch(self->context, sizeof(float) * size);
+
+	if (!c_values) {
+		return -1;
+	}
 
 	for (int k = 0; k < size; ++k) {
-		c_values[k] = (float)PyFloat_AsDouble(PyList_GET_ITEM(value, k));
+		c_values[k] = (float)PyFloat_AsDouble(PySequence_Fast_GET_ITEM(value, k));
 	}
 
 	if (PyErr_Occurred()) {
 		MGLError_Set("cannot convert value to float");
-		delete[] c_values;
+		MGLContext_release_scratch(self->context, c_values);
 		return -1;
 	}
 
-	((gl_uniform_vector_writer_proc)self->gl_value_writer_proc)(self->program_obj, self->location, size, c_values);
+	MGLUniform_write(self, c_values);
 
-	delete[] c_values;
+	MGLContext_release_scratch(self->context, c_values);
 	return 0;
 }
 
 int MGLUniform_double_array_value_setter(MGLUniform * self, PyObject * value) {
 
-	if (Py_TYPE(value) != &PyList_Type) {
-		MGLError_Set("the value must be a list not %s", Py_TYPE(value)->tp_name);
+	if (Py_TYPE(value) != &PyList_Type && Py_TYPE(value) != &PyTuple_Type) {
+		MGLError_Set("the value must be a list or a tuple not %s", Py_TYPE(value)->tp_name);
 		return -1;
 	}
 
-	int size = (int)PyList_GET_SIZE(value);
+	int size = (int)PySequence_Fast_GET_SIZE(value);
 
 	if (size != self->array_length) {
 		MGLError_Set("the value must be a list of size %d not %d", self->array_length, size);
 		return -1;
 	}
 
-	double * c_values = new double[size];
+	double * c_values = (double *)MGLContext_scratch(self->context, sizeof(double) * size);
+
+	if (!c_values) {
+		return -1;
+	}
 
 	for (int k = 0; k < size; ++k) {
-		c_values[k] = PyFloat_AsDouble(PyList_GET_ITEM(value, k));
+		c_values[k] = PyFloat_AsDouble(PySequence_Fast_GET_ITEM(value, k));
 	}
 
 	if (PyErr_Occurred()) {
 		MGLError_Set("cannot convert value to double");
-		delete[] c_values;
+		MGLContext_release_scratch(self->context, c_values);
 		return -1;
 	}
 
-	((gl_uniform_vector_writer_proc)self->gl_value_writer_proc)(self->program_obj, self->location, size, c_values);
+	MGLUniform_write(self, c_values);
 
-	delete[] c_values;
+	MGLContext_release_scratch(self->context, c_values);
 	return 0;
 }
 
 int MGLUniform_sampler_array_value_setter(MGLUniform * self, PyObject * value) {
 
-	if (Py_TYPE(value) != &PyList_Type) {
-		MGLError_Set("the value must be a list not %s", Py_TYPE(value)->tp_name);
+	if (Py_TYPE(value) != &PyList_Type && Py_TYPE(value) != &PyTuple_Type) {
+		MGLError_Set("the value must be a list or a tuple not %s", Py_TYPE(value)->tp_name);
 		return -1;
 	}
 
-	int size = (int)PyList_GET_SIZE(value);
+	int size = (int)PySequence_Fast_GET_SIZE(value);
 
 	if (size != self->array_length) {
 		MGLError_Set("the value must be a list of size %d not %d", self->array_length, size);
 		return -1;
 	}
 
-	int * c_values = new int[size];
+	int * c_values = (int *)MGLContext_scratch(self->context, sizeof(int) * size);
+
+	if (!c_values) {
+		return -1;
+	}
 
 	for (int k = 0; k < size; ++k) {
-		c_values[k] = PyLong_AsLong(PyList_GET_ITEM(value, k));
+		c_values[k] = PyLong_AsLong(PySequence_Fast_GET_ITEM(value, k));
 	}
 
 	if (PyErr_Occurred()) {
 		MGLError_Set("cannot convert value to int");
-		delete[] c_values;
+		MGLContext_release_scratch(self->context, c_values);
 		return -1;
 	}
 
-	((gl_uniform_vector_writer_proc)self->gl_value_writer_proc)(self->program_obj, self->location, size, c_values);
+	MGLUniform_write(self, c_values);
 
-	delete[] c_values;
+	MGLContext_release_scratch(self->context, c_values);
 	return 0;
 }
 
@@ -314,7 +338,7 @@ int MGLUniform_bvec_value_setter(MGLUniform * self, PyObject * value) {
 		}
 	}
 
-	((gl_uniform_vector_writer_proc)self->gl_value_writer_proc)(self->program_obj, self->location, 1, c_values);
+	MGLUniform_write(self, c_values);
 
 	return 0;
 }
@@ -344,7 +368,7 @@ int MGLUniform_ivec_value_setter(MGLUniform * self, PyObject * value) {
 		return -1;
 	}
 
-	((gl_uniform_vector_writer_proc)self->gl_value_writer_proc)(self->program_obj, self->location, 1, c_values);
+	MGLUniform_write(self, c_values);
 
 	return 0;
 }
@@ -374,7 +398,7 @@ int MGLUniform_uvec_value_setter(MGLUniform * self, PyObject * value) {
 		return -1;
 	}
 
-	((gl_uniform_vector_writer_proc)self->gl_value_writer_proc)(self->program_obj, self->location, 1, c_values);
+	MGLUniform_write(self, c_values);
 
 	return 0;
 }
@@ -404,7 +428,7 @@ int MGLUniform_vec_value_setter(MGLUniform * self, PyObject * value) {
 		return -1;
 	}
 
-	((gl_uniform_vector_writer_proc)self->gl_value_writer_proc)(self->program_obj, self->location, 1, c_values);
+	MGLUniform_write(self, c_values);
 
 	return 0;
 }
@@ -434,7 +458,7 @@ int MGLUniform_dvec_value_setter(MGLUniform * self, PyObject * value) {
 		return -1;
 	}
 
-	((gl_uniform_vector_writer_proc)self->gl_value_writer_proc)(self->program_obj, self->location, 1, c_values);
+	MGLUniform_write(self, c_values);
 
 	return 0;
 }
@@ -442,12 +466,12 @@ int MGLUniform_dvec_value_setter(MGLUniform * self, PyObject * value) {
 template <int N>
 int MGLUniform_bvec_array_value_setter(MGLUniform * self, PyObject * value) {
 
-	if (Py_TYPE(value) != &PyList_Type) {
-		MGLError_Set("the value must be a list not %s", Py_TYPE(value)->tp_name);
+	if (Py_TYPE(value) != &PyList_Type && Py_TYPE(value) != &PyTuple_Type) {
+		MGLError_Set("the value must be a list or a tuple not %s", Py_TYPE(value)->tp_name);
 		return -1;
 	}
 
-	int size = (int)PyList_GET_SIZE(value);
+	int size = (int)PySequence_Fast_GET_SIZE(value);
 
 	if (size != self->array_length) {
 		MGLError_Set("the value must be a list of size %d not %d", self->array_length, size);
@@ -455,14 +479,18 @@ int MGLUniform_bvec_array_value_setter(MGLUniform * self, PyObject * value) {
 	}
 
 	int cnt = 0;
-	int * c_values = new int[size * N];
+	int * c_values = (int *)MGLContext_scratch(self->context, sizeof(int) * size * N);
+
+	if (!c_values) {
+		return -1;
+	}
 
 	for (int k = 0; k < size; ++k) {
-		PyObject * tuple = PyList_GET_ITEM(value, k);
+		PyObject * tuple = PySequence_Fast_GET_ITEM(value, k);
 
 		if (Py_TYPE(tuple) != &PyTuple_Type) {
 			MGLError_Set("value[%d] must be a tuple not %s", k, Py_TYPE(value)->tp_name);
-			delete[] c_values;
+			MGLContext_release_scratch(self->context, c_values);
 			return -1;
 		}
 
@@ -470,7 +498,7 @@ int MGLUniform_bvec_array_value_setter(MGLUniform * self, PyObject * value) {
 
 		if (tuple_size != N) {
 			MGLError_Set("value[%d] must be a tuple of size %d not %d", k, N, tuple_size);
-			delete[] c_values;
+			MGLContext_release_scratch(self->context, c_values);
 			return -1;
 		}
 
@@ -483,27 +511,27 @@ int MGLUniform_bvec_array_value_setter(MGLUniform * self, PyObject * value) {
 				c_values[cnt++] = 0;
 			} else {
 				MGLError_Set("value[%d][%d] must be a bool not %s", k, i, Py_TYPE(value)->tp_name);
-				delete[] c_values;
+				MGLContext_release_scratch(self->context, c_values);
 				return -1;
 			}
 		}
 	}
 
-	((gl_uniform_vector_writer_proc)self->gl_value_writer_proc)(self->program_obj, self->location, size * N, c_values);
+	MGLUniform_write(self, c_values);
 
-	delete[] c_values;
+	MGLContext_release_scratch(self->context, c_values);
 	return 0;
 }
 
 template <int N>
 int MGLUniform_ivec_array_value_setter(MGLUniform * self, PyObject * value) {
 
-	if (Py_TYPE(value) != &PyList_Type) {
-		MGLError_Set("the value must be a list not %s", Py_TYPE(value)->tp_name);
+	if (Py_TYPE(value) != &PyList_Type && Py_TYPE(value) != &PyTuple_Type) {
+		MGLError_Set("the value must be a list or a tuple not %s", Py_TYPE(value)->tp_name);
 		return -1;
 	}
 
-	int size = (int)PyList_GET_SIZE(value);
+	int size = (int)PySequence_Fast_GET_SIZE(value);
 
 	if (size != self->array_length) {
 		MGLError_Set("the value must be a list of size %d not %d", self->array_length, size);
@@ -511,14 +539,18 @@ int MGLUniform_ivec_array_value_setter(MGLUniform * self, PyObject * value) {
 	}
 
 	int cnt = 0;
-	int * c_values = new int[size * N];
+	int * c_values = (int *)MGLContext_scratch(self->context, sizeof(int) * size * N);
+
+	if (!c_values) {
+		return -1;
+	}
 
 	for (int k = 0; k < size; ++k) {
-		PyObject * tuple = PyList_GET_ITEM(value, k);
+		PyObject * tuple = PySequence_Fast_GET_ITEM(value, k);
 
 		if (Py_TYPE(tuple) != &PyTuple_Type) {
 			MGLError_Set("value[%d] must be a tuple not %s", k, Py_TYPE(value)->tp_name);
-			delete[] c_values;
+			MGLContext_release_scratch(self->context, c_values);
 			return -1;
 		}
 
@@ -526,7 +558,7 @@ int MGLUniform_ivec_array_value_setter(MGLUniform * self, PyObject * value) {
 
 		if (tuple_size != N) {
 			MGLError_Set("value[%d] must be a tuple of size %d not %d", k, N, tuple_size);
-			delete[] c_values;
+			MGLContext_release_scratch(self->context, c_values);
 			return -1;
 		}
 
@@ -537,25 +569,25 @@ int MGLUniform_ivec_array_value_setter(MGLUniform * self, PyObject * value) {
 
 	if (PyErr_Occurred()) {
 		MGLError_Set("cannot convert value to int");
-		delete[] c_values;
+		MGLContext_release_scratch(self->context, c_values);
 		return -1;
 	}
 
-	((gl_uniform_vector_writer_proc)self->gl_value_writer_proc)(self->program_obj, self->location, size * N, c_values);
+	MGLUniform_write(self, c_values);
 
-	delete[] c_values;
+	MGLContext_release_scratch(self->context, c_values);
 	return 0;
 }
 
 template <int N>
 int MGLUniform_uvec_array_value_setter(MGLUniform * self, PyObject * value) {
 
-	if (Py_TYPE(value) != &PyList_Type) {
-		MGLError_Set("the value must be a list not %s", Py_TYPE(value)->tp_name);
+	if (Py_TYPE(value) != &PyList_Type && Py_TYPE(value) != &PyTuple_Type) {
+		MGLError_Set("the value must be a list or a tuple not %s", Py_TYPE(value)->tp_name);
 		return -1;
 	}
 
-	int size = (int)PyList_GET_SIZE(value);
+	int size = (int)PySequence_Fast_GET_SIZE(value);
 
 	if (size != self->array_length) {
 		MGLError_Set("the value must be a list of size %d not %d", self->array_length, size);
@@ -563,14 +595,18 @@ int MGLUniform_uvec_array_value_setter(MGLUniform * self, PyObject * value) {
 	}
 
 	int cnt = 0;
-	unsigned * c_values = new unsigned[size * N];
+	unsigned * c_values = (unsigned *)MGLContext_scratch(self->context, sizeof(unsigned) * size * N);
+
+	if (!c_values) {
+		return -1;
+	}
 
 	for (int k = 0; k < size; ++k) {
-		PyObject * tuple = PyList_GET_ITEM(value, k);
+		PyObject * tuple = PySequence_Fast_GET_ITEM(value, k);
 
 		if (Py_TYPE(tuple) != &PyTuple_Type) {
 			MGLError_Set("value[%d] must be a tuple not %s", k, Py_TYPE(value)->tp_name);
-			delete[] c_values;
+			MGLContext_release_scratch(self->context, c_values);
 			return -1;
 		}
 
@@ -578,7 +614,7 @@ int MGLUniform_uvec_array_value_setter(MGLUniform * self, PyObject * value) {
 
 		if (tuple_size != N) {
 			MGLError_Set("value[%d] must be a tuple of size %d not %d", k, N, tuple_size);
-			delete[] c_values;
+			MGLContext_release_scratch(self->context, c_values);
 			return -1;
 		}
 
@@ -589,25 +625,25 @@ int MGLUniform_uvec_array_value_setter(MGLUniform * self, PyObject * value) {
 
 	if (PyErr_Occurred()) {
 		MGLError_Set("cannot convert value to unsigned int");
-		delete[] c_values;
+		MGLContext_release_scratch(self->context, c_values);
 		return -1;
 	}
 
-	((gl_uniform_vector_writer_proc)self->gl_value_writer_proc)(self->program_obj, self->location, size * N, c_values);
+	MGLUniform_write(self, c_values);
 
-	delete[] c_values;
+	MGLContext_release_scratch(self->context, c_values);
 	return 0;
 }
 
 template <int N>
 int MGLUniform_vec_array_value_setter(MGLUniform * self, PyObject * value) {
 
-	if (Py_TYPE(value) != &PyList_Type) {
-		MGLError_Set("the value must be a list not %s", Py_TYPE(value)->tp_name);
+	if (Py_TYPE(value) != &PyList_Type && Py_TYPE(value) != &PyTuple_Type) {
+		MGLError_Set("the value must be a list or a tuple not %s", Py_TYPE(value)->tp_name);
 		return -1;
 	}
 
-	int size = (int)PyList_GET_SIZE(value);
+	int size = (int)PySequence_Fast_GET_SIZE(value);
 
 	if (size != self->array_length) {
 		MGLError_Set("the value must be a list of size %d not %d", self->array_length, size);
@@ -615,14 +651,18 @@ int MGLUniform_vec_array_value_setter(MGLUniform * self, PyObject * value) {
 	}
 
 	int cnt = 0;
-	float * c_values = new float[size * N];
+	float * c_values = (float *)MGLContext_scratch(self->context, sizeof(float) * size * N);
+
+	if (!c_values) {
+		return -1;
+	}
 
 	for (int k = 0; k < size; ++k) {
-		PyObject * tuple = PyList_GET_ITEM(value, k);
+		PyObject * tuple = PySequence_Fast_GET_ITEM(value, k);
 
 		if (Py_TYPE(tuple) != &PyTuple_Type) {
 			MGLError_Set("value[%d] must be a tuple not %s", k, Py_TYPE(value)->tp_name);
-			delete[] c_values;
+			MGLContext_release_scratch(self->context, c_values);
 			return -1;
 		}
 
@@ -630,7 +670,7 @@ int MGLUniform_vec_array_value_setter(MGLUniform * self, PyObject * value) {
 
 		if (tuple_size != N) {
 			MGLError_Set("value[%d] must be a tuple of size %d not %d", k, N, tuple_size);
-			delete[] c_values;
+			MGLContext_release_scratch(self->context, c_values);
 			return -1;
 		}
 
@@ -641,25 +681,25 @@ int MGLUniform_vec_array_value_setter(MGLUniform * self, PyObject * value) {
 
 	if (PyErr_Occurred()) {
 		MGLError_Set("cannot convert value to float");
-		delete[] c_values;
+		MGLContext_release_scratch(self->context, c_values);
 		return -1;
 	}
 
-	((gl_uniform_vector_writer_proc)self->gl_value_writer_proc)(self->program_obj, self->location, size * N, c_values);
+	MGLUniform_write(self, c_values);
 
-	delete[] c_values;
+	MGLContext_release_scratch(self->context, c_values);
 	return 0;
 }
 
 template <int N>
 int MGLUniform_dvec_array_value_setter(MGLUniform * self, PyObject * value) {
 
-	if (Py_TYPE(value) != &PyList_Type) {
-		MGLError_Set("the value must be a list not %s", Py_TYPE(value)->tp_name);
+	if (Py_TYPE(value) != &PyList_Type && Py_TYPE(value) != &PyTuple_Type) {
+		MGLError_Set("the value must be a list or a tuple not %s", Py_TYPE(value)->tp_name);
 		return -1;
 	}
 
-	int size = (int)PyList_GET_SIZE(value);
+	int size = (int)PySequence_Fast_GET_SIZE(value);
 
 	if (size != self->array_length) {
 		MGLError_Set("the value must be a list of size %d not %d", self->array_length, size);
@@ -667,14 +707,18 @@ int MGLUniform_dvec_array_value_setter(MGLUniform * self, PyObject * value) {
 	}
 
 	int cnt = 0;
-	double * c_values = new double[size * N];
+	double * c_values = (double *)MGLContext_scratch(self->context, sizeof(double) * size * N);
+
+	if (!c_values) {
+		return -1;
+	}
 
 	for (int k = 0; k < size; ++k) {
-		PyObject * tuple = PyList_GET_ITEM(value, k);
+		PyObject * tuple = PySequence_Fast_GET_ITEM(value, k);
 
 		if (Py_TYPE(tuple) != &PyTuple_Type) {
 			MGLError_Set("value[%d] must be a tuple not %s", k, Py_TYPE(value)->tp_name);
-			delete[] c_values;
+			MGLContext_release_scratch(self->context, c_values);
 			return -1;
 		}
 
@@ -682,7 +726,7 @@ int MGLUniform_dvec_array_value_setter(MGLUniform * self, PyObject * value) {
 
 		if (tuple_size != N) {
 			MGLError_Set("value[%d] must be a tuple of size %d not %d", k, N, tuple_size);
-			delete[] c_values;
+			MGLContext_release_scratch(self->context, c_values);
 			return -1;
 		}
 
@@ -693,13 +737,13 @@ int MGLUniform_dvec_array_value_setter(MGLUniform * self, PyObject * value) {
 
 	if (PyErr_Occurred()) {
 		MGLError_Set("cannot convert value to double");
-		delete[] c_values;
+		MGLContext_release_scratch(self->context, c_values);
 		return -1;
 	}
 
-	((gl_uniform_vector_writer_proc)self->gl_value_writer_proc)(self->program_obj, self->location, size * N, c_values);
+	MGLUniform_write(self, c_values);
 
-	delete[] c_values;
+	MGLContext_release_scratch(self->context, c_values);
 	return 0;
 }
 
@@ -728,7 +772,7 @@ int MGLUniform_matrix_value_setter(MGLUniform * self, PyObject * value) {
 		return -1;
 	}
 
-	((gl_uniform_matrix_writer_proc)self->gl_value_writer_proc)(self->program_obj, self->location, 1, false, c_values);
+	MGLUniform_write(self, c_values);
 
 	return 0;
 }
@@ -736,12 +780,12 @@ int MGLUniform_matrix_value_setter(MGLUniform * self, PyObject * value) {
 template <typename T, int N, int M>
 int MGLUniform_matrix_array_value_setter(MGLUniform * self, PyObject * value) {
 
-	if (Py_TYPE(value) != &PyList_Type) {
-		MGLError_Set("the value must be a list not %s", Py_TYPE(value)->tp_name);
+	if (Py_TYPE(value) != &PyList_Type && Py_TYPE(value) != &PyTuple_Type) {
+		MGLError_Set("the value must be a list or a tuple not %s", Py_TYPE(value)->tp_name);
 		return -1;
 	}
 
-	int size = (int)PyList_GET_SIZE(value);
+	int size = (int)PySequence_Fast_GET_SIZE(value);
 
 	if (size != self->array_length) {
 		MGLError_Set("the value must be a list of size %d not %d", self->array_length, size);
@@ -749,14 +793,18 @@ int MGLUniform_matrix_array_value_setter(MGLUniform * self, PyObject * value) {
 	}
 
 	int cnt = 0;
-	T * c_values = new T[size * N * M];
+	T * c_values = (T *)MGLContext_scratch(self->context, sizeof(T) * size * N * M);
+
+	if (!c_values) {
+		return -1;
+	}
 
 	for (int k = 0; k < size; ++k) {
-		PyObject * tuple = PyList_GET_ITEM(value, k);
+		PyObject * tuple = PySequence_Fast_GET_ITEM(value, k);
 
 		if (Py_TYPE(tuple) != &PyTuple_Type) {
 			MGLError_Set("value[%d] must be a tuple not %s", k, Py_TYPE(value)->tp_name);
-			delete[] c_values;
+			MGLContext_release_scratch(self->context, c_values);
 			return -1;
 		}
 
@@ -764,7 +812,7 @@ int MGLUniform_matrix_array_value_setter(MGLUniform * self, PyObject * value) {
 
 		if (tuple_size != N * M) {
 			MGLError_Set("value[%d] must be a tuple of size %d not %d", k, N * M, tuple_size);
-			delete[] c_values;
+			MGLContext_release_scratch(self->context, c_values);
 			return -1;
 		}
 
@@ -775,13 +823,13 @@ int MGLUniform_matrix_array_value_setter(MGLUniform * self, PyObject * value) {
 
 	if (PyErr_Occurred()) {
 		MGLError_Set("invalid values");
-		delete[] c_values;
+		MGLContext_release_scratch(self->context, c_values);
 		return -1;
 	}
 
-	((gl_uniform_matrix_writer_proc)self->gl_value_writer_proc)(self->program_obj, self->location, size, false, c_values);
+	MGLUniform_write(self, c_values);
 
-	delete[] c_values;
+	MGLContext_release_scratch(self->context, c_values);
 	return 0;
 }
 
@@ -0,0 +1,602 @@
+#include "Types.hpp"
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+struct MGLUploadJob {
+	char * dst;
+	const char * src;
+	Py_ssize_t size;
+};
+
+struct MGLUpload {
+	PyObject * texture;
+	Py_buffer data;
+
+	int target;
+	int texture_obj;
+	int level;
+
+	int x;
+	int y;
+	int z;
+	int width;
+	int height;
+	int depth;
+
+	int format;
+	int pixel_type;
+	int alignment;
+
+	// Compressed uploads pass the blocks through
+	int internal_format;
+	int image_size;
+
+	Py_ssize_t offset;
+};
+
+// The worker thread only copies memory, it never touches python objects or OpenGL.
+// The uploads are accessed with the GIL held.
+
+struct MGLUploadWorker {
+	std::thread thread;
+	std::mutex mutex;
+	std::condition_variable wake;
+	std::condition_variable idle;
+	std::deque<MGLUploadJob> jobs;
+	std::vector<MGLUpload> uploads;
+	bool copying;
+	bool stop;
+};
+
+void MGLUploadWorker_run(MGLUploadWorker * worker) {
+	std::unique_lock<std::mutex> lock(worker->mutex);
+
+	while (true) {
+		worker->wake.wait(lock, [worker] { return worker->stop || !worker->jobs.empty(); });
+
+		// Stop only after the remaining copies are done.
+
+		if (worker->jobs.empty()) {
+			break;
+		}
+
+		MGLUploadJob job = worker->jobs.front();
+		worker->jobs.pop_front();
+		worker->copying = true;
+
+		lock.unlock();
+		memcpy(job.dst, job.src, job.size);
+		lock.lock();
+
+		worker->copying = false;
+
+		if (worker->jobs.empty()) {
+			worker->idle.notify_all();
+		}
+	}
+}
+
+void MGLUploadWorker_wait(MGLUploadWorker * worker) {
+	Py_BEGIN_ALLOW_THREADS
+	std::unique_lock<std::mutex> lock(worker->mutex);
+	worker->idle.wait(lock, [worker] { return worker->jobs.empty() && !worker->copying; });
+	Py_END_ALLOW_THREADS
+}
+
+void MGLUploadWorker_release_uploads(MGLUploadWorker * worker) {
+	for (size_t i = 0; i < worker->uploads.size(); ++i) {
+		PyBuffer_Release(&worker->uploads[i].data);
+		Py_DECREF(worker->uploads[i].texture);
+	}
+
+	worker->uploads.clear();
+}
+
+PyObject * MGLContext_upload_queue(MGLContext * self, PyObject * args) {
+	MGLBuffer * buffer;
+	int slots;
+
+	int args_ok = PyArg_ParseTuple(
+		args,
+		"O!I",
+		&MGLBuffer_Type,
+		&buffer,
+		&slots
+	);
+
+	if (!args_ok) {
+		return 0;
+	}
+
+	if (!buffer->persistent) {
+		MGLError_Set("the upload queue requires a persistent buffer");
+		return 0;
+	}
+
+	if (slots < 1 || buffer->size / slots < 1) {
+		MGLError_Set("invalid number of slots = %d", slots);
+		return 0;
+	}
+
+	MGLUploadQueue * queue = (MGLUploadQueue *)MGLUploadQueue_Type.tp_alloc(&MGLUploadQueue_Type, 0);
+
+	queue->slots = slots;
+	queue->slot_size = buffer->size / slots;
+	queue->slot = 0;
+	queue->cursor = 0;
+
+	queue->fences = new GLsync[slots];
+	for (int i = 0; i < slots; ++i) {
+		queue->fences[i] = 0;
+	}
+
+	MGLUploadWorker * worker = new MGLUploadWorker();
+	worker->copying = false;
+	worker->stop = false;
+	worker->thread = std::thread(MGLUploadWorker_run, worker);
+	queue->worker = worker;
+
+	Py_INCREF(buffer);
+	queue->buffer = buffer;
+
+	Py_INCREF(self);
+	queue->context = self;
+
+	Py_INCREF(queue);
+
+	return (PyObject *)queue;
+}
+
+PyObject * MGLUploadQueue_tp_new(PyTypeObject * type, PyObject * args, PyObject * kwargs) {
+	MGLUploadQueue * self = (MGLUploadQueue *)type->tp_alloc(type, 0);
+
+	if (self) {
+	}
+
+	return (PyObject *)self;
+}
+
+void MGLUploadQueue_tp_dealloc(MGLUploadQueue * self) {
+	// A queue dropped without release still owns a running worker.
+
+	MGLUploadWorker * worker = self->worker;
+
+	if (worker) {
+		{
+			std::lock_guard<std::mutex> lock(worker->mutex);
+			worker->stop = true;
+			worker->wake.notify_one();
+		}
+
+		Py_BEGIN_ALLOW_THREADS
+		worker->thread.join();
+		Py_END_ALLOW_THREADS
+
+		MGLUploadWorker_release_uploads(worker);
+		delete worker;
+		delete[] self->fences;
+	}
+
+	MGLUploadQueue_Type.tp_free((PyObject *)self);
+}
+
+PyObject * MGLUploadQueue_write(MGLUploadQueue * self, PyObject * args) {
+	PyObject * texture;
+	PyObject * data;
+	PyObject * viewport;
+	int level;
+	int alignment;
+
+	int args_ok = PyArg_ParseTuple(
+		args,
+		"OOOII",
+		&texture,
+		&data,
+		&viewport,
+		&level,
+		&alignment
+	);
+
+	if (!args_ok) {
+		return 0;
+	}
+
+	if (Py_TYPE(self->buffer) == &MGLInvalidObject_Type) {
+		MGLError_Set("the staging buffer was released");
+		return 0;
+	}
+
+	if (alignment != 1 && alignment != 2 && alignment != 4 && alignment != 8) {
+		MGLError_Set("the alignment must be 1, 2, 4 or 8");
+		return 0;
+	}
+
+	MGLUpload upload = {};
+
+	MGLDataType * data_type;
+	int components;
+	int max_level;
+	bool immutable;
+	bool depth = false;
+
+	if (Py_TYPE(texture) == &MGLTexture_Type) {
+		MGLTexture * tex = (MGLTexture *)texture;
+
+		if (tex->samples) {
+			MGLError_Set("multisample textures cannot be written directly");
+			return 0;
+		}
+
+		upload.target = GL_TEXTURE_2D;
+		upload.texture_obj = tex->texture_obj;
+		upload.width = tex->width;
+		upload.height = tex->height;
+		upload.depth = 1;
+		data_type = tex->data_type;
+		components = tex->components;
+		immutable = tex->immutable;
+		max_level = tex->max_level;
+		depth = tex->depth;
+
+	} else if (Py_TYPE(texture) == &MGLTexture3D_Type) {
+		MGLTexture3D * tex = (MGLTexture3D *)texture;
+
+		upload.target = GL_TEXTURE_3D;
+		upload.texture_obj = tex->texture_obj;
+		upload.width = tex->width;
+		upload.height = tex->height;
+		upload.depth = tex->depth;
+		data_type = tex->data_type;
+		components = tex->components;
+		immutable = tex->immutable;
+		max_level = tex->max_level;
+
+	} else if (Py_TYPE(texture) == &MGLTextureArray_Type) {
+		MGLTextureArray * tex = (MGLTextureArray *)texture;
+
+		upload.target = GL_TEXTURE_2D_ARRAY;
+		upload.texture_obj = tex->texture_obj;
+		upload.width = tex->width;
+		upload.height = tex->height;
+		upload.depth = tex->layers;
+		data_type = tex->data_type;
+		components = tex->components;
+		immutable = tex->immutable;
+		max_level = tex->max_level;
+
+	} else {
+		MGLError_Set("the texture must be a Texture, Texture3D or TextureArray not %s", Py_TYPE(texture)->tp_name);
+		return 0;
+	}
+
+	// Mutable textures get their levels on write, only immutable textures are limited to max_level.
+
+	int largest = upload.width > upload.height ? upload.width : upload.height;
+
+	if (upload.target == GL_TEXTURE_3D && upload.depth > largest) {
+		largest = upload.depth;
+	}
+
+	if (level < 0 || level > 30 || (largest >> level) < 1 || (immutable && level > max_level)) {
+		MGLError_Set("invalid level");
+		return 0;
+	}
+
+	upload.width = upload.width / (1 << level);
+	upload.height = upload.height / (1 << level);
+
+	if (upload.target == GL_TEXTURE_3D) {
+		upload.depth = upload.depth / (1 << level);
+	}
+
+	upload.width = upload.width > 1 ? upload.width : 1;
+	upload.height = upload.height > 1 ? upload.height : 1;
+	upload.depth = upload.depth > 1 ? upload.depth : 1;
+
+	int level_width = upload.width;
+	int level_height = upload.height;
+
+	if (viewport != Py_None) {
+		if (Py_TYPE(viewport) != &PyTuple_Type) {
+			MGLError_Set("the viewport must be a tuple not %s", Py_TYPE(viewport)->tp_name);
+			return 0;
+		}
+
+		int dims = upload.target == GL_TEXTURE_2D ? 2 : 3;
+		Py_ssize_t viewport_size = PyTuple_GET_SIZE(viewport);
+		int values[6] = {};
+
+		if (viewport_size != dims && viewport_size != dims * 2) {
+			MGLError_Set("the viewport size %d is invalid", viewport_size);
+			return 0;
+		}
+
+		for (int i = 0; i < viewport_size; ++i) {
+			values[i] = PyLong_AsLong(PyTuple_GET_ITEM(viewport, i));
+		}
+
+		if (PyErr_Occurred()) {
+			MGLError_Set("wrong values in the viewport");
+			return 0;
+		}
+
+		int * size = viewport_size == dims ? values : values + dims;
+
+		if (viewport_size == dims * 2) {
+			upload.x = values[0];
+			upload.y = values[1];
+			upload.z = dims == 3 ? values[2] : 0;
+		}
+
+		upload.width = size[0];
+		upload.height = size[1];
+		upload.depth = dims == 3 ? size[2] : 1;
+	}
+
+	upload.level = level;
+	upload.alignment = alignment;
+	upload.pixel_type = data_type->gl_type;
+	upload.format = depth ? GL_DEPTH_COMPONENT : data_type->base_format[components];
+
+	Py_ssize_t expected_size = upload.width * components * data_type->size;
+	expected_size = (expected_size + alignment - 1) / alignment * alignment;
+	expected_size = expected_size * upload.height * upload.depth;
+
+	if (data_type->block_size) {
+		if (!compressed_region(data_type, upload.x, upload.y, upload.width, upload.height, level_width, level_height)) {
+			MGLError_Set("the viewport must be aligned to %dx%d blocks", data_type->block_width, data_type->block_height);
+			return 0;
+		}
+
+		expected_size = compressed_size(data_type, upload.width, upload.height, upload.depth);
+		upload.internal_format = data_type->internal_format[components];
+		upload.image_size = (int)expected_size;
+	}
+
+	int get_buffer = PyObject_GetBuffer(data, &upload.data, PyBUF_SIMPLE);
+	if (get_buffer < 0) {
+		// Propagate the default error
+		return 0;
+	}
+
+	if (upload.data.len != expected_size) {
+		MGLError_Set("data size mismatch %d != %d", upload.data.len, expected_size);
+		PyBuffer_Release(&upload.data);
+		return 0;
+	}
+
+	// The offsets are aligned for every pixel type.
+
+	Py_ssize_t cursor = (self->cursor + 15) / 16 * 16;
+
+	if (cursor + expected_size > self->slot_size) {
+		MGLError_Set("the slot is full (%d bytes requested, %d bytes free)", expected_size, self->slot_size - self->cursor);
+		PyBuffer_Release(&upload.data);
+		return 0;
+	}
+
+	self->cursor = cursor + expected_size;
+	upload.offset = self->slot * self->slot_size + cursor;
+
+	Py_INCREF(texture);
+	upload.texture = texture;
+
+	MGLUploadWorker * worker = self->worker;
+	worker->uploads.push_back(upload);
+
+	if (expected_size) {
+		MGLUploadJob job = {self->buffer->mapping + upload.offset, (const char *)upload.data.buf, expected_size};
+		std::lock_guard<std::mutex> lock(worker->mutex);
+		worker->jobs.push_back(job);
+		worker->wake.notify_one();
+	}
+
+	Py_RETURN_NONE;
+}
+
+PyObject * MGLUploadQueue_flush(MGLUploadQueue * self) {
+	MGLUploadWorker * worker = self->worker;
+
+	if (worker->uploads.empty()) {
+		Py_RETURN_NONE;
+	}
+
+	MGLUploadWorker_wait(worker);
+
+	if (Py_TYPE(self->buffer) == &MGLInvalidObject_Type) {
+		MGLUploadWorker_release_uploads(worker);
+		MGLError_Set("the staging buffer was released");
+		return 0;
+	}
+
+	const GLMethods & gl = self->context->gl;
+
+	gl.BindBuffer(GL_PIXEL_UNPACK_BUFFER, self->buffer->buffer_obj);
+	gl.ActiveTexture(GL_TEXTURE0 + self->context->default_texture_unit);
+
+	for (size_t i = 0; i < worker->uploads.size(); ++i) {
+		MGLUpload & upload = worker->uploads[i];
+
+		// Textures released after the write are skipped.
+
+		if (Py_TYPE(upload.texture) == &MGLInvalidObject_Type) {
+			continue;
+		}
+
+		void * offset = (void *)upload.offset;
+
+		gl.BindTexture(upload.target, upload.texture_obj);
+		gl.PixelStorei(GL_UNPACK_ALIGNMENT, upload.alignment);
+
+		if (upload.target == GL_TEXTURE_2D && upload.internal_format) {
+			gl.CompressedTexSubImage2D(upload.target, upload.level, upload.x, upload.y, upload.width, upload.height, upload.internal_format, upload.image_size, offset);
+		} else if (upload.target == GL_TEXTURE_2D) {
+			gl.TexSubImage2D(upload.target, upload.level, upload.x, upload.y, upload.width, upload.height, upload.format, upload.pixel_type, offset);
+		} else if (upload.internal_format) {
+			gl.CompressedTexSubImage3D(upload.target, upload.level, upload.x, upload.y, upload.z, upload.width, upload.height, upload.depth, upload.internal_format, upload.image_size, offset);
+		} else {
+			gl.TexSubImage3D(upload.target, upload.level, upload.x, upload.y, upload.z, upload.width, upload.height, upload.depth, upload.format, upload.pixel_type, offset);
+		}
+
+		self->context->stats.bytes_written += upload.data.len;
+	}
+
+	gl.BindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+
+	MGLUploadWorker_release_uploads(worker);
+
+	// Fence the slot and move to the next one, waiting only if the GPU is still reading it.
+
+	if (self->fences[self->slot]) {
+		gl.DeleteSync(self->fences[self->slot]);
+	}
+
+	self->fences[self->slot] = gl.FenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+
+	self->slot = (self->slot + 1) % self->slots;
+	self->cursor = 0;
+
+	GLsync fence = self->fences[self->slot];
+
+	if (!fence) {
+		Py_RETURN_NONE;
+	}
+
+	GLenum status = gl.ClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, 1000000000);
+	while (status == GL_TIMEOUT_EXPIRED) {
+		status = gl.ClientWaitSync(fence, 0, 1000000000);
+	}
+
+	gl.DeleteSync(fence);
+	self->fences[self->slot] = 0;
+
+	if (status == GL_WAIT_FAILED) {
+		MGLError_Set("cannot wait for the slot");
+		return 0;
+	}
+
+	Py_RETURN_NONE;
+}
+
+PyObject * MGLUploadQueue_release(MGLUploadQueue * self) {
+	MGLUploadQueue_Invalidate(self);
+	Py_RETURN_NONE;
+}
+
+PyMethodDef MGLUploadQueue_tp_methods[] = {
+	{"write", (PyCFunction)MGLUploadQueue_write, METH_VARARGS, 0},
+	{"flush", (PyCFunction)MGLUploadQueue_flush, METH_NOARGS, 0},
+	{"release", (PyCFunction)MGLUploadQueue_release, METH_NOARGS, 0},
+	{0},
+};
+
+PyObject * MGLUploadQueue_get_slot(MGLUploadQueue * self) {
+	return PyLong_FromLong(self->slot);
+}
+
+PyObject * MGLUploadQueue_get_slot_size(MGLUploadQueue * self) {
+	return PyLong_FromSsize_t(self->slot_size);
+}
+
+PyObject * MGLUploadQueue_get_free(MGLUploadQueue * self) {
+	return PyLong_FromSsize_t(self->slot_size - self->cursor);
+}
+
+PyObject * MGLUploadQueue_get_pending(MGLUploadQueue * self) {
+	return PyLong_FromSsize_t((Py_ssize_t)self->worker->uploads.size());
+}
+
+PyGetSetDef MGLUploadQueue_tp_getseters[] = {
+	{(char *)"slot", (getter)MGLUploadQueue_get_slot, 0, 0, 0},
+	{(char *)"slot_size", (getter)MGLUploadQueue_get_slot_size, 0, 0, 0},
+	{(char *)"free", (getter)MGLUploadQueue_get_free, 0, 0, 0},
+	{(char *)"pending", (getter)MGLUploadQueue_get_pending, 0, 0, 0},
+	{0},
+};
+
+PyTypeObject MGLUploadQueue_Type = {
+	PyVarObject_HEAD_INIT(0, 0)
+	"mgl.UploadQueue",                                      // tp_name
+	sizeof(MGLUploadQueue),                                 // tp_basicsize
+	0,                                                      // tp_itemsize
+	(destructor)MGLUploadQueue_tp_dealloc,                  // tp_dealloc
+	0,                                                      // tp_print
+	0,                                                      // tp_getattr
+	0,                                                      // tp_setattr
+	0,                                                      // tp_reserved
+	0,                                                      // tp_repr
+	0,                                                      // tp_as_number
+	0,                                                      // tp_as_sequence
+	0,                                                      // tp_as_mapping
+	0,                                                      // tp_hash
+	0,                                                      // tp_call
+	0,                                                      // tp_str
+	0,                                                      // tp_getattro
+	0,                                                      // tp_setattro
+	0,                                                      // tp_as_buffer
+	Py_TPFLAGS_DEFAULT,                                     // tp_flags
+	0,                                                      // tp_doc
+	0,                                                      // tp_traverse
+	0,                                                      // tp_clear
+	0,                                                      // tp_richcompare
+	0,                                                      // tp_weaklistoffset
+	0,                                                      // tp_iter
+	0,                                                      // tp_iternext
+	MGLUploadQueue_tp_methods,                              // tp_methods
+	0,                                                      // tp_members
+	MGLUploadQueue_tp_getseters,                            // tp_getset
+	0,                                                      // tp_base
+	0,                                                      // tp_dict
+	0,                                                      // tp_descr_get
+	0,                                                      // tp_descr_set
+	0,                                                      // tp_dictoffset
+	0,                                                      // tp_init
+	0,                                                      // tp_alloc
+	MGLUploadQueue_tp_new,                                  // tp_new
+};
+
+void MGLUploadQueue_Invalidate(MGLUploadQueue * queue) {
+	if (Py_TYPE(queue) == &MGLInvalidObject_Type) {
+		return;
+	}
+
+	MGLUploadWorker * worker = queue->worker;
+
+	{
+		std::lock_guard<std::mutex> lock(worker->mutex);
+		worker->stop = true;
+		worker->wake.notify_one();
+	}
+
+	Py_BEGIN_ALLOW_THREADS
+	worker->thread.join();
+	Py_END_ALLOW_THREADS
+
+	MGLUploadWorker_release_uploads(worker);
+	delete worker;
+	queue->worker = 0;
+
+	const GLMethods & gl = queue->context->gl;
+
+	for (int i = 0; i < queue->slots; ++i) {
+		if (queue->fences[i]) {
+			gl.DeleteSync(queue->fences[i]);
+		}
+	}
+
+	delete[] queue->fences;
+	queue->fences = 0;
+
+	// The staging buffer is owned by the queue, it is released once the worker stopped copying into it.
+
+	MGLBuffer_Invalidate(queue->buffer);
+	Py_DECREF(queue->buffer);
+	Py_DECREF(queue->context);
+
+	Py_TYPE(queue) = &MGLInvalidObject_Type;
+	Py_DECREF(queue);
+}
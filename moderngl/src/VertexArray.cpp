@@ -5,6 +5,16 @@
 typedef void (GLAPI * gl_attribute_normal_ptr_proc)(GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride, const void * pointer);
 typedef void (GLAPI * gl_attribute_ptr_proc)(GLuint index, GLint size, GLenum type, GLsizei stride, const void * pointer);
 
+void MGLVertexArray_add_buffer(MGLVertexArray * self, MGLBuffer * buffer) {
+	for (Py_ssize_t i = 0; i < PyList_GET_SIZE(self->buffers); ++i) {
+		if (PyList_GET_ITEM(self->buffers, i) == (PyObject *)buffer) {
+			return;
+		}
+	}
+
+	PyList_Append(self->buffers, (PyObject *)buffer);
+}
+
 PyObject * MGLContext_vertex_array(MGLContext * self, PyObject * args) {
 	MGLProgram * program;
 	PyObject * content;
@@ -142,7 +152,9 @@ PyObject * MGLContext_vertex_array(MGLContext * self, PyObject * args) {
 		return 0;
 	}
 
-	gl.BindVertexArray(array->vertex_array_obj);
+	MGLContext_bind_vertex_array(self, array->vertex_array_obj);
+
+	array->buffers = PyList_New(0);
 
 	Py_INCREF(index_buffer);
 	array->index_buffer = index_buffer;
@@ -169,6 +181,8 @@ PyObject * MGLContext_vertex_array(MGLContext * self, PyObject * args) {
 
 		int buf_vertices = (int)(buffer->size / format_info.size);
 
+		MGLVertexArray_add_buffer(array, buffer);
+
 		if (!format_info.divisor && array->index_buffer == (MGLBuffer *)Py_None && (!i || array->num_vertices > buf_vertices)) {
 			array->num_vertices = buf_vertices;
 		}
@@ -241,6 +255,64 @@ void MGLVertexArray_tp_dealloc(MGLVertexArray * self) {
 
 inline void MGLVertexArray_SET_SUBROUTINES(MGLVertexArray * self, const GLMethods & gl);
 
+bool MGLVertexArray_check_unmapped(MGLVertexArray * self) {
+	if (self->index_buffer != (MGLBuffer *)Py_None && !MGLBuffer_check_unmapped(self->index_buffer)) {
+		return false;
+	}
+
+	for (Py_ssize_t i = 0; i < PyList_GET_SIZE(self->buffers); ++i) {
+		if (!MGLBuffer_check_unmapped((MGLBuffer *)PyList_GET_ITEM(self->buffers, i))) {
+			return false;
+		}
+	}
+
+	return true;
+}
+
+// The draw calls are shared with the command lists.
+
+void MGLVertexArray_draw(MGLVertexArray * self, int mode, int vertices, int first, int instances) {
+	const GLMethods & gl = self->context->gl;
+
+	MGLContext_use_program(self->context, self->program->program_obj);
+	MGLContext_bind_vertex_array(self->context, self->vertex_array_obj);
+
+	MGLVertexArray_SET_SUBROUTINES(self, gl);
+
+	if (self->index_buffer != (MGLBuffer *)Py_None) {
+		const void * ptr = (const void *)((GLintptr)first * self->index_element_size);
+		gl.DrawElementsInstanced(mode, vertices, self->index_element_type, ptr, instances);
+	} else {
+		gl.DrawArraysInstanced(mode, first, vertices, instances);
+	}
+
+	MGLStats & stats = self->context->stats;
+	stats.draw_calls += 1;
+	stats.vertices += (long long)vertices * instances;
+	stats.instances += instances;
+}
+
+void MGLVertexArray_draw_indirect(MGLVertexArray * self, int buffer_obj, int mode, int count, int first) {
+	const GLMethods & gl = self->context->gl;
+
+	MGLContext_use_program(self->context, self->program->program_obj);
+	MGLContext_bind_vertex_array(self->context, self->vertex_array_obj);
+	gl.BindBuffer(GL_DRAW_INDIRECT_BUFFER, buffer_obj);
+
+	MGLVertexArray_SET_SUBROUTINES(self, gl);
+
+	const void * ptr = (const void *)((GLintptr)first * 20);
+
+	if (self->index_buffer != (MGLBuffer *)Py_None) {
+		gl.MultiDrawElementsIndirect(mode, self->index_element_type, ptr, count, 20);
+	} else {
+		gl.MultiDrawArraysIndirect(mode, ptr, count, 20);
+	}
+
+	// The vertices and the instances of indirect draws are not known on the CPU.
+	self->context->stats.draw_calls += count;
+}
+
 PyObject * MGLVertexArray_render(MGLVertexArray * self, PyObject * args) {
 	int mode;
 	int vertices;
@@ -273,20 +345,12 @@ PyObject * MGLVertexArray_render(MGLVertexArray * self, PyObject * args) {
 		instances = self->num_instances;
 	}
 
-	const GLMethods & gl = self->context->gl;
-
-	gl.UseProgram(self->program->program_obj);
-	gl.BindVertexArray(self->vertex_array_obj);
-
-	MGLVertexArray_SET_SUBROUTINES(self, gl);
-
-	if (self->index_buffer != (MGLBuffer *)Py_None) {
-		const void * ptr = (const void *)((GLintptr)first * self->index_element_size);
-		gl.DrawElementsInstanced(mode, vertices, self->index_element_type, ptr, instances);
-	} else {
-		gl.DrawArraysInstanced(mode, first, vertices, instances);
+	if (!MGLVertexArray_check_unmapped(self)) {
+		return 0;
 	}
 
+	MGLVertexArray_draw(self, mode, vertices, first, instances);
+
 	Py_RETURN_NONE;
 }
 
@@ -314,20 +378,181 @@ PyObject * MGLVertexArray_render_indirect(MGLVertexArray * self, PyObject * args
 		count = (int)(buffer->size / 20 - first);
 	}
 
-	const GLMethods & gl = self->context->gl;
+	if (!MGLVertexArray_check_unmapped(self) || !MGLBuffer_check_unmapped(buffer)) {
+		return 0;
+	}
 
-	gl.UseProgram(self->program->program_obj);
-	gl.BindVertexArray(self->vertex_array_obj);
-	gl.BindBuffer(GL_DRAW_INDIRECT_BUFFER, buffer->buffer_obj);
+	MGLVertexArray_draw_indirect(self, buffer->buffer_obj, mode, count, first);
 
-	MGLVertexArray_SET_SUBROUTINES(self, gl);
+	Py_RETURN_NONE;
+}
 
-	const void * ptr = (const void *)((GLintptr)first * 20);
+// Draw parameters are accepted from any contiguous buffer of 32-bit integers.
+// Plain byte buffers are interpreted as packed 32-bit integers.
 
-	if (self->index_buffer != (MGLBuffer *)Py_None) {
-		gl.MultiDrawElementsIndirect(mode, self->index_element_type, ptr, count, 20);
-	} else {
-		gl.MultiDrawArraysIndirect(mode, ptr, count, 20);
+bool MGLVertexArray_get_ints(PyObject * obj, Py_buffer * view, const char * name) {
+	int get_buffer = PyObject_GetBuffer(obj, view, PyBUF_C_CONTIGUOUS | PyBUF_FORMAT);
+	if (get_buffer < 0) {
+		// Propagate the default error
+		return false;
+	}
+
+	const char * format = view->format ? view->format : "B";
+
+	if (*format == '@' || *format == '=' || *format == '<') {
+		format += 1;
+	}
+
+	bool single = format[0] && !format[1];
+	bool ints = single && view->itemsize == 4 && strchr("iIlL", format[0]);
+	bool bytes = single && view->itemsize == 1 && strchr("bBc", format[0]);
+
+	if (!(ints || bytes) || view->len % 4) {
+		MGLError_Set("the %s must be 32-bit integers", name);
+		PyBuffer_Release(view);
+		return false;
+	}
+
+	return true;
+}
+
+PyObject * MGLVertexArray_render_multi(MGLVertexArray * self, PyObject * args) {
+	int mode;
+	PyObject * firsts;
+	PyObject * counts;
+	PyObject * instances;
+	PyObject * base_vertices;
+
+	int args_ok = PyArg_ParseTuple(
+		args,
+		"IOOOO",
+		&mode,
+		&firsts,
+		&counts,
+		&instances,
+		&base_vertices
+	);
+
+	if (!args_ok) {
+		return 0;
+	}
+
+	bool indexed = self->index_buffer != (MGLBuffer *)Py_None;
+
+	if (base_vertices != Py_None && !indexed) {
+		MGLError_Set("base_vertices requires an index_buffer");
+		return 0;
+	}
+
+	Py_buffer firsts_view = {};
+	Py_buffer counts_view = {};
+	Py_buffer instances_view = {};
+	Py_buffer base_vertices_view = {};
+
+	int num_instances = self->num_instances;
+	bool per_draw_instances = false;
+
+	if (PyLong_Check(instances)) {
+		num_instances = PyLong_AsLong(instances);
+	} else if (instances != Py_None) {
+		per_draw_instances = true;
+	}
+
+	bool ok = MGLVertexArray_get_ints(firsts, &firsts_view, "firsts");
+	ok = ok && MGLVertexArray_get_ints(counts, &counts_view, "counts");
+	ok = ok && (!per_draw_instances || MGLVertexArray_get_ints(instances, &instances_view, "instances"));
+	ok = ok && (base_vertices == Py_None || MGLVertexArray_get_ints(base_vertices, &base_vertices_view, "base_vertices"));
+	ok = ok && MGLVertexArray_check_unmapped(self);
+
+	int draws = (int)(counts_view.len / 4);
+
+	if (ok) {
+		bool mismatch = firsts_view.len != counts_view.len;
+		mismatch = mismatch || (per_draw_instances && instances_view.len != counts_view.len);
+		mismatch = mismatch || (base_vertices != Py_None && base_vertices_view.len != counts_view.len);
+
+		if (mismatch) {
+			MGLError_Set("firsts, counts, instances and base_vertices must have the same length");
+			ok = false;
+		}
+	}
+
+	if (ok && draws) {
+		const GLMethods & gl = self->context->gl;
+
+		MGLContext_use_program(self->context, self->program->program_obj);
+		MGLContext_bind_vertex_array(self->context, self->vertex_array_obj);
+
+		MGLVertexArray_SET_SUBROUTINES(self, gl);
+
+		const int * first_ptr = (const int *)firsts_view.buf;
+		const int * count_ptr = (const int *)counts_view.buf;
+		const int * instances_ptr = (const int *)instances_view.buf;
+		const int * base_vertex_ptr = (const int *)base_vertices_view.buf;
+
+		MGLStats & stats = self->context->stats;
+		stats.draw_calls += draws;
+
+		for (int i = 0; i < draws; ++i) {
+			long long draw_instances = per_draw_instances ? instances_ptr[i] : num_instances;
+			stats.vertices += count_ptr[i] * draw_instances;
+			stats.instances += draw_instances;
+		}
+
+		// There is no instanced multi-draw, the instanced draws are issued one by one.
+
+		bool instanced = per_draw_instances || num_instances != 1;
+
+		if (indexed) {
+			const void ** offsets = new const void * [draws];
+
+			for (int i = 0; i < draws; ++i) {
+				offsets[i] = (const void *)((GLintptr)first_ptr[i] * self->index_element_size);
+			}
+
+			if (instanced) {
+				for (int i = 0; i < draws; ++i) {
+					int draw_instances = per_draw_instances ? instances_ptr[i] : num_instances;
+					int base_vertex = base_vertex_ptr ? base_vertex_ptr[i] : 0;
+					gl.DrawElementsInstancedBaseVertex(mode, count_ptr[i], self->index_element_type, offsets[i], draw_instances, base_vertex);
+				}
+			} else if (base_vertex_ptr) {
+				gl.MultiDrawElementsBaseVertex(mode, count_ptr, self->index_element_type, offsets, draws, base_vertex_ptr);
+			} else {
+				gl.MultiDrawElements(mode, count_ptr, self->index_element_type, offsets, draws);
+			}
+
+			delete[] offsets;
+		} else {
+			if (instanced) {
+				for (int i = 0; i < draws; ++i) {
+					int draw_instances = per_draw_instances ? instances_ptr[i] : num_instances;
+					gl.DrawArraysInstanced(mode, first_ptr[i], count_ptr[i], draw_instances);
+				}
+			} else {
+				gl.MultiDrawArrays(mode, first_ptr, count_ptr, draws);
+			}
+		}
+	}
+
+	if (firsts_view.obj) {
+		PyBuffer_Release(&firsts_view);
+	}
+
+	if (counts_view.obj) {
+		PyBuffer_Release(&counts_view);
+	}
+
+	if (instances_view.obj) {
+		PyBuffer_Release(&instances_view);
+	}
+
+	if (base_vertices_view.obj) {
+		PyBuffer_Release(&base_vertices_view);
+	}
+
+	if (!ok) {
+		return 0;
 	}
 
 	Py_RETURN_NONE;
@@ -448,10 +673,14 @@ PyObject * MGLVertexArray_transform(MGLVertexArray * self, PyObject * args) {
 		}
 	}
 
+	if (!MGLVertexArray_check_unmapped(self) || !MGLBuffer_check_unmapped(output)) {
+		return 0;
+	}
+
 	const GLMethods & gl = self->context->gl;
 
-	gl.UseProgram(self->program->program_obj);
-	gl.BindVertexArray(self->vertex_array_obj);
+	MGLContext_use_program(self->context, self->program->program_obj);
+	MGLContext_bind_vertex_array(self->context, self->vertex_array_obj);
 
 	if (buffer_offset > 0) {
 		gl.BindBufferRange(GL_TRANSFORM_FEEDBACK_BUFFER, 0, output->buffer_obj, buffer_offset, output->size - buffer_offset);
@@ -471,6 +700,11 @@ PyObject * MGLVertexArray_transform(MGLVertexArray * self, PyObject * args) {
 		gl.DrawArraysInstanced(mode, first, vertices, instances);
 	}
 
+	MGLStats & stats = self->context->stats;
+	stats.draw_calls += 1;
+	stats.vertices += (long long)vertices * instances;
+	stats.instances += instances;
+
 	gl.EndTransformFeedback();
 	if (~self->context->enable_flags & MGL_RASTERIZER_DISCARD) {
 		gl.Disable(GL_RASTERIZER_DISCARD);
@@ -532,8 +766,9 @@ PyObject * MGLVertexArray_bind(MGLVertexArray * self, PyObject * args) {
 
 	const GLMethods & gl = self->context->gl;
 
-	gl.BindVertexArray(self->vertex_array_obj);
+	MGLContext_bind_vertex_array(self->context, self->vertex_array_obj);
 	gl.BindBuffer(GL_ARRAY_BUFFER, buffer->buffer_obj);
+	MGLVertexArray_add_buffer(self, buffer);
 
 	switch (type[0]) {
 		case 'f':
@@ -565,6 +800,7 @@ PyObject * MGLVertexArray_release(MGLVertexArray * self) {
 PyMethodDef MGLVertexArray_tp_methods[] = {
 	{"render", (PyCFunction)MGLVertexArray_render, METH_VARARGS, 0},
 	{"render_indirect", (PyCFunction)MGLVertexArray_render_indirect, METH_VARARGS, 0},
+	{"render_multi", (PyCFunction)MGLVertexArray_render_multi, METH_VARARGS, 0},
 	{"transform", (PyCFunction)MGLVertexArray_transform, METH_VARARGS, 0},
 	{"bind", (PyCFunction)MGLVertexArray_bind, METH_VARARGS, 0},
 	{"release", (PyCFunction)MGLVertexArray_release, METH_NOARGS, 0},
@@ -706,10 +942,12 @@ void MGLVertexArray_Invalidate(MGLVertexArray * array) {
 
 	const GLMethods & gl = array->context->gl;
 	gl.DeleteVertexArrays(1, (GLuint *)&array->vertex_array_obj);
+	MGLContext_forget_vertex_array(array->context, array->vertex_array_obj);
 
 	Py_TYPE(array) = &MGLInvalidObject_Type;
 	Py_DECREF(array->program);
 	Py_XDECREF(array->index_buffer);
+	Py_XDECREF(array->buffers);
 	Py_DECREF(array);
 }
 
@@ -659,6 +659,7 @@ struct GLMethods {
     PFNGLMULTIDRAWARRAYSINDIRECTCOUNTPROC MultiDrawArraysIndirectCount;
     PFNGLMULTIDRAWELEMENTSINDIRECTCOUNTPROC MultiDrawElementsIndirectCount;
     PFNGLPOLYGONOFFSETCLAMPPROC PolygonOffsetClamp;
+    PFNGLMAXSHADERCOMPILERTHREADSKHRPROC MaxShaderCompilerThreadsKHR;
 };
 
 const char * const GL_FUNCTIONS[] = {
@@ -1319,5 +1320,6 @@ const char * const GL_FUNCTIONS[] = {
     "glMultiDrawArraysIndirectCount",
     "glMultiDrawElementsIndirectCount",
     "glPolygonOffsetClamp",
+    "glMaxShaderCompilerThreadsKHR",
     NULL,
 };
@@ -0,0 +1,137 @@
+import logging
+
+from moderngl.mgl import InvalidObject  # type: ignore
+
+__all__ = ['StreamBuffer']
+
+LOG = logging.getLogger(__name__)
+
+
+class StreamBuffer:
+    '''
+        A ring allocator for data streamed to the GPU every frame.
+
+        The underlying :py:class:`Buffer` is split into equally sized regions.
+        Data is sub-allocated from the current region with a bump pointer.
+        :py:meth:`StreamBuffer.next_frame` puts a fence after the commands using the
+        current region and moves to the next one, waiting only if the GPU
+        is still reading it. The buffer is never orphaned.
+
+        A StreamBuffer object cannot be instantiated directly, it requires a context.
+        Use :py:meth:`Context.stream_buffer` to create one.
+    '''
+
+    __slots__ = ['mglo', '_buffer', '_regions', 'ctx', 'extra']
+
+    def __init__(self):
+        self.mglo = None  #: Internal representation for debug purposes only.
+        self._buffer = None
+        self._regions = None
+        self.ctx = None  #: The context this object belongs to
+        self.extra = None  #: Any - Attribute for storing user defined objects
+        raise TypeError()
+
+    def __repr__(self):
+        return '<StreamBuffer: %d x %d>' % (self._regions, self.region_size)
+
+    def __hash__(self) -> int:
+        return id(self)
+
+    def __del__(self):
+        LOG.debug(f"{self.__class__.__name__}.__del__ {self}")
+        if hasattr(self, "ctx") and self.ctx.gc_mode == "auto":
+            self.release()
+
+    @property
+    def buffer(self) -> 'Buffer':
+        '''
+            Buffer: The underlying buffer. Bind it to vertex arrays and uniform blocks
+            using the offsets returned by :py:meth:`StreamBuffer.write`.
+        '''
+
+        return self._buffer
+
+    @property
+    def regions(self) -> int:
+        '''
+            int: The number of regions.
+        '''
+
+        return self._regions
+
+    @property
+    def region(self) -> int:
+        '''
+            int: The index of the current region.
+        '''
+
+        return self.mglo.region
+
+    @property
+    def region_size(self) -> int:
+        '''
+            int: The size of a single region in bytes.
+        '''
+
+        return self.mglo.region_size
+
+    @property
+    def free(self) -> int:
+        '''
+            int: The number of bytes left in the current region.
+        '''
+
+        return self.mglo.free
+
+    def allocate(self, size, *, alignment=1) -> int:
+        '''
+            Reserve bytes in the current region without writing them.
+
+            Args:
+                size (int): The size in bytes.
+
+            Keyword Args:
+                alignment (int): The alignment of the returned offset.
+
+            Returns:
+                int: The offset in the underlying buffer.
+        '''
+
+        return self.mglo.allocate(size, alignment)
+
+    def write(self, data, *, alignment=1) -> int:
+        '''
+            Allocate space in the current region and write the data.
+
+            Args:
+                data (bytes): The data.
+
+            Keyword Args:
+                alignment (int): The alignment of the returned offset.
+                                 Use ``GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT`` for uniform blocks.
+
+            Returns:
+                int: The offset in the underlying buffer.
+        '''
+
+        return self.mglo.write(data, alignment)
+
+    def next_frame(self) -> None:
+        '''
+            Fence the current region and move to the next one.
+
+            Call this after the last command using the current region was issued.
+            Blocks only if the GPU is still reading the next region.
+        '''
+
+        self.mglo.next_frame()
+
+    def release(self) -> None:
+        '''
+            Release the ModernGL object and the underlying buffer.
+        '''
+
+        LOG.debug(f"{self.__class__.__name__}.release() {self}")
+        if not isinstance(self.mglo, InvalidObject):
+            self.mglo.release()
+            self._buffer.release()
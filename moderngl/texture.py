@@ -325,6 +325,28 @@ class Texture:
 
         return self.mglo.read(level, alignment)
 
+    def read_array(self, *, level=0, channels=None, flip=False) -> memoryview:
+        '''
+            Read the pixel data as a typed memoryview.
+
+            The memoryview has the shape ``(height, width, channels)`` and the format
+            of the texture's ``dtype``, so ``numpy.asarray()`` wraps it without copies.
+            The flip and the channel drop run in native code without the GIL.
+
+            Keyword Args:
+                level (int): The mipmap level.
+                channels (int): The number of components to keep. By default all of them.
+                flip (bool): Reverse the order of the rows.
+
+            Returns:
+                memoryview
+        '''
+
+        if channels is None:
+            channels = self.components
+
+        return memoryview(self.mglo.read_array(level, channels, flip))
+
     def read_into(self, buffer, *, level=0, alignment=1, write_offset=0) -> None:
         '''
             Read the content of the texture into a bytearray or :py:class:`~moderngl.Buffer`.
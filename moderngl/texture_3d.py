@@ -255,7 +255,7 @@ class Texture3D:
 
         return self.mglo.read_into(buffer, alignment, write_offset)
 
-    def write(self, data, viewport=None, *, alignment=1) -> None:
+    def write(self, data, viewport=None, *, level=0, alignment=1) -> None:
         '''
             Update the content of the texture from byte data
             or a moderngl :py:class:`~moderngl.Buffer`::
@@ -275,13 +275,14 @@ class Texture3D:
                 viewport (tuple): The viewport.
 
             Keyword Args:
+                level (int): The mipmap level.
                 alignment (int): The byte alignment of the pixels.
         '''
 
         if type(data) is Buffer:
             data = data.mglo
 
-        self.mglo.write(data, viewport, alignment)
+        self.mglo.write(data, viewport, level, alignment)
 
     def build_mipmaps(self, base=0, max_level=1000) -> None:
         '''
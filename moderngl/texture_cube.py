@@ -200,7 +200,7 @@ class TextureCube:
 
         return self.mglo.read_into(buffer, face, alignment, write_offset)
 
-    def write(self, face, data, viewport=None, *, alignment=1) -> None:
+    def write(self, face, data, viewport=None, *, level=0, alignment=1) -> None:
         '''
             Update the content of the texture.
 
@@ -223,13 +223,14 @@ class TextureCube:
                 viewport (tuple): The viewport.
 
             Keyword Args:
+                level (int): The mipmap level.
                 alignment (int): The byte alignment of the pixels.
         '''
 
         if type(data) is Buffer:
             data = data.mglo
 
-        self.mglo.write(face, data, viewport, alignment)
+        self.mglo.write(face, data, viewport, level, alignment)
 
     def use(self, location=0) -> None:
         '''
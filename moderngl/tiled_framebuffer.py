@@ -0,0 +1,166 @@
+import logging
+
+from moderngl.mgl import InvalidObject  # type: ignore
+
+__all__ = ['TiledFramebuffer']
+
+LOG = logging.getLogger(__name__)
+
+
+class TiledFramebuffer:
+    '''
+        Renders images larger than the framebuffer size limits in tiles.
+
+        A single tile sized :py:class:`Framebuffer` is reused for every tile.
+        The readback of each tile goes through one of two pixel pack buffers,
+        so the rows of a tile are copied to the output while the GPU renders
+        the next tile. The output can be any writable contiguous buffer,
+        for example a ``numpy.memmap``.
+
+        A TiledFramebuffer object cannot be instantiated directly, it requires a context.
+        Use :py:meth:`Context.tiled_framebuffer` to create one.
+    '''
+
+    __slots__ = ['mglo', '_framebuffer', '_size', '_components', '_dtype', 'ctx', 'extra']
+
+    def __init__(self):
+        self.mglo = None  #: Internal representation for debug purposes only.
+        self._framebuffer = None
+        self._size = None
+        self._components = None
+        self._dtype = None
+        self.ctx = None  #: The context this object belongs to
+        self.extra = None  #: Any - Attribute for storing user defined objects
+        raise TypeError()
+
+    def __repr__(self):
+        return '<TiledFramebuffer: %d x %d>' % self._size
+
+    def __hash__(self) -> int:
+        return id(self)
+
+    def __del__(self):
+        LOG.debug(f"{self.__class__.__name__}.__del__ {self}")
+        if hasattr(self, "ctx") and self.ctx.gc_mode == "auto":
+            self.release()
+
+    @property
+    def framebuffer(self) -> 'Framebuffer':
+        '''
+            Framebuffer: The tile sized framebuffer the callback renders to.
+        '''
+
+        return self._framebuffer
+
+    @property
+    def size(self) -> tuple:
+        '''
+            tuple: The size of the whole image.
+        '''
+
+        return self._size
+
+    @property
+    def tile_size(self) -> tuple:
+        '''
+            tuple: The size of a single tile.
+        '''
+
+        return self._framebuffer.size
+
+    @property
+    def components(self) -> int:
+        '''
+            int: The number of components per pixel.
+        '''
+
+        return self._components
+
+    @property
+    def dtype(self) -> str:
+        '''
+            str: Data type.
+        '''
+
+        return self._dtype
+
+    @property
+    def tiles(self) -> list:
+        '''
+            list: The viewports of the tiles in rendering order, row by row from the bottom.
+        '''
+
+        width, height = self._size
+        tile_width, tile_height = self._framebuffer.size
+        return [
+            (x, y, min(tile_width, width - x), min(tile_height, height - y))
+            for y in range(0, height, tile_height)
+            for x in range(0, width, tile_width)
+        ]
+
+    def tile_matrix(self, viewport) -> tuple:
+        '''
+            The matrix mapping the whole image to a tile.
+
+            Multiply the projection matrix with it from the left to render
+            only the part of the scene covered by the tile.
+
+            Args:
+                viewport (tuple): The viewport of the tile.
+
+            Returns:
+                tuple: A column major 4x4 matrix.
+        '''
+
+        width, height = self._size
+        x, y, w, h = viewport
+        return (
+            width / w, 0.0, 0.0, 0.0,
+            0.0, height / h, 0.0, 0.0,
+            0.0, 0.0, 1.0, 0.0,
+            (width - 2 * x - w) / w, (height - 2 * y - h) / h, 0.0, 1.0,
+        )
+
+    def render(self, callback, output, *, flip=False) -> None:
+        '''
+            Render every tile and stitch them into the output.
+
+            The tile framebuffer is bound with a viewport covering the tile
+            before each call of the callback. The callback receives the viewport
+            of the tile in the whole image.
+            The previously bound framebuffer is bound again at the end.
+
+            Args:
+                callback (callable): Renders a single tile.
+                output (buffer): A writable contiguous buffer of the size of the whole image.
+
+            Keyword Args:
+                flip (bool): Store the rows from the top.
+        '''
+
+        def render_tile(viewport):
+            self._framebuffer.use()
+            self._framebuffer.viewport = (0, 0, viewport[2], viewport[3])
+            callback(viewport)
+
+        previous = self.ctx.fbo
+
+        try:
+            self.mglo.render(render_tile, output, flip)
+        finally:
+            if previous is not None:
+                previous.use()
+
+    def release(self) -> None:
+        '''
+            Release the ModernGL object and the tile framebuffer.
+        '''
+
+        LOG.debug(f"{self.__class__.__name__}.release() {self}")
+        if not isinstance(self.mglo, InvalidObject):
+            self.mglo.release()
+            for attachment in self._framebuffer.color_attachments:
+                attachment.release()
+            if self._framebuffer.depth_attachment is not None:
+                self._framebuffer.depth_attachment.release()
+            self._framebuffer.release()
@@ -0,0 +1,124 @@
+import logging
+
+from moderngl.mgl import InvalidObject  # type: ignore
+
+__all__ = ['UploadQueue']
+
+LOG = logging.getLogger(__name__)
+
+
+class UploadQueue:
+    '''
+        An asynchronous texture upload queue staging pixel data in a
+        persistently mapped pixel unpack buffer.
+
+        :py:meth:`UploadQueue.write` reserves space in the current slot and returns
+        immediately. A worker thread copies the data into the staging buffer without
+        holding the GIL. :py:meth:`UploadQueue.flush` waits for the copies, issues the
+        ``glTexSubImage2D`` / ``glTexSubImage3D`` calls from the staging offsets, puts a
+        fence after them and moves to the next slot, waiting only if the GPU is still
+        reading it.
+
+        The written data must not be modified until the queue is flushed.
+        The staging buffer is owned by the queue and released with it.
+        Persistent buffers require OpenGL 4.4 or ``GL_ARB_buffer_storage``.
+
+        An UploadQueue object cannot be instantiated directly, it requires a context.
+        Use :py:meth:`Context.upload_queue` to create one.
+    '''
+
+    __slots__ = ['mglo', '_buffer', '_slots', 'ctx', 'extra']
+
+    def __init__(self):
+        self.mglo = None  #: Internal representation for debug purposes only.
+        self._buffer = None
+        self._slots = None
+        self.ctx = None  #: The context this object belongs to
+        self.extra = None  #: Any - Attribute for storing user defined objects
+        raise TypeError()
+
+    def __repr__(self):
+        return '<UploadQueue: %d x %d>' % (self._slots, self.slot_size)
+
+    def __hash__(self) -> int:
+        return id(self)
+
+    def __del__(self):
+        LOG.debug(f"{self.__class__.__name__}.__del__ {self}")
+        if hasattr(self, "ctx") and self.ctx.gc_mode == "auto":
+            self.release()
+
+    @property
+    def slots(self) -> int:
+        '''
+            int: The number of slots.
+        '''
+
+        return self._slots
+
+    @property
+    def slot(self) -> int:
+        '''
+            int: The index of the current slot.
+        '''
+
+        return self.mglo.slot
+
+    @property
+    def slot_size(self) -> int:
+        '''
+            int: The size of a single slot in bytes.
+        '''
+
+        return self.mglo.slot_size
+
+    @property
+    def free(self) -> int:
+        '''
+            int: The number of bytes left in the current slot.
+        '''
+
+        return self.mglo.free
+
+    @property
+    def pending(self) -> int:
+        '''
+            int: The number of uploads waiting for :py:meth:`UploadQueue.flush`.
+        '''
+
+        return self.mglo.pending
+
+    def write(self, texture, data, viewport=None, *, level=0, alignment=1) -> None:
+        '''
+            Queue an update of a :py:class:`Texture`, :py:class:`Texture3D`
+            or :py:class:`TextureArray`.
+
+            Args:
+                texture: The texture.
+                data (bytes): The pixel data. It must not be modified until the queue is flushed.
+                viewport (tuple): The viewport, ``(width, height)`` or ``(x, y, width, height)``
+                                  for 2D textures and the 3D equivalents for the others.
+
+            Keyword Args:
+                level (int): The mipmap level.
+                alignment (int): The byte alignment of the pixels.
+        '''
+
+        self.mglo.write(texture.mglo, data, viewport, level, alignment)
+
+    def flush(self) -> None:
+        '''
+            Issue the queued uploads, fence the current slot and move to the next one.
+            Must be called from the thread owning the context.
+        '''
+
+        self.mglo.flush()
+
+    def release(self) -> None:
+        '''
+            Release the ModernGL object and the staging buffer.
+        '''
+
+        LOG.debug(f"{self.__class__.__name__}.release() {self}")
+        if not isinstance(self.mglo, InvalidObject):
+            self.mglo.release()
@@ -1,4 +1,5 @@
 import logging
+from array import array
 from moderngl.buffer import LOG
 from typing import Tuple, TYPE_CHECKING
 
@@ -239,6 +240,51 @@ class VertexArray:
         else:
             self.mglo.render_indirect(buffer.mglo, mode, count, first)
 
+    def render_multi(self, firsts, counts, instances=None, base_vertices=None, *, mode=None) -> None:
+        '''
+            Render multiple ranges of the vertex array with a single call.
+
+            The draw parameters are 32-bit integers. Numpy arrays, bytes and
+            other buffer protocol objects are used without copies, lists and
+            tuples are converted. Without an index buffer ``firsts`` are vertex
+            offsets, with an index buffer they are offsets in the index buffer.
+
+            The draws are issued with ``glMultiDrawArrays`` or
+            ``glMultiDrawElementsBaseVertex``. Instanced draws have no multi-draw
+            equivalent and are issued one by one from C.
+
+            Args:
+                firsts: The first vertex or index of each draw.
+                counts: The number of vertices or indices of each draw.
+                instances: The number of instances as an int or per draw.
+                base_vertices: Constant added to the indices of each draw.
+                    Requires an index buffer.
+
+            Keyword Args:
+                mode (int): By default the mode of the vertex array will be used.
+        '''
+
+        if mode is None:
+            mode = self._mode
+
+        if isinstance(firsts, (list, tuple)):
+            firsts = array('i', firsts)
+
+        if isinstance(counts, (list, tuple)):
+            counts = array('i', counts)
+
+        if isinstance(instances, (list, tuple)):
+            instances = array('i', instances)
+
+        if isinstance(base_vertices, (list, tuple)):
+            base_vertices = array('i', base_vertices)
+
+        if self.scope:
+            with self.scope:
+                self.mglo.render_multi(mode, firsts, counts, instances, base_vertices)
+        else:
+            self.mglo.render_multi(mode, firsts, counts, instances, base_vertices)
+
     def transform(self, buffer, mode=None, vertices=-1, *, first=0, instances=-1, buffer_offset=0) -> None:
         '''
             Transform vertices.
@@ -86,6 +86,8 @@ mgl = Extension(
         'moderngl/src/Attribute.cpp',
         'moderngl/src/Buffer.cpp',
         'moderngl/src/BufferFormat.cpp',
+        'moderngl/src/BufferView.cpp',
+        'moderngl/src/CommandList.cpp',
         'moderngl/src/ComputeShader.cpp',
         'moderngl/src/Context.cpp',
         'moderngl/src/DataType.cpp',
@@ -93,18 +95,24 @@ mgl = Extension(
         'moderngl/src/Framebuffer.cpp',
         'moderngl/src/InvalidObject.cpp',
         'moderngl/src/ModernGL.cpp',
+        'moderngl/src/Pixels.cpp',
         'moderngl/src/Program.cpp',
         'moderngl/src/Query.cpp',
+        'moderngl/src/QueryPool.cpp',
+        'moderngl/src/Readback.cpp',
         'moderngl/src/Renderbuffer.cpp',
         'moderngl/src/Scope.cpp',
+        'moderngl/src/StreamBuffer.cpp',
         'moderngl/src/Texture.cpp',
         'moderngl/src/Texture3D.cpp',
         'moderngl/src/TextureArray.cpp',
         'moderngl/src/TextureCube.cpp',
+        'moderngl/src/TiledFramebuffer.cpp',
         'moderngl/src/Uniform.cpp',
         'moderngl/src/UniformBlock.cpp',
         'moderngl/src/UniformGetters.cpp',
         'moderngl/src/UniformSetters.cpp',
+        'moderngl/src/UploadQueue.cpp',
         'moderngl/src/VertexArray.cpp',
     ],
     depends=[
@@ -21,6 +21,15 @@ class TestBuffer(unittest.TestCase):
         buf.clear(offset=1, size=18, chunk=b'AB')
         self.assertEqual(buf.read(), b'\xAAABABABABABABABABAB\x55')
 
+    def test_buffer_clear_3(self):
+        buf = self.ctx.buffer(data=b'\xAA' * 200000)
+        buf.clear(offset=4, size=199992, chunk=b'0123456789AB')
+        self.assertEqual(buf.read(), b'\xAA' * 4 + b'0123456789AB' * 16666 + b'\xAA' * 4)
+        buf.clear(offset=5, size=199995, chunk=b'xyz')
+        self.assertEqual(buf.read(), b'\xAA' * 4 + b'0' + b'xyz' * 66665)
+        buf.clear(size=100)
+        self.assertEqual(buf.read(102), b'\x00' * 100 + b'zx')
+
     def test_buffer_create(self):
         buf = self.ctx.buffer(data=b'\xAA\x55' * 10)
         self.assertEqual(buf.read(), b'\xAA\x55' * 10)
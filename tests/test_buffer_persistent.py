@@ -0,0 +1,52 @@
+import struct
+import unittest
+
+from common import get_context
+
+
+class TestCase(unittest.TestCase):
+
+    @classmethod
+    def setUpClass(cls):
+        cls.ctx = get_context()
+        if cls.ctx.version_code < 440:
+            raise unittest.SkipTest('OpenGL 4.4 is not supported')
+
+    def test_persistent_mapping(self):
+        buf = self.ctx.buffer(reserve=16, persistent=True)
+        self.assertTrue(buf.persistent)
+        buf.mapping[4:8] = struct.pack('f', 1.0)
+        self.assertEqual(buf.read(4, offset=4), struct.pack('f', 1.0))
+        buf.write(b'abcd', offset=8)
+        self.assertEqual(bytes(buf.mapping[8:12]), b'abcd')
+        buf.release()
+
+    def test_persistent_release_exported(self):
+        buf = self.ctx.buffer(reserve=16, persistent=True)
+        view = buf.mapping[0:4]
+
+        with self.assertRaises(BufferError):
+            buf.release()
+
+        view.release()
+        buf.release()
+
+    def test_persistent_clear_offset(self):
+        buf = self.ctx.buffer(b'\xff' * 16, persistent=True)
+        buf.clear(4, offset=8)
+        self.assertEqual(buf.read(), b'\xff' * 8 + b'\x00' * 4 + b'\xff' * 4)
+
+    def test_persistent_orphan(self):
+        buf = self.ctx.buffer(reserve=16, persistent=True)
+        with self.assertRaises(Exception):
+            buf.orphan()
+
+    def test_mapping_not_persistent(self):
+        buf = self.ctx.buffer(reserve=16)
+        self.assertFalse(buf.persistent)
+        with self.assertRaises(ValueError):
+            buf.mapping
+
+
+if __name__ == '__main__':
+    unittest.main()
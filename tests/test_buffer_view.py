@@ -0,0 +1,130 @@
+import struct
+import unittest
+
+import moderngl
+import numpy as np
+
+from common import get_context
+
+
+class TestCase(unittest.TestCase):
+
+    @classmethod
+    def setUpClass(cls):
+        cls.ctx = get_context()
+
+    def test_read_typed(self):
+        buf = self.ctx.buffer(np.arange(12, dtype='f4').tobytes())
+
+        with buf.view(dtype='f4', shape=(4, 3)) as mem:
+            self.assertEqual(mem.format, 'f')
+            self.assertEqual(mem.shape, (4, 3))
+            self.assertEqual(mem.strides, (12, 4))
+            self.assertTrue(mem.readonly)
+            np.testing.assert_array_equal(np.asarray(mem), np.arange(12, dtype='f4').reshape(4, 3))
+
+    def test_range(self):
+        buf = self.ctx.buffer(np.arange(16, dtype='i4').tobytes())
+
+        with buf.view(8, 16, dtype='i4') as mem:
+            self.assertEqual(mem.tolist(), [2, 3, 4, 5])
+
+    def test_write(self):
+        buf = self.ctx.buffer(reserve=32)
+
+        with buf.view(dtype='f4', shape=(-1, 2), access='w', invalidate=True) as mem:
+            self.assertEqual(mem.shape, (4, 2))
+            np.asarray(mem)[:] = [[1, 2], [3, 4], [5, 6], [7, 8]]
+
+        self.assertEqual(buf.read(), struct.pack('8f', 1, 2, 3, 4, 5, 6, 7, 8))
+
+    def test_nested(self):
+        buf = self.ctx.buffer(bytes(range(64)))
+
+        with buf.view(access='rw') as outer:
+            with buf.view(16, 16) as inner:
+                self.assertEqual(inner.tobytes(), bytes(range(16, 32)))
+                outer[16] = 255
+                self.assertEqual(inner[0], 255)
+
+            self.assertEqual(outer[17], 17)
+
+            with self.assertRaises(BufferError):
+                buf.view(access='w', invalidate=True)
+
+        self.assertEqual(buf.read(1, offset=16), b'\xff')
+
+    def test_use_mapped(self):
+        buf = self.ctx.buffer(reserve=24)
+        prog = self.ctx.program(
+            vertex_shader='''
+                #version 330
+                in vec2 in_vert;
+                void main() {
+                    gl_Position = vec4(in_vert, 0.0, 1.0);
+                }
+            ''',
+        )
+        vao = self.ctx.simple_vertex_array(prog, buf, 'in_vert')
+
+        with buf.view():
+            with self.assertRaises(moderngl.Error):
+                buf.write(b'abcd')
+
+            with self.assertRaises(moderngl.Error):
+                buf.read()
+
+            with self.assertRaises(moderngl.Error):
+                vao.render(moderngl.POINTS)
+
+        buf.write(b'abcd')
+        self.assertEqual(buf.read(4), b'abcd')
+
+    def test_release_mapped(self):
+        buf = self.ctx.buffer(reserve=16)
+
+        with buf.view() as mem:
+            with self.assertRaises(BufferError):
+                buf.release()
+
+            first = memoryview(buf)
+
+        with self.assertRaises(BufferError):
+            buf.release()
+
+        first.release()
+        buf.release()
+
+    def test_memoryview_of_buffer(self):
+        buf = self.ctx.buffer(b'abcd')
+
+        first = memoryview(buf)
+        second = memoryview(buf)
+        self.assertEqual(first.tobytes(), second.tobytes())
+        first.release()
+        self.assertEqual(second.tobytes(), b'abcd')
+        second.release()
+
+        self.assertEqual(buf.read(), b'abcd')
+
+    def test_invalid(self):
+        buf = self.ctx.buffer(reserve=16)
+
+        with self.assertRaises(TypeError):
+            buf.view(dtype='f4', shape=(2, 'x'))
+
+        with self.assertRaises(Exception):
+            buf.view(dtype='f4', shape=(5,))
+
+        with self.assertRaises(Exception):
+            buf.view(8, 16)
+
+        with self.assertRaises(Exception):
+            buf.view(access='r', invalidate=True)
+
+        with self.assertRaises(Exception):
+            buf.view(dtype='x4')
+
+
+if __name__ == '__main__':
+    unittest.main()
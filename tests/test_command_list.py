@@ -0,0 +1,85 @@
+import struct
+import unittest
+
+import moderngl
+from common import get_context
+
+
+class TestCase(unittest.TestCase):
+
+    @classmethod
+    def setUpClass(cls):
+        cls.ctx = get_context()
+        cls.prog = cls.ctx.program(
+            vertex_shader='''
+                #version 330
+                in vec2 in_vert;
+                void main() {
+                    gl_Position = vec4(in_vert, 0.0, 1.0);
+                }
+            ''',
+            fragment_shader='''
+                #version 330
+                uniform vec4 color;
+                out vec4 f_color;
+                void main() {
+                    f_color = color;
+                }
+            ''',
+        )
+        cls.vbo = cls.ctx.buffer(struct.pack('6f', -1.0, -1.0, 3.0, -1.0, -1.0, 3.0))
+        cls.vao = cls.ctx.simple_vertex_array(cls.prog, cls.vbo, 'in_vert')
+
+    def test_execute_and_patch(self):
+        fbo = self.ctx.simple_framebuffer((4, 4))
+
+        commands = self.ctx.command_list()
+        commands.use_framebuffer(fbo)
+        commands.enable_only(moderngl.NOTHING)
+        color = commands.uniform(self.prog['color'], struct.pack('4f', 1.0, 0.0, 0.0, 1.0))
+        commands.render(self.vao)
+        self.assertEqual(commands.size, 4)
+
+        self.ctx.simple_framebuffer((4, 4)).use()
+        commands.execute()
+        self.assertEqual(fbo.read((1, 1)), b'\xff\x00\x00')
+
+        commands.write_uniform(color, struct.pack('4f', 0.0, 0.0, 1.0, 1.0))
+        commands.execute()
+        self.assertEqual(fbo.read((1, 1)), b'\x00\x00\xff')
+
+        with self.assertRaises(moderngl.Error):
+            commands.write_uniform(color, b'\x00' * 4)
+
+        with self.assertRaises(moderngl.Error):
+            commands.set_offset(color, 0)
+
+        commands.clear()
+        self.assertEqual(commands.size, 0)
+        commands.release()
+
+    def test_buffer_offset(self):
+        ubo = self.ctx.buffer(reserve=512)
+        commands = self.ctx.command_list()
+        binding = commands.bind_uniform_buffer(ubo, 0, offset=0, size=256)
+        commands.set_offset(binding, 256)
+
+        with self.assertRaises(moderngl.Error):
+            commands.set_offset(binding, 300)
+
+        commands.execute()
+
+    def test_released_object(self):
+        vbo = self.ctx.buffer(struct.pack('6f', -1.0, -1.0, 3.0, -1.0, -1.0, 3.0))
+        vao = self.ctx.simple_vertex_array(self.prog, vbo, 'in_vert')
+
+        commands = self.ctx.command_list()
+        commands.render(vao)
+        vao.release()
+
+        with self.assertRaises(moderngl.Error):
+            commands.execute()
+
+
+if __name__ == '__main__':
+    unittest.main()
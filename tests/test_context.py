@@ -12,6 +12,18 @@ class ContextTests(TestCase):
             ctx = moderngl.create_context(standalone=True)
             ctx.release()
 
+    def test_native_loader(self):
+        """Both loaders resolve a working context"""
+        ctx = moderngl.create_context(standalone=True, native_loader=False)
+        self.assertFalse(ctx.native_loader)
+        reference = ctx.info['GL_RENDERER']
+        ctx.release()
+
+        ctx = moderngl.create_context(standalone=True)
+        self.assertIsInstance(ctx.native_loader, bool)
+        self.assertEqual(ctx.info['GL_RENDERER'], reference)
+        ctx.release()
+
     def test_context_switch(self):
         """Ensure context switching is working"""
         ctx1 = moderngl.create_context(standalone=True)
@@ -63,6 +63,27 @@ class TestCase(unittest.TestCase):
     def test_buffer_docs(self):
         self.validate_cls('buffer.rst', 'Buffer', [])
 
+    def test_stream_buffer_docs(self):
+        self.validate_cls('stream_buffer.rst', 'StreamBuffer', [])
+
+    def test_upload_queue_docs(self):
+        self.validate_cls('upload_queue.rst', 'UploadQueue', [])
+
+    def test_tiled_framebuffer_docs(self):
+        self.validate_cls('tiled_framebuffer.rst', 'TiledFramebuffer', [])
+
+    def test_program_cache_docs(self):
+        self.validate_cls('program_cache.rst', 'ProgramCache', [])
+
+    def test_profiler_docs(self):
+        self.validate_cls('profiler.rst', 'Profiler', [])
+
+    def test_query_pool_docs(self):
+        self.validate_cls('query_pool.rst', 'QueryPool', [])
+
+    def test_command_list_docs(self):
+        self.validate_cls('command_list.rst', 'CommandList', [])
+
     def test_texture_docs(self):
         self.validate_cls('texture.rst', 'Texture', [])
 
@@ -84,6 +105,9 @@ class TestCase(unittest.TestCase):
     def test_query_docs(self):
         self.validate_cls('query.rst', 'Query', [])
 
+    def test_readback_docs(self):
+        self.validate_cls('readback.rst', 'Readback', [])
+
     def test_scope_docs(self):
         self.validate_cls('scope.rst', 'Scope', [], include=['__enter__', '__exit__'])
 
@@ -0,0 +1,46 @@
+import unittest
+
+from common import get_context
+
+
+class TestCase(unittest.TestCase):
+
+    @classmethod
+    def setUpClass(cls):
+        cls.ctx = get_context()
+
+    def test_read_async(self):
+        fbo = self.ctx.simple_framebuffer((4, 4))
+        fbo.clear(1.0, 0.0, 0.0, 1.0)
+
+        handle = fbo.read_async(components=4)
+        self.assertEqual(handle.size, 64)
+        handle.wait()
+        self.assertTrue(handle.ready())
+        self.assertEqual(bytes(handle.data), b'\xff\x00\x00\xff' * 16)
+        self.assertEqual(bytes(handle.data), fbo.read(components=4))
+
+    def test_read_async_ring(self):
+        fbo = self.ctx.simple_framebuffer((2, 2))
+        handles = [fbo.read_async() for _ in range(fbo.READBACK_RING_SIZE + 1)]
+        self.assertIs(handles[0], handles[-1])
+        fbo.release()
+
+    def test_read_async_exported(self):
+        fbo = self.ctx.simple_framebuffer((2, 2))
+        handle = fbo.read_async()
+        view = handle.data
+
+        with self.assertRaises(BufferError):
+            handle.mglo.read(fbo.mglo, None, 3, 0, 1, 'f1')
+
+        with self.assertRaises(BufferError):
+            handle.release()
+
+        view.release()
+        handle.release()
+        fbo.release()
+
+
+if __name__ == '__main__':
+    unittest.main()
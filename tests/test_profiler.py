@@ -0,0 +1,81 @@
+import json
+import os
+import tempfile
+import unittest
+
+from common import get_context
+
+
+class TestCase(unittest.TestCase):
+
+    @classmethod
+    def setUpClass(cls):
+        cls.ctx = get_context()
+
+        if cls.ctx.version_code < 330:
+            raise unittest.SkipTest('timer queries require OpenGL 3.3')
+
+    def setUp(self):
+        self.ctx.profiler.reset()
+
+    def test_regions_are_resolved_later(self):
+        profiler = self.ctx.profiler
+
+        with self.ctx.profile('clear'):
+            self.ctx.clear()
+
+        self.assertEqual(profiler.pending, 1)
+        profiler.next_frame()
+        self.assertEqual(profiler.pending, 1)
+        self.assertEqual(profiler.stats(), {})
+
+        self.ctx.finish()
+
+        for _ in range(3):
+            profiler.next_frame()
+
+        self.assertEqual(profiler.pending, 0)
+        stats = profiler.stats()['clear']
+        self.assertEqual(stats['count'], 1)
+
+        for clock in ('cpu', 'gpu'):
+            self.assertGreaterEqual(stats[clock]['min'], 0.0)
+            self.assertLessEqual(stats[clock]['min'], stats[clock]['mean'])
+            self.assertLessEqual(stats[clock]['mean'], stats[clock]['p95'])
+
+    def test_nested_regions_and_scope(self):
+        scope = self.ctx.scope(self.ctx.simple_framebuffer((4, 4)))
+
+        with self.ctx.profile('outer'):
+            with self.ctx.profile('inner', scope):
+                self.ctx.clear()
+
+        self.ctx.finish()
+
+        for _ in range(3):
+            self.ctx.profiler.next_frame()
+
+        self.assertEqual(set(self.ctx.profiler.stats()), {'outer', 'inner'})
+
+    def test_chrome_trace(self):
+        with self.ctx.profile('pass'):
+            self.ctx.clear()
+
+        self.ctx.finish()
+
+        for _ in range(3):
+            self.ctx.profiler.next_frame()
+
+        with tempfile.TemporaryDirectory() as path:
+            filename = os.path.join(path, 'trace.json')
+            self.ctx.profiler.export_chrome_trace(filename)
+
+            with open(filename) as f:
+                events = json.load(f)['traceEvents']
+
+        self.assertEqual(sorted(e['tid'] for e in events), ['CPU', 'GPU'])
+        self.assertTrue(all(e['name'] == 'pass' and e['ph'] == 'X' for e in events))
+
+
+if __name__ == '__main__':
+    unittest.main()
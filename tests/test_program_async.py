@@ -0,0 +1,84 @@
+import unittest
+
+import moderngl
+from common import get_context
+
+
+class TestCase(unittest.TestCase):
+
+    @classmethod
+    def setUpClass(cls):
+        cls.ctx = get_context()
+
+    def make_program(self, value):
+        return self.ctx.program_async(
+            vertex_shader='''
+                #version 330
+                in vec2 in_vert;
+                uniform float scale;
+                void main() {
+                    gl_Position = vec4(in_vert * scale * %s, 0.0, 1.0);
+                }
+            ''' % value,
+            fragment_shader='''
+                #version 330
+                out vec4 color;
+                void main() {
+                    color = vec4(1.0);
+                }
+            ''',
+        )
+
+    def test_batch(self):
+        programs = [self.make_program('%d.0' % (i + 1)) for i in range(8)]
+
+        for prog in programs:
+            self.assertIsInstance(prog.ready, bool)
+            self.assertIn('scale', prog)
+            self.assertTrue(prog.ready)
+            prog['scale'] = 2.0
+
+    def test_vertex_array_resolves(self):
+        prog = self.make_program('1.0')
+        vbo = self.ctx.buffer(reserve=24)
+        vao = self.ctx.simple_vertex_array(prog, vbo, 'in_vert')
+        vao.render()
+
+    def test_compile_error(self):
+        prog = self.ctx.program_async(vertex_shader='#version 330\nvoid main() { error }')
+
+        with self.assertRaises(moderngl.Error):
+            prog['scale']
+
+        with self.assertRaises(moderngl.Error):
+            prog.get('scale', None)
+
+        self.assertTrue(prog.ready)
+        self.assertIsInstance(prog.mglo, moderngl.mgl.InvalidObject)
+        prog.release()
+
+    def test_link_error(self):
+        prog = self.ctx.program_async(
+            vertex_shader='''
+                #version 330
+                out vec4 v_missing;
+                void main() {
+                    gl_Position = vec4(0.0);
+                }
+            ''',
+            fragment_shader='''
+                #version 330
+                in vec3 v_missing;
+                out vec4 color;
+                void main() {
+                    color = vec4(v_missing, 1.0);
+                }
+            ''',
+        )
+
+        with self.assertRaises(moderngl.Error):
+            list(prog)
+
+
+if __name__ == '__main__':
+    unittest.main()
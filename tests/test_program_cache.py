@@ -0,0 +1,82 @@
+import os
+import tempfile
+import unittest
+
+import moderngl
+from common import get_context
+
+
+class TestCase(unittest.TestCase):
+
+    @classmethod
+    def setUpClass(cls):
+        cls.ctx = get_context()
+
+    def setUp(self):
+        self.tempdir = tempfile.TemporaryDirectory()
+        self.cache = moderngl.ProgramCache(self.tempdir.name)
+        self.ctx.program_cache = self.cache
+
+    def tearDown(self):
+        self.ctx.program_cache = None
+        self.tempdir.cleanup()
+
+    def make_program(self, value):
+        return self.ctx.program(
+            vertex_shader='''
+                #version 330
+                in vec2 in_vert;
+                uniform float scale;
+                void main() {
+                    gl_Position = vec4(in_vert * scale * %s, 0.0, 1.0);
+                }
+            ''' % value,
+            fragment_shader='''
+                #version 330
+                out vec4 color;
+                void main() {
+                    color = vec4(1.0);
+                }
+            ''',
+        )
+
+    def test_hit_and_miss(self):
+        prog1 = self.make_program('1.0')
+        prog2 = self.make_program('1.0')
+        prog3 = self.make_program('2.0')
+
+        self.assertIn('scale', prog2)
+        self.assertIn('in_vert', prog2)
+
+        if self.cache.misses == 3:
+            self.skipTest('program binaries are not supported by the driver')
+
+        self.assertEqual(self.cache.hits, 1)
+        self.assertEqual(self.cache.misses, 2)
+        self.assertEqual(len(os.listdir(self.tempdir.name)), 2)
+
+    def test_rejected_binary(self):
+        self.make_program('1.0')
+
+        for name in os.listdir(self.tempdir.name):
+            with open(os.path.join(self.tempdir.name, name), 'wb') as f:
+                f.write(b'\0' * 64)
+
+        prog = self.make_program('1.0')
+        self.assertIn('scale', prog)
+        self.assertEqual(self.cache.hits, 0)
+
+    def test_key(self):
+        key1 = self.cache.key(self.ctx, ('a', None), ())
+        key2 = self.cache.key(self.ctx, ('a', None), ('out',))
+        key3 = self.cache.key(self.ctx, (None, 'a'), ())
+        self.assertEqual(len({key1, key2, key3}), 3)
+
+    def test_clear(self):
+        self.make_program('1.0')
+        self.cache.clear()
+        self.assertEqual(os.listdir(self.tempdir.name), [])
+
+
+if __name__ == '__main__':
+    unittest.main()
@@ -0,0 +1,66 @@
+import unittest
+
+from common import get_context
+
+
+class TestCase(unittest.TestCase):
+
+    @classmethod
+    def setUpClass(cls):
+        cls.ctx = get_context()
+
+        if cls.ctx.version_code < 330:
+            raise unittest.SkipTest('timer queries require OpenGL 3.3')
+
+    def test_timestamps(self):
+        pool = self.ctx.query_pool(4)
+        start = pool.timestamp()
+        self.ctx.clear()
+        end = pool.timestamp()
+        self.assertEqual(pool.free, 2)
+
+        self.assertGreaterEqual(pool.result(end) - pool.result(start), 0)
+        self.assertEqual(pool.free, 4)
+        pool.release()
+
+    def test_elapsed_is_not_truncated(self):
+        pool = self.ctx.query_pool()
+        query = pool.begin('elapsed')
+        self.ctx.clear()
+        pool.end(query)
+
+        self.ctx.finish()
+        self.assertTrue(pool.available(query))
+        self.assertGreaterEqual(pool.result(query, wait=False), 0)
+        pool.release()
+
+    def test_recycle_and_grow(self):
+        pool = self.ctx.query_pool(2)
+        queries = [pool.timestamp() for _ in range(5)]
+        self.assertEqual(len(set(queries)), 5)
+        self.assertGreaterEqual(pool.size, 5)
+
+        for query in queries:
+            pool.discard(query)
+
+        self.assertEqual(pool.free, pool.size)
+        self.assertIn(pool.timestamp(), queries)
+        pool.release()
+
+    def test_invalid_query(self):
+        pool = self.ctx.query_pool(2)
+
+        with self.assertRaises(Exception):
+            pool.result(0)
+
+        with self.assertRaises(Exception):
+            pool.end(pool.timestamp())
+
+        with self.assertRaises(Exception):
+            pool.begin('unknown')
+
+        pool.release()
+
+
+if __name__ == '__main__':
+    unittest.main()
@@ -0,0 +1,62 @@
+import unittest
+
+import numpy as np
+
+from common import get_context
+
+
+class TestCase(unittest.TestCase):
+
+    @classmethod
+    def setUpClass(cls):
+        cls.ctx = get_context()
+
+    def test_texture_shape_and_dtype(self):
+        pixels = np.arange(3 * 4 * 4, dtype='f4').reshape(3, 4, 4)
+        texture = self.ctx.texture((4, 3), 4, pixels.tobytes(), dtype='f4')
+
+        array = np.asarray(texture.read_array())
+        self.assertEqual(array.shape, (3, 4, 4))
+        self.assertEqual(array.dtype, np.float32)
+        np.testing.assert_array_equal(array, pixels)
+
+    def test_texture_flip_and_channels(self):
+        pixels = np.arange(3 * 4 * 4, dtype='u1').reshape(3, 4, 4)
+        texture = self.ctx.texture((4, 3), 4, pixels.tobytes())
+
+        array = np.asarray(texture.read_array(channels=3, flip=True))
+        self.assertEqual(array.shape, (3, 4, 3))
+        np.testing.assert_array_equal(array, pixels[::-1, :, :3])
+
+    def test_texture_half_float(self):
+        pixels = np.linspace(0.0, 1.0, 2 * 2 * 2, dtype='f2').reshape(2, 2, 2)
+        texture = self.ctx.texture((2, 2), 2, pixels.tobytes(), dtype='f2')
+
+        array = np.asarray(texture.read_array(channels=1))
+        self.assertEqual(array.dtype, np.float16)
+        np.testing.assert_array_equal(array, pixels[:, :, :1])
+
+    def test_framebuffer(self):
+        pixels = np.arange(4 * 4 * 4, dtype='u1').reshape(4, 4, 4)
+        texture = self.ctx.texture((4, 4), 4, pixels.tobytes())
+        fbo = self.ctx.framebuffer([texture])
+
+        array = np.asarray(fbo.read_array(components=4, channels=3, flip=True))
+        self.assertEqual(array.shape, (4, 4, 3))
+        np.testing.assert_array_equal(array, pixels[::-1, :, :3])
+
+        array = np.asarray(fbo.read_array((1, 1, 2, 2), 4))
+        np.testing.assert_array_equal(array, pixels[1:3, 1:3])
+
+        array[:] = 0
+        self.assertFalse(array.flags.owndata)
+
+    def test_invalid_channels(self):
+        fbo = self.ctx.simple_framebuffer((4, 4))
+
+        with self.assertRaises(Exception):
+            fbo.read_array(components=3, channels=4)
+
+
+if __name__ == '__main__':
+    unittest.main()
@@ -0,0 +1,59 @@
+import struct
+import unittest
+
+from common import get_context
+
+
+class TestCase(unittest.TestCase):
+
+    @classmethod
+    def setUpClass(cls):
+        cls.ctx = get_context()
+        cls.prog = cls.ctx.program(
+            vertex_shader='''
+                #version 330
+
+                void main() {
+                    vec2 vertex = vec2(gl_VertexID % 2, gl_VertexID / 2) * 4.0 - 1.0;
+                    gl_Position = vec4(vertex, 0.0, 1.0);
+                }
+            ''',
+            fragment_shader='''
+                #version 330
+
+                uniform sampler2D image;
+                uniform Block {
+                    vec4 tint;
+                };
+
+                out vec4 color;
+
+                void main() {
+                    color = texture(image, vec2(0.5)) * tint;
+                }
+            ''',
+        )
+        cls.prog['image'] = 3
+        cls.prog['Block'].binding = 2
+        cls.vao = cls.ctx.vertex_array(cls.prog, [])
+
+    def test_bindings(self):
+        fbo = self.ctx.simple_framebuffer((1, 1))
+        texture = self.ctx.texture((1, 1), 4, b'\xff\x80\x00\xff')
+        sampler = self.ctx.sampler(texture=texture)
+        tint = self.ctx.buffer(struct.pack('4f', 1.0, 1.0, 1.0, 1.0))
+
+        scope = self.ctx.scope(fbo, samplers=[(sampler, 3)], uniform_buffers=[(tint, 2)])
+
+        # unbind everything the scope is expected to bind
+        self.ctx.texture((1, 1), 4).use(3)
+        self.ctx.sampler().use(3)
+
+        with scope:
+            self.vao.render(vertices=3)
+
+        self.assertEqual(fbo.read(components=4), b'\xff\x80\x00\xff')
+
+
+if __name__ == '__main__':
+    unittest.main()
@@ -0,0 +1,98 @@
+import struct
+import unittest
+
+import moderngl
+from common import get_context
+
+
+class TestCase(unittest.TestCase):
+
+    @classmethod
+    def setUpClass(cls):
+        cls.ctx = get_context()
+
+    def make_program(self, color):
+        return self.ctx.program(
+            vertex_shader='''
+                #version 330
+                in vec2 in_vert;
+                void main() {
+                    gl_Position = vec4(in_vert, 0.0, 1.0);
+                }
+            ''',
+            fragment_shader='''
+                #version 330
+                out vec4 color;
+                void main() {
+                    color = vec4(%s);
+                }
+            ''' % color,
+        )
+
+    def test_program_switch(self):
+        vbo = self.ctx.buffer(struct.pack('6f', -1.0, -1.0, 3.0, -1.0, -1.0, 3.0))
+        red = self.make_program('1.0, 0.0, 0.0, 1.0')
+        green = self.make_program('0.0, 1.0, 0.0, 1.0')
+        vao_red = self.ctx.simple_vertex_array(red, vbo, 'in_vert')
+        vao_green = self.ctx.simple_vertex_array(green, vbo, 'in_vert')
+
+        fbo = self.ctx.simple_framebuffer((2, 2))
+        fbo.use()
+
+        for vao, pixel in [(vao_red, b'\xff\x00\x00'), (vao_green, b'\x00\xff\x00'), (vao_red, b'\xff\x00\x00')]:
+            vao.render()
+            self.assertEqual(fbo.read((1, 1)), pixel)
+
+        # Recreated objects may reuse the released names
+        vao_red.release()
+        red.release()
+        red = self.make_program('0.0, 0.0, 1.0, 1.0')
+        vao_red = self.ctx.simple_vertex_array(red, vbo, 'in_vert')
+        vao_red.render()
+        self.assertEqual(fbo.read((1, 1)), b'\x00\x00\xff')
+
+    def drawn(self):
+        vbo = self.ctx.buffer(struct.pack('6f', -1.0, -1.0, 3.0, -1.0, -1.0, 3.0))
+        vao = self.ctx.simple_vertex_array(self.make_program('1.0, 0.0, 0.0, 1.0'), vbo, 'in_vert')
+        fbo = self.ctx.simple_framebuffer((2, 2))
+        fbo.use()
+        fbo.clear()
+        vao.render()
+        return fbo.read((1, 1)) == b'\xff\x00\x00'
+
+    def test_enable_flags(self):
+        self.ctx.enable_only(moderngl.RASTERIZER_DISCARD)
+        self.assertFalse(self.drawn())
+        self.ctx.enable(moderngl.DEPTH_TEST)
+        self.ctx.disable(moderngl.RASTERIZER_DISCARD | moderngl.DEPTH_TEST)
+        self.assertTrue(self.drawn())
+        self.ctx.enable_only(moderngl.RASTERIZER_DISCARD)
+        self.ctx.invalidate_state_cache()
+        self.ctx.enable_only(moderngl.NOTHING)
+        self.assertTrue(self.drawn())
+
+    def test_enable_direct(self):
+        GL_RASTERIZER_DISCARD = 0x8C89
+
+        self.ctx.enable_only(moderngl.NOTHING)
+        self.ctx.enable_direct(GL_RASTERIZER_DISCARD)
+        self.assertFalse(self.drawn())
+        self.ctx.enable_only(moderngl.NOTHING)
+        self.assertTrue(self.drawn())
+
+        self.ctx.enable_only(moderngl.RASTERIZER_DISCARD)
+        self.ctx.disable_direct(GL_RASTERIZER_DISCARD)
+        self.assertTrue(self.drawn())
+        self.ctx.enable_only(moderngl.RASTERIZER_DISCARD)
+        self.assertFalse(self.drawn())
+        self.ctx.enable_only(moderngl.NOTHING)
+
+    def test_state_cache_flag(self):
+        self.assertTrue(self.ctx.state_cache)
+        self.ctx.state_cache = False
+        self.assertFalse(self.ctx.state_cache)
+        self.ctx.state_cache = True
+
+
+if __name__ == '__main__':
+    unittest.main()
@@ -0,0 +1,60 @@
+import struct
+import unittest
+
+from common import get_context
+
+
+class TestCase(unittest.TestCase):
+
+    @classmethod
+    def setUpClass(cls):
+        cls.ctx = get_context()
+        cls.prog = cls.ctx.program(
+            vertex_shader='''
+                #version 330
+
+                in vec2 in_vert;
+                out vec2 v_vert;
+
+                void main() {
+                    v_vert = in_vert;
+                    gl_Position = vec4(0.0, 0.0, 0.0, 1.0);
+                }
+            ''',
+            varyings=['v_vert'],
+        )
+
+    def test_reset(self):
+        self.ctx.buffer(reserve=16).write(b'1234')
+        self.ctx.reset_stats()
+        self.assertEqual(set(self.ctx.stats.values()), {0})
+        self.assertEqual(self.ctx.uniform_uploads, (0, 0))
+
+    def test_transfers(self):
+        buf = self.ctx.buffer(reserve=16)
+        self.ctx.reset_stats()
+        buf.write(b'12345678')
+        buf.read(4)
+        self.assertEqual(self.ctx.stats['bytes_written'], 8)
+        self.assertEqual(self.ctx.stats['bytes_read'], 4)
+
+    def test_draw(self):
+        vbo = self.ctx.buffer(struct.pack('6f', 0.0, 0.0, 1.0, 1.0, 2.0, 2.0))
+        out = self.ctx.buffer(reserve=48)
+        vao = self.ctx.vertex_array(self.prog, [(vbo, '2f', 'in_vert')])
+        self.ctx.reset_stats()
+        vao.transform(out, vertices=3, instances=2)
+        stats = self.ctx.stats
+        self.assertEqual(stats['draw_calls'], 1)
+        self.assertEqual(stats['vertices'], 6)
+        self.assertEqual(stats['instances'], 2)
+
+    def test_snapshot(self):
+        buf = self.ctx.buffer(reserve=4)
+        snapshot = self.ctx.stats
+        buf.write(b'1234')
+        self.assertEqual(self.ctx.stats['bytes_written'], snapshot['bytes_written'] + 4)
+
+
+if __name__ == '__main__':
+    unittest.main()
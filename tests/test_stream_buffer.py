@@ -0,0 +1,49 @@
+import unittest
+
+from common import get_context
+
+
+class TestCase(unittest.TestCase):
+
+    @classmethod
+    def setUpClass(cls):
+        cls.ctx = get_context()
+
+    def test_stream_buffer(self):
+        stream = self.ctx.stream_buffer(16, regions=2)
+        self.assertEqual(stream.buffer.size, 32)
+        self.assertEqual(stream.region, 0)
+
+        self.assertEqual(stream.write(b'abc'), 0)
+        self.assertEqual(stream.write(b'defg', alignment=4), 4)
+        self.assertEqual(stream.free, 8)
+        self.assertEqual(stream.buffer.read(4, offset=4), b'defg')
+
+        with self.assertRaises(Exception):
+            stream.allocate(9)
+
+        stream.next_frame()
+        self.assertEqual(stream.region, 1)
+        self.assertEqual(stream.write(b'hijk'), 16)
+
+        stream.next_frame()
+        self.assertEqual(stream.region, 0)
+        self.assertEqual(stream.allocate(8), 0)
+        stream.release()
+
+    def test_stream_buffer_alignment(self):
+        stream = self.ctx.stream_buffer(10, regions=3)
+
+        for region in range(3):
+            self.assertEqual(stream.region, region)
+            offset = stream.allocate(2, alignment=4)
+            self.assertEqual(offset % 4, 0)
+            self.assertGreaterEqual(offset, region * 10)
+            self.assertLess(offset, region * 10 + 10)
+            stream.next_frame()
+
+        stream.release()
+
+
+if __name__ == '__main__':
+    unittest.main()
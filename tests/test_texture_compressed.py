@@ -0,0 +1,61 @@
+import unittest
+
+from common import get_context
+
+
+def bc4_block(value):
+    # Both endpoints set to the same value, every texel uses the first endpoint
+    return bytes([value, value]) + b'\x00' * 6
+
+
+class TestCase(unittest.TestCase):
+
+    @classmethod
+    def setUpClass(cls):
+        cls.ctx = get_context()
+
+    def test_texture(self):
+        texture = self.ctx.texture((8, 8), 1, bc4_block(200) * 4, dtype='bc4')
+        self.assertEqual(texture.read(), b'\xc8' * 64)
+
+        texture.write(bc4_block(100), (4, 4, 4, 4))
+        data = texture.read()
+        self.assertEqual(data[:4], b'\xc8' * 4)
+        self.assertEqual(data[-4:], b'\x64' * 4)
+
+    def test_block_validation(self):
+        texture = self.ctx.texture((8, 8), 1, dtype='bc4')
+
+        with self.assertRaises(Exception):
+            texture.write(bc4_block(0) * 4 + b'\x00')
+
+        with self.assertRaises(Exception):
+            texture.write(bc4_block(0), (2, 2, 4, 4))
+
+        # partial blocks are allowed at the edge of a level
+        texture = self.ctx.texture((6, 6), 1, bc4_block(0) * 4, dtype='bc4')
+        texture.write(bc4_block(50), (4, 4, 2, 2))
+
+    def test_levels(self):
+        texture = self.ctx.texture((8, 8), 1, bc4_block(10) * 4, dtype='bc4', levels=4)
+        texture.write(bc4_block(20), level=1)
+        texture.write(bc4_block(30), level=3)
+        self.assertEqual(texture.read(level=1), b'\x14' * 16)
+        self.assertEqual(texture.read(level=3), b'\x1e')
+
+    def test_texture_array_and_cube(self):
+        array = self.ctx.texture_array((4, 4, 3), 1, bc4_block(1) * 3, dtype='bc4')
+        array.write(bc4_block(2) * 3)
+        self.assertEqual(array.read(), b'\x02' * 48)
+
+        cube = self.ctx.texture_cube((4, 4), 1, bc4_block(3) * 6, dtype='bc4')
+        cube.write(5, bc4_block(4))
+        self.assertEqual(cube.read(5), b'\x04' * 16)
+
+    def test_invalid_dtype(self):
+        with self.assertRaises(Exception):
+            self.ctx.texture((4, 4), 1, dtype='bc9')
+
+
+if __name__ == '__main__':
+    unittest.main()
@@ -0,0 +1,68 @@
+import unittest
+
+from common import get_context
+
+
+class TestCase(unittest.TestCase):
+
+    @classmethod
+    def setUpClass(cls):
+        cls.ctx = get_context()
+        if cls.ctx.version_code < 420 and 'GL_ARB_texture_storage' not in cls.ctx.extensions:
+            raise unittest.SkipTest('immutable textures are not supported')
+
+    def test_texture_levels(self):
+        texture = self.ctx.texture((8, 8), 1, levels=2)
+        texture.write(b'\x01' * 64)
+        texture.write(b'\x02' * 16, level=1)
+        self.assertEqual(texture.read(level=0), b'\x01' * 64)
+        self.assertEqual(texture.read(level=1), b'\x02' * 16)
+
+        with self.assertRaises(Exception):
+            texture.write(b'\x03' * 4, level=2)
+
+    def test_texture_full_chain(self):
+        texture = self.ctx.texture((8, 4), 4, b'\xff' * 128, immutable=True)
+        texture.write(b'\x10\x20\x30\x40', level=3)
+        self.assertEqual(texture.read(level=3), b'\x10\x20\x30\x40')
+        self.assertEqual(texture.read(level=0), b'\xff' * 128)
+
+        # build_mipmaps keeps the allocated levels
+        texture.build_mipmaps()
+        self.assertEqual(texture.read(level=3), b'\xff' * 4)
+
+    def test_too_many_levels(self):
+        with self.assertRaises(Exception):
+            self.ctx.texture((8, 8), 1, levels=5)
+
+        with self.assertRaises(ValueError):
+            self.ctx.texture((8, 8), 1, levels=0)
+
+    def test_texture3d(self):
+        texture = self.ctx.texture3d((4, 4, 4), 1, b'\x01' * 64, levels=3)
+        texture.write(b'\x02' * 8, level=1)
+        texture.write(b'\x03', level=2)
+        self.assertEqual(texture.read(), b'\x01' * 64)
+
+        with self.assertRaises(Exception):
+            texture.write(b'\x04', level=3)
+
+    def test_texture_array(self):
+        texture = self.ctx.texture_array((4, 4, 3), 1, immutable=True)
+        texture.write(b'\x01' * 12, level=1)
+        texture.write(b'\x02' * 3, level=2)
+
+        with self.assertRaises(Exception):
+            texture.write(b'\x02' * 3, level=3)
+
+    def test_texture_cube(self):
+        texture = self.ctx.texture_cube((4, 4), 3, b'\x01' * 4 * 4 * 3 * 6, immutable=True)
+        for face in range(6):
+            texture.write(face, b'\x02' * 2 * 2 * 3, level=1)
+            texture.write(face, b'\x03' * 3, level=2)
+
+        self.assertEqual(texture.read(0), b'\x01' * 4 * 4 * 3)
+
+
+if __name__ == '__main__':
+    unittest.main()
@@ -0,0 +1,80 @@
+import unittest
+
+import numpy as np
+
+from common import get_context
+
+
+class TestCase(unittest.TestCase):
+
+    @classmethod
+    def setUpClass(cls):
+        cls.ctx = get_context()
+
+    def test_tiles(self):
+        tiled = self.ctx.tiled_framebuffer((10, 7), (4, 4))
+        self.assertEqual(tiled.tile_size, (4, 4))
+        self.assertEqual(tiled.tiles, [
+            (0, 0, 4, 4), (4, 0, 4, 4), (8, 0, 2, 4),
+            (0, 4, 4, 3), (4, 4, 4, 3), (8, 4, 2, 3),
+        ])
+        tiled.release()
+
+    def test_render_stitches_tiles(self):
+        tiled = self.ctx.tiled_framebuffer((10, 7), (4, 4))
+        output = np.zeros((7, 10, 4), dtype='u1')
+        viewports = []
+
+        def render_tile(viewport):
+            viewports.append(viewport)
+            index = len(viewports)
+            self.ctx.clear(index / 255, 0.0, 0.0, 1.0)
+
+        tiled.render(render_tile, output)
+        self.assertEqual(viewports, tiled.tiles)
+
+        for index, (x, y, w, h) in enumerate(viewports, 1):
+            np.testing.assert_array_equal(output[y:y + h, x:x + w, 0], index)
+
+        flipped = np.zeros_like(output)
+        viewports.clear()
+        tiled.render(render_tile, flipped, flip=True)
+        np.testing.assert_array_equal(flipped, output[::-1])
+        tiled.release()
+
+    def test_render_into_bytearray(self):
+        tiled = self.ctx.tiled_framebuffer((10, 7), (4, 4))
+        output = bytearray(10 * 7 * 4)
+        viewports = []
+
+        def render_tile(viewport):
+            viewports.append(viewport)
+            self.ctx.clear(len(viewports) / 255, 0.0, 0.0, 1.0)
+
+        tiled.render(render_tile, output)
+
+        for index, (x, y, w, h) in enumerate(viewports, 1):
+            for row in range(y, y + h):
+                for col in range(x, x + w):
+                    self.assertEqual(output[(row * 10 + col) * 4], index)
+
+        tiled.release()
+
+    def test_tile_matrix(self):
+        tiled = self.ctx.tiled_framebuffer((8, 8), (4, 4))
+        matrix = np.array(tiled.tile_matrix((4, 0, 4, 4)), 'f4').reshape(4, 4).T
+        np.testing.assert_allclose(matrix @ (0.0, -1.0, 0.0, 1.0), (-1.0, -1.0, 0.0, 1.0))
+        np.testing.assert_allclose(matrix @ (1.0, 0.0, 0.0, 1.0), (1.0, 1.0, 0.0, 1.0))
+        tiled.release()
+
+    def test_output_size_mismatch(self):
+        tiled = self.ctx.tiled_framebuffer((8, 8), (4, 4))
+
+        with self.assertRaises(Exception):
+            tiled.render(lambda viewport: None, bytearray(16))
+
+        tiled.release()
+
+
+if __name__ == '__main__':
+    unittest.main()
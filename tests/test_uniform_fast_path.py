@@ -0,0 +1,79 @@
+import unittest
+
+import numpy as np
+
+from common import get_context
+
+
+class TestCase(unittest.TestCase):
+
+    @classmethod
+    def setUpClass(cls):
+        cls.ctx = get_context()
+        cls.prog = cls.ctx.program(
+            vertex_shader='''
+                #version 330
+
+                uniform mat4 palette[8];
+                uniform vec4 colors[3];
+                uniform int indices[4];
+                uniform float scale;
+
+                out vec4 v_color;
+
+                void main() {
+                    v_color = palette[indices[gl_VertexID % 4]] * colors[gl_VertexID % 3] * scale;
+                    gl_Position = vec4(0.0, 0.0, 0.0, 1.0);
+                }
+            ''',
+            varyings=['v_color'],
+        )
+
+    def test_matrix_palette(self):
+        palette = np.arange(8 * 16, dtype='f4').reshape(8, 4, 4)
+        self.prog['palette'].value = palette
+        self.assertEqual(self.prog['palette'].value, [tuple(m.flatten().tolist()) for m in palette])
+
+    def test_vector_array(self):
+        colors = np.array([[1.0, 2.0, 3.0, 4.0], [5.0, 6.0, 7.0, 8.0], [9.0, 10.0, 11.0, 12.0]], dtype='f4')
+        self.prog['colors'].value = colors
+        self.assertEqual(self.prog['colors'].value, [tuple(c) for c in colors.tolist()])
+
+    def test_int_array(self):
+        self.prog['indices'].value = np.array([3, 2, 1, 0], dtype='i4')
+        self.assertEqual(self.prog['indices'].value, [3, 2, 1, 0])
+
+    def test_scalar(self):
+        self.prog['scale'].value = np.float32(2.5)
+        self.assertAlmostEqual(self.prog['scale'].value, 2.5)
+
+    def test_tuple_array(self):
+        self.prog['indices'].value = (0, 1, 2, 3)
+        self.assertEqual(self.prog['indices'].value, [0, 1, 2, 3])
+
+    def test_other_types_are_converted(self):
+        self.prog['indices'].value = [1, 1, 1, 1]
+        self.prog['scale'].value = np.float64(0.5)
+        self.assertEqual(self.prog['indices'].value, [1, 1, 1, 1])
+        self.assertAlmostEqual(self.prog['scale'].value, 0.5)
+
+    def test_non_contiguous(self):
+        colors = np.arange(24, dtype='f4').reshape(3, 8)[:, ::2]
+        with self.assertRaises(Exception):
+            self.prog['colors'].value = colors
+
+    def test_size_mismatch(self):
+        with self.assertRaises(Exception):
+            self.prog['palette'].value = np.zeros((7, 4, 4), dtype='f4')
+
+        with self.assertRaises(Exception):
+            self.prog['indices'].value = np.zeros(4, dtype='f4')
+
+    def test_large_list(self):
+        values = [tuple(float(i * 16 + j) for j in range(16)) for i in range(8)]
+        self.prog['palette'].value = values
+        self.assertEqual(self.prog['palette'].value, values)
+
+
+if __name__ == '__main__':
+    unittest.main()
@@ -0,0 +1,77 @@
+import struct
+import unittest
+
+from common import get_context
+
+
+class TestCase(unittest.TestCase):
+
+    @classmethod
+    def setUpClass(cls):
+        cls.ctx = get_context()
+        cls.prog = cls.ctx.program(
+            vertex_shader='''
+                #version 330
+
+                uniform vec4 color;
+                uniform mat4 palette[2];
+
+                out vec4 v_color;
+
+                void main() {
+                    v_color = palette[gl_VertexID % 2] * color;
+                    gl_Position = vec4(0.0, 0.0, 0.0, 1.0);
+                }
+            ''',
+            varyings=['v_color'],
+        )
+
+    def tearDown(self):
+        self.ctx.uniform_shadowing = True
+
+    def test_skip_same_value(self):
+        self.prog['color'].value = (1.0, 2.0, 3.0, 4.0)
+        issued, skipped = self.ctx.uniform_uploads
+
+        self.prog['color'].value = (1.0, 2.0, 3.0, 4.0)
+        self.prog['color'].write(struct.pack('4f', 1.0, 2.0, 3.0, 4.0))
+        self.assertEqual(self.ctx.uniform_uploads, (issued, skipped + 2))
+
+        self.prog['color'].value = (4.0, 3.0, 2.0, 1.0)
+        self.assertEqual(self.ctx.uniform_uploads, (issued + 1, skipped + 2))
+        self.assertEqual(self.prog['color'].value, (4.0, 3.0, 2.0, 1.0))
+
+    def test_array(self):
+        values = [tuple(float(i) for i in range(16)), tuple(float(i) for i in range(16, 32))]
+        self.prog['palette'].value = values
+        issued, skipped = self.ctx.uniform_uploads
+
+        self.prog['palette'].value = values
+        self.assertEqual(self.ctx.uniform_uploads, (issued, skipped + 1))
+
+        values[1] = tuple(float(i) for i in range(32, 48))
+        self.prog['palette'].value = values
+        self.assertEqual(self.ctx.uniform_uploads, (issued + 1, skipped + 1))
+        self.assertEqual(self.prog['palette'].value, values)
+
+    def test_invalidate_state_cache(self):
+        self.prog['color'].value = (0.5, 0.5, 0.5, 0.5)
+        self.ctx.invalidate_state_cache()
+        issued, skipped = self.ctx.uniform_uploads
+
+        self.prog['color'].value = (0.5, 0.5, 0.5, 0.5)
+        self.assertEqual(self.ctx.uniform_uploads, (issued + 1, skipped))
+
+    def test_disabled(self):
+        self.ctx.uniform_shadowing = False
+        self.assertFalse(self.ctx.uniform_shadowing)
+
+        self.prog['color'].value = (0.25, 0.25, 0.25, 0.25)
+        issued, skipped = self.ctx.uniform_uploads
+
+        self.prog['color'].value = (0.25, 0.25, 0.25, 0.25)
+        self.assertEqual(self.ctx.uniform_uploads, (issued + 1, skipped))
+
+
+if __name__ == '__main__':
+    unittest.main()
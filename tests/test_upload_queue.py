@@ -0,0 +1,113 @@
+import struct
+import threading
+import unittest
+
+from common import get_context
+
+
+class TestCase(unittest.TestCase):
+
+    @classmethod
+    def setUpClass(cls):
+        cls.ctx = get_context()
+        if cls.ctx.version_code < 440:
+            raise unittest.SkipTest('OpenGL 4.4 is not supported')
+
+    def test_texture(self):
+        queue = self.ctx.upload_queue(64, slots=2)
+        texture = self.ctx.texture((4, 4), 1)
+
+        queue.write(texture, b'\x01' * 16)
+        queue.write(texture, b'\x02' * 4, (1, 1, 2, 2))
+        self.assertEqual(queue.pending, 2)
+        self.assertEqual(queue.free, 64 - 20)
+
+        queue.flush()
+        self.assertEqual(queue.pending, 0)
+        self.assertEqual(queue.slot, 1)
+        self.assertEqual(texture.read(), b'\x01' * 5 + b'\x02\x02' + b'\x01\x01' + b'\x02\x02' + b'\x01' * 5)
+        queue.release()
+
+    def test_texture_array_levels(self):
+        queue = self.ctx.upload_queue(256)
+        texture = self.ctx.texture_array((4, 4, 2), 1)
+        queue.write(texture, b'\x03' * 32)
+        queue.flush()
+        self.assertEqual(texture.read(), b'\x03' * 32)
+
+        texture.build_mipmaps()
+        queue.write(texture, b'\x04' * 8, level=1)
+        queue.flush()
+
+        with self.assertRaises(Exception):
+            queue.write(texture, b'\x00' * 2, level=3)
+
+        immutable = self.ctx.texture_array((4, 4, 2), 1, levels=1, immutable=True)
+
+        with self.assertRaises(Exception):
+            queue.write(immutable, b'\x00' * 8, level=1)
+
+        queue.release()
+
+    def test_depth_texture(self):
+        queue = self.ctx.upload_queue(64)
+        texture = self.ctx.depth_texture((2, 2))
+        queue.write(texture, struct.pack('4f', 0.25, 0.5, 0.75, 1.0))
+        queue.flush()
+        self.assertEqual(texture.read(), struct.pack('4f', 0.25, 0.5, 0.75, 1.0))
+        queue.release()
+
+    def test_release_pending(self):
+        queue = self.ctx.upload_queue(1024)
+        texture = self.ctx.texture((16, 16), 4)
+        queue.write(texture, b'\x00' * 1024)
+        queue.release()
+
+        with self.assertRaises(Exception):
+            queue.write(texture, b'\x00' * 1024)
+
+    def test_full_slot(self):
+        queue = self.ctx.upload_queue(16, slots=1)
+        texture = self.ctx.texture((4, 4), 1)
+        queue.write(texture, b'\x00' * 16)
+
+        with self.assertRaises(Exception):
+            queue.write(texture, b'\x00' * 16)
+
+        queue.flush()
+        queue.write(texture, b'\x00' * 16)
+        queue.release()
+
+    def test_size_mismatch(self):
+        queue = self.ctx.upload_queue(64)
+        texture = self.ctx.texture3d((2, 2, 2), 2)
+
+        with self.assertRaises(Exception):
+            queue.write(texture, b'\x00' * 8)
+
+        self.assertEqual(queue.pending, 0)
+        queue.release()
+
+    def test_write_from_threads(self):
+        queue = self.ctx.upload_queue(4 * 1024)
+        textures = [self.ctx.texture((16, 16), 1) for i in range(8)]
+
+        def write(i):
+            queue.write(textures[i], bytes([i]) * 256)
+
+        threads = [threading.Thread(target=write, args=(i,)) for i in range(8)]
+        for thread in threads:
+            thread.start()
+        for thread in threads:
+            thread.join()
+
+        queue.flush()
+
+        for i, texture in enumerate(textures):
+            self.assertEqual(texture.read(), bytes([i]) * 256)
+
+        queue.release()
+
+
+if __name__ == '__main__':
+    unittest.main()
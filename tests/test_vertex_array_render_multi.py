@@ -0,0 +1,75 @@
+import struct
+import unittest
+
+import moderngl
+import numpy as np
+
+from common import get_context
+
+
+class TestCase(unittest.TestCase):
+
+    @classmethod
+    def setUpClass(cls):
+        cls.ctx = get_context()
+        cls.prog = cls.ctx.program(
+            vertex_shader='''
+                #version 330
+
+                in float in_vert;
+                out float out_vert;
+
+                void main() {
+                    out_vert = in_vert;
+                }
+            ''',
+            varyings=['out_vert']
+        )
+
+    def test_multi_draw_arrays(self):
+        vbo = self.ctx.buffer(np.arange(8, dtype='f4').tobytes())
+        vao = self.ctx.simple_vertex_array(self.prog, vbo, 'in_vert', mode=moderngl.POINTS)
+
+        query = self.ctx.query(primitives=True)
+        with query:
+            vao.render_multi(np.array([0, 4], dtype='i4'), np.array([2, 3], dtype='i4'))
+
+        self.assertEqual(query.primitives, 5)
+
+    def test_multi_draw_elements(self):
+        vbo = self.ctx.buffer(np.arange(8, dtype='f4').tobytes())
+        ibo = self.ctx.buffer(np.array([0, 1, 2, 3], dtype='u4').tobytes())
+        vao = self.ctx.simple_vertex_array(self.prog, vbo, 'in_vert', index_buffer=ibo, mode=moderngl.POINTS)
+
+        query = self.ctx.query(primitives=True)
+        with query:
+            vao.render_multi([0, 2], [2, 2], base_vertices=[4, 0])
+
+        self.assertEqual(query.primitives, 4)
+
+    def test_instances(self):
+        vbo = self.ctx.buffer(np.arange(8, dtype='f4').tobytes())
+        vao = self.ctx.simple_vertex_array(self.prog, vbo, 'in_vert', mode=moderngl.POINTS)
+
+        query = self.ctx.query(primitives=True)
+        with query:
+            vao.render_multi(struct.pack('2i', 0, 4), struct.pack('2i', 2, 1), instances=[3, 2])
+
+        self.assertEqual(query.primitives, 8)
+
+    def test_errors(self):
+        vbo = self.ctx.buffer(np.arange(8, dtype='f4').tobytes())
+        vao = self.ctx.simple_vertex_array(self.prog, vbo, 'in_vert', mode=moderngl.POINTS)
+
+        with self.assertRaises(moderngl.Error):
+            vao.render_multi([0, 1], [1])
+
+        with self.assertRaises(moderngl.Error):
+            vao.render_multi(np.array([0], dtype='i8'), np.array([1], dtype='i8'))
+
+        with self.assertRaises(moderngl.Error):
+            vao.render_multi([0], [1], base_vertices=[0])
+
+
+if __name__ == '__main__':
+    unittest.main()